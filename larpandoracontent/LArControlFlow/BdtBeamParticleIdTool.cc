@@ -23,6 +23,7 @@ namespace lar_content
 BdtBeamParticleIdTool::BdtBeamParticleIdTool() :
     m_useTrainingMode(false),
     m_trainingOutputFile(""),
+    m_trainingOutputFormat(LArTrainingExampleWriter::TEXT),
     m_minPurity(0.8f),
     m_minCompleteness(0.8f),
     m_adaBoostDecisionTree(AdaBoostDecisionTree()),
@@ -35,6 +36,14 @@ BdtBeamParticleIdTool::BdtBeamParticleIdTool() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+BdtBeamParticleIdTool::~BdtBeamParticleIdTool()
+{
+    if (m_useTrainingMode)
+        LArTrainingExampleWriter::Close(m_trainingOutputFile);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode BdtBeamParticleIdTool::Initialize()
 {
     // Get global LArTPC geometry information
@@ -113,9 +122,10 @@ void BdtBeamParticleIdTool::SelectOutputPfos(const pandora::Algorithm *const pAl
             if (std::find(bestSliceIndices.begin(), bestSliceIndices.end(), sliceIndex) != bestSliceIndices.end())
                 isGoodTrainingSlice = true;
 
-            LArMvaHelper::ProduceTrainingExample(m_trainingOutputFile, isGoodTrainingSlice, featureVector);
+            LArMvaHelper::ProduceTrainingExample(m_trainingOutputFile, m_trainingOutputFormat, isGoodTrainingSlice, featureVector);
         }
 
+        LArTrainingExampleWriter::FlushAll();
         return;
     }
 
@@ -680,6 +690,12 @@ StatusCode BdtBeamParticleIdTool::ReadSettings(const TiXmlHandle xmlHandle)
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle,
             "TrainingOutputFileName", m_trainingOutputFile));
 
+        bool useBinaryTrainingOutput(false);
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+            "UseBinaryTrainingOutput", useBinaryTrainingOutput));
+
+        m_trainingOutputFormat = (useBinaryTrainingOutput ? LArTrainingExampleWriter::BINARY : LArTrainingExampleWriter::TEXT);
+
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle,
             "CaloHitListName", m_caloHitListName));
 
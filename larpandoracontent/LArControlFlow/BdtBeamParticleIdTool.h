@@ -43,9 +43,9 @@ public:
     BdtBeamParticleIdTool &operator=(const BdtBeamParticleIdTool&) = default;
 
     /**
-     *  @brief  Destructor
+     *  @brief  Destructor, closing any training example files
      */
-    ~BdtBeamParticleIdTool() = default;
+    ~BdtBeamParticleIdTool();
 
     void SelectOutputPfos(const pandora::Algorithm *const pAlgorithm, const SliceHypotheses &beamSliceHypotheses, const SliceHypotheses &crSliceHypotheses, pandora::PfoList &selectedPfos);
 
@@ -389,6 +389,7 @@ private:
     // Training
     bool                            m_useTrainingMode;                      ///< Should use training mode. If true, training examples will be written to the output file
     std::string                     m_trainingOutputFile;                   ///< Output file name for training examples
+    LArTrainingExampleWriter::Format m_trainingOutputFormat;                ///< Output file format for training examples
     std::string                     m_caloHitListName;                      ///< Name of input calo hit list
     std::string                     m_mcParticleListName;                   ///< Name of input MC particle list
     float                           m_minPurity;                            ///< Minimum purity of the best slice to use event for training
@@ -17,6 +17,7 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArFileHelper.h"
 #include "larpandoracontent/LArHelpers/LArMCParticleHelper.h"
+#include "larpandoracontent/LArHelpers/LArMultiThreadingHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 #include "larpandoracontent/LArHelpers/LArStitchingHelper.h"
 
@@ -46,10 +47,14 @@ MasterAlgorithm::MasterAlgorithm() :
     m_visualizeOverallRecoStatus(false),
     m_shouldRemoveOutOfTimeHits(true),
     m_pSlicingWorkerInstance(nullptr),
-    m_pSliceNuWorkerInstance(nullptr),
-    m_pSliceCRWorkerInstance(nullptr),
     m_fullWidthCRWorkerWireGaps(true),
     m_passMCParticlesToWorkerInstances(false),
+    m_shouldRunCRWorkersInParallel(false),
+    m_nCRWorkerThreads(1),
+    m_nSliceWorkerInstances(1),
+    m_nSliceWorkerThreads(0),
+    m_instrumentationOutputFormat(LArStageInstrumentation::CSV),
+    m_instrumentationEventNumber(0),
     m_filePathEnvironmentVariable("FW_SEARCH_PATH"),
     m_inTimeMaxX0(1.f)
 {
@@ -157,12 +162,43 @@ StatusCode MasterAlgorithm::Run()
     if (!m_workerInstancesInitialized)
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->InitializeWorkerInstances());
 
+    m_stageInstrumentation.Clear();
+    const StatusCode statusCode(this->RunWorkerStages());
+
+    if (!m_instrumentationOutputFile.empty())
+    {
+        if (!m_stageInstrumentation.IsOutputFileOpen())
+            m_stageInstrumentation.OpenOutputFile(m_instrumentationOutputFile, m_instrumentationOutputFormat);
+
+        m_stageInstrumentation.WriteEvent(m_instrumentationEventNumber++);
+    }
+
+    return statusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MasterAlgorithm::RunWorkerStages()
+{
     if (m_passMCParticlesToWorkerInstances)
+    {
+        LArStageInstrumentation::ScopedStage stage(this->GetStageInstrumentation(), "CopyMCParticles");
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->CopyMCParticles());
+    }
 
     PfoToFloatMap stitchedPfosToX0Map;
     VolumeIdToHitListMap volumeIdToHitListMap;
-    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetVolumeIdToHitListMap(volumeIdToHitListMap));
+    {
+        LArStageInstrumentation::ScopedStage stage(this->GetStageInstrumentation(), "GetVolumeIdToHitListMap");
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->GetVolumeIdToHitListMap(volumeIdToHitListMap));
+
+        if (stage.IsEnabled())
+        {
+            unsigned int nCaloHits(0);
+            for (const VolumeIdToHitListMap::value_type &mapEntry : volumeIdToHitListMap) nCaloHits += mapEntry.second.m_allHitList.size();
+            stage.SetCounts(nCaloHits, 0, 0);
+        }
+    }
 
     if (m_shouldRunAllHitsCosmicReco)
     {
@@ -172,22 +208,42 @@ StatusCode MasterAlgorithm::Run()
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RecreateCosmicRayPfos(pfoToLArTPCMap));
 
         if (m_shouldRunStitching)
+        {
+            LArStageInstrumentation::ScopedStage stage(this->GetStageInstrumentation(), "StitchCosmicRayPfos");
             PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->StitchCosmicRayPfos(pfoToLArTPCMap, stitchedPfosToX0Map));
+            stage.SetCounts(0, 0, stitchedPfosToX0Map.size());
+        }
     }
 
     if (m_shouldRunCosmicHitRemoval)
     {
         PfoList clearCosmicRayPfos, ambiguousPfos;
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->TagCosmicRayPfos(stitchedPfosToX0Map, clearCosmicRayPfos, ambiguousPfos));
+        {
+            LArStageInstrumentation::ScopedStage stage(this->GetStageInstrumentation(), "TagCosmicRayPfos");
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->TagCosmicRayPfos(stitchedPfosToX0Map, clearCosmicRayPfos, ambiguousPfos));
+            stage.SetCounts(0, 0, clearCosmicRayPfos.size() + ambiguousPfos.size());
+        }
+
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RunCosmicRayHitRemoval(ambiguousPfos));
     }
 
     SliceVector sliceVector;
-    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RunSlicing(volumeIdToHitListMap, sliceVector));
+    {
+        LArStageInstrumentation::ScopedStage stage(this->GetStageInstrumentation(), "RunSlicing");
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RunSlicing(volumeIdToHitListMap, sliceVector));
+
+        if (stage.IsEnabled())
+        {
+            unsigned int nCaloHits(0);
+            for (const CaloHitList &sliceHits : sliceVector) nCaloHits += sliceHits.size();
+            stage.SetCounts(nCaloHits, 0, sliceVector.size());
+        }
+    }
 
     if (m_shouldRunNeutrinoRecoOption || m_shouldRunCosmicRecoOption)
     {
         SliceHypotheses nuSliceHypotheses, crSliceHypotheses;
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->ExtendSliceWorkerPool(sliceVector.size()));
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RunSliceReconstruction(sliceVector, nuSliceHypotheses, crSliceHypotheses));
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->SelectBestSliceHypotheses(nuSliceHypotheses, crSliceHypotheses));
     }
@@ -217,19 +273,68 @@ StatusCode MasterAlgorithm::InitializeWorkerInstances()
         if (m_shouldRunSlicing)
             m_pSlicingWorkerInstance = this->CreateWorkerInstance(larTPCMap, gapList, m_slicingSettingsFile, "SlicingWorker");
 
+        PandoraInstanceList newWorkerInstances;
+        this->CreateSliceWorkerInstances(m_nSliceWorkerInstances, newWorkerInstances);
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "MasterAlgorithm: Exception during initialization of worker instances " << statusCodeException.ToString() << std::endl;
+        return statusCodeException.GetStatusCode();
+    }
+
+    m_workerInstancesInitialized = true;
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void MasterAlgorithm::CreateSliceWorkerInstances(const unsigned int poolSize, PandoraInstanceList &newWorkerInstances)
+{
+    const LArTPCMap &larTPCMap(this->GetPandora().GetGeometry()->GetLArTPCMap());
+    const DetectorGapList &gapList(this->GetPandora().GetGeometry()->GetDetectorGapList());
+
+    for (unsigned int poolIndex = std::max(m_sliceNuWorkerInstances.size(), m_sliceCRWorkerInstances.size()); poolIndex < poolSize; ++poolIndex)
+    {
+        const std::string poolSuffix((0 == poolIndex) ? "" : std::to_string(poolIndex));
+
         if (m_shouldRunNeutrinoRecoOption)
-            m_pSliceNuWorkerInstance = this->CreateWorkerInstance(larTPCMap, gapList, m_nuSettingsFile, "SliceNuWorker");
+        {
+            m_sliceNuWorkerInstances.push_back(this->CreateWorkerInstance(larTPCMap, gapList, m_nuSettingsFile, "SliceNuWorker" + poolSuffix));
+            newWorkerInstances.push_back(m_sliceNuWorkerInstances.back());
+        }
 
         if (m_shouldRunCosmicRecoOption)
-            m_pSliceCRWorkerInstance = this->CreateWorkerInstance(larTPCMap, gapList, m_crSettingsFile, "SliceCRWorker");
+        {
+            m_sliceCRWorkerInstances.push_back(this->CreateWorkerInstance(larTPCMap, gapList, m_crSettingsFile, "SliceCRWorker" + poolSuffix));
+            newWorkerInstances.push_back(m_sliceCRWorkerInstances.back());
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MasterAlgorithm::ExtendSliceWorkerPool(const unsigned int nSlices)
+{
+    // ATTN A worker instance is only reset at the end of the event, so pooled slice reconstruction gives each slice its own pool member
+    if (m_nSliceWorkerInstances <= 1)
+        return STATUS_CODE_SUCCESS;
+
+    PandoraInstanceList newWorkerInstances;
+
+    try
+    {
+        this->CreateSliceWorkerInstances(nSlices, newWorkerInstances);
     }
     catch (const StatusCodeException &statusCodeException)
     {
-        std::cout << "MasterAlgorithm: Exception during initialization of worker instances " << statusCodeException.ToString() << std::endl;
+        std::cout << "MasterAlgorithm: Exception during creation of slice worker instances " << statusCodeException.ToString() << std::endl;
         return statusCodeException.GetStatusCode();
     }
 
-    m_workerInstancesInitialized = true;
+    // ATTN New pool members missed the copy of the mc particles for this event
+    if (m_passMCParticlesToWorkerInstances && !newWorkerInstances.empty())
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->CopyMCParticles(newWorkerInstances));
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -237,13 +342,20 @@ StatusCode MasterAlgorithm::InitializeWorkerInstances()
 
 StatusCode MasterAlgorithm::CopyMCParticles() const
 {
-    const MCParticleList *pMCParticleList(nullptr);
-    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetList(*this, m_inputMCParticleListName, pMCParticleList));
-
     PandoraInstanceList pandoraWorkerInstances(m_crWorkerInstances);
     if (m_pSlicingWorkerInstance) pandoraWorkerInstances.push_back(m_pSlicingWorkerInstance);
-    if (m_pSliceNuWorkerInstance) pandoraWorkerInstances.push_back(m_pSliceNuWorkerInstance);
-    if (m_pSliceCRWorkerInstance) pandoraWorkerInstances.push_back(m_pSliceCRWorkerInstance);
+    pandoraWorkerInstances.insert(pandoraWorkerInstances.end(), m_sliceNuWorkerInstances.begin(), m_sliceNuWorkerInstances.end());
+    pandoraWorkerInstances.insert(pandoraWorkerInstances.end(), m_sliceCRWorkerInstances.begin(), m_sliceCRWorkerInstances.end());
+
+    return this->CopyMCParticles(pandoraWorkerInstances);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MasterAlgorithm::CopyMCParticles(const PandoraInstanceList &pandoraWorkerInstances) const
+{
+    const MCParticleList *pMCParticleList(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::GetList(*this, m_inputMCParticleListName, pMCParticleList));
 
     LArMCParticleFactory mcParticleFactory;
 
@@ -293,6 +405,37 @@ StatusCode MasterAlgorithm::GetVolumeIdToHitListMap(VolumeIdToHitListMap &volume
 
 StatusCode MasterAlgorithm::RunCosmicRayReconstruction(const VolumeIdToHitListMap &volumeIdToHitListMap) const
 {
+    if (m_shouldRunCRWorkersInParallel)
+    {
+        PandoraInstanceList crWorkersToRun;
+        std::vector<const CaloHitList*> crWorkerHitLists;
+
+        for (const Pandora *const pCRWorker : m_crWorkerInstances)
+        {
+            const LArTPC &larTPC(pCRWorker->GetGeometry()->GetLArTPC());
+            VolumeIdToHitListMap::const_iterator iter(volumeIdToHitListMap.find(larTPC.GetLArTPCVolumeId()));
+
+            if (volumeIdToHitListMap.end() == iter)
+                continue;
+
+            crWorkersToRun.push_back(pCRWorker);
+            crWorkerHitLists.push_back(&(iter->second.m_allHitList));
+        }
+
+        const unsigned int nThreads(LArMultiThreadingHelper::GetNThreads(m_nCRWorkerThreads, crWorkersToRun.size()));
+
+        if (m_printOverallRecoStatus)
+            std::cout << "Running " << crWorkersToRun.size() << " cosmic-ray reconstruction worker instance(s) using " << nThreads << " thread(s)" << std::endl;
+
+        // ATTN Each worker instance receives a disjoint hit list and touches no master instance state. Concurrent ProcessEvent calls further
+        // require that the algorithms and tools configured for the workers share no mutable state (e.g. static caches or output files)
+        return LArMultiThreadingHelper::RunTasks(crWorkersToRun.size(), nThreads, [&](const unsigned int workerIndex) -> StatusCode
+        {
+            const Pandora *const pCRWorker(crWorkersToRun.at(workerIndex));
+            return this->RunWorkerInstance(pCRWorker, *(crWorkerHitLists.at(workerIndex)), "CRWorker", pCRWorker->GetGeometry()->GetLArTPC().GetLArTPCVolumeId());
+        });
+    }
+
     unsigned int workerCounter(0);
 
     for (const Pandora *const pCRWorker : m_crWorkerInstances)
@@ -303,13 +446,10 @@ StatusCode MasterAlgorithm::RunCosmicRayReconstruction(const VolumeIdToHitListMa
         if (volumeIdToHitListMap.end() == iter)
             continue;
 
-        for (const CaloHit *const pCaloHit : iter->second.m_allHitList)
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(pCRWorker, pCaloHit));
-
         if (m_printOverallRecoStatus)
             std::cout << "Running cosmic-ray reconstruction worker instance " << ++workerCounter << " of " << m_crWorkerInstances.size() << std::endl;
 
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*pCRWorker));
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RunWorkerInstance(pCRWorker, iter->second.m_allHitList, "CRWorker", larTPC.GetLArTPCVolumeId()));
     }
 
     return STATUS_CODE_SUCCESS;
@@ -317,6 +457,38 @@ StatusCode MasterAlgorithm::RunCosmicRayReconstruction(const VolumeIdToHitListMa
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode MasterAlgorithm::RunWorkerInstance(const Pandora *const pPandoraWorker, const CaloHitList &caloHitList, const char *const stageNamePrefix,
+    const unsigned int stageNameIndex) const
+{
+    LArStageInstrumentation::ScopedStage stage(this->GetStageInstrumentation(), stageNamePrefix, stageNameIndex);
+
+    for (const CaloHit *const pCaloHit : caloHitList)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(pPandoraWorker, pCaloHit));
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*pPandoraWorker));
+
+    if (stage.IsEnabled())
+    {
+        const PfoList *pPfoList(nullptr);
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*pPandoraWorker, pPfoList));
+
+        unsigned int nClusters(0);
+        for (const ParticleFlowObject *const pPfo : *pPfoList) nClusters += pPfo->GetClusterList().size();
+        stage.SetCounts(caloHitList.size(), nClusters, pPfoList->size());
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArStageInstrumentation *MasterAlgorithm::GetStageInstrumentation() const
+{
+    return (m_instrumentationOutputFile.empty() ? nullptr : &m_stageInstrumentation);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode MasterAlgorithm::RecreateCosmicRayPfos(PfoToLArTPCMap &pfoToLArTPCMap) const
 {
     for (const Pandora *const pCRWorker : m_crWorkerInstances)
@@ -509,63 +681,133 @@ StatusCode MasterAlgorithm::RunSlicing(const VolumeIdToHitListMap &volumeIdToHit
 
 StatusCode MasterAlgorithm::RunSliceReconstruction(SliceVector &sliceVector, SliceHypotheses &nuSliceHypotheses, SliceHypotheses &crSliceHypotheses) const
 {
-    unsigned int sliceCounter(0);
+    SliceVector masterSliceVector;
 
     for (const CaloHitList &sliceHits : sliceVector)
     {
+        masterSliceVector.push_back(CaloHitList());
+
+        // ATTN Must ensure we copy the hit actually owned by master instance; access differs with/without slicing enabled
         for (const CaloHit *const pSliceCaloHit : sliceHits)
-        {
-            // ATTN Must ensure we copy the hit actually owned by master instance; access differs with/without slicing enabled
-            const CaloHit *const pCaloHitInMaster(m_shouldRunSlicing ? static_cast<const CaloHit*>(pSliceCaloHit->GetParentAddress()) : pSliceCaloHit);
+            masterSliceVector.back().push_back(m_shouldRunSlicing ? static_cast<const CaloHit*>(pSliceCaloHit->GetParentAddress()) : pSliceCaloHit);
+    }
+
+    if (m_nSliceWorkerInstances > 1)
+    {
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RunSliceReconstructionWithWorkerPool(masterSliceVector, nuSliceHypotheses, crSliceHypotheses));
+    }
+    else
+    {
+        const Pandora *const pSliceNuWorker(m_shouldRunNeutrinoRecoOption ? m_sliceNuWorkerInstances.front() : nullptr);
+        const Pandora *const pSliceCRWorker(m_shouldRunCosmicRecoOption ? m_sliceCRWorkerInstances.front() : nullptr);
+        unsigned int sliceCounter(0);
 
+        for (const CaloHitList &sliceHits : masterSliceVector)
+        {
             if (m_shouldRunNeutrinoRecoOption)
-                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(m_pSliceNuWorkerInstance, pCaloHitInMaster));
+            {
+                if (m_printOverallRecoStatus)
+                    std::cout << "Running nu worker instance for slice " << (sliceCounter + 1) << " of " << sliceVector.size() << std::endl;
+
+                const PfoList *pSliceNuPfos(nullptr);
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RunWorkerInstance(pSliceNuWorker, sliceHits, "SliceNuWorker", sliceCounter));
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*pSliceNuWorker, pSliceNuPfos));
+                nuSliceHypotheses.push_back(*pSliceNuPfos);
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->SetSliceIndex(*pSliceNuPfos, sliceCounter));
+            }
 
             if (m_shouldRunCosmicRecoOption)
-                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->Copy(m_pSliceCRWorkerInstance, pCaloHitInMaster));
+            {
+                if (m_printOverallRecoStatus)
+                    std::cout << "Running cr worker instance for slice " << (sliceCounter + 1) << " of " << sliceVector.size() << std::endl;
+
+                const PfoList *pSliceCRPfos(nullptr);
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RunWorkerInstance(pSliceCRWorker, sliceHits, "SliceCRWorker", sliceCounter));
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*pSliceCRWorker, pSliceCRPfos));
+                crSliceHypotheses.push_back(*pSliceCRPfos);
+                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->SetSliceIndex(*pSliceCRPfos, sliceCounter));
+            }
+
+            ++sliceCounter;
         }
+    }
+
+    if (m_shouldRunNeutrinoRecoOption && m_shouldRunCosmicRecoOption && (nuSliceHypotheses.size() != crSliceHypotheses.size()))
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MasterAlgorithm::RunSliceReconstructionWithWorkerPool(const SliceVector &masterSliceVector, SliceHypotheses &nuSliceHypotheses,
+    SliceHypotheses &crSliceHypotheses) const
+{
+    const unsigned int nSlices(masterSliceVector.size());
 
+    // ATTN Slice i is processed by pool member i, which must have been created by ExtendSliceWorkerPool
+    if ((m_shouldRunNeutrinoRecoOption && (m_sliceNuWorkerInstances.size() < nSlices)) || (m_shouldRunCosmicRecoOption && (m_sliceCRWorkerInstances.size() < nSlices)))
+        return STATUS_CODE_NOT_INITIALIZED;
+
+    SliceHypotheses nuSliceOutput(m_shouldRunNeutrinoRecoOption ? nSlices : 0), crSliceOutput(m_shouldRunCosmicRecoOption ? nSlices : 0);
+    const unsigned int nThreads(LArMultiThreadingHelper::GetNThreads(m_nSliceWorkerThreads, nSlices));
+
+    if (m_printOverallRecoStatus)
+        std::cout << "Running slice worker instances for " << nSlices << " slice(s) using " << nThreads << " thread(s)" << std::endl;
+
+    auto processSlice = [&](const unsigned int sliceIndex) -> StatusCode
+    {
         if (m_shouldRunNeutrinoRecoOption)
         {
-            if (m_printOverallRecoStatus)
-                std::cout << "Running nu worker instance for slice " << (sliceCounter + 1) << " of " << sliceVector.size() << std::endl;
-
+            const Pandora *const pSliceNuWorker(m_sliceNuWorkerInstances.at(sliceIndex));
             const PfoList *pSliceNuPfos(nullptr);
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSliceNuWorkerInstance));
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*m_pSliceNuWorkerInstance, pSliceNuPfos));
-            nuSliceHypotheses.push_back(*pSliceNuPfos);
-
-            for (const ParticleFlowObject *const pPfo : *pSliceNuPfos)
-            {
-                PandoraContentApi::ParticleFlowObject::Metadata metadata;
-                metadata.m_propertiesToAdd["SliceIndex"] = sliceCounter;
-                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::AlterMetadata(*this, pPfo, metadata));
-            }
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RunWorkerInstance(pSliceNuWorker, masterSliceVector.at(sliceIndex), "SliceNuWorker", sliceIndex));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*pSliceNuWorker, pSliceNuPfos));
+            nuSliceOutput.at(sliceIndex) = *pSliceNuPfos;
         }
 
         if (m_shouldRunCosmicRecoOption)
         {
-            if (m_printOverallRecoStatus)
-                std::cout << "Running cr worker instance for slice " << (sliceCounter + 1) << " of " << sliceVector.size() << std::endl;
-
+            const Pandora *const pSliceCRWorker(m_sliceCRWorkerInstances.at(sliceIndex));
             const PfoList *pSliceCRPfos(nullptr);
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::ProcessEvent(*m_pSliceCRWorkerInstance));
-            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*m_pSliceCRWorkerInstance, pSliceCRPfos));
-            crSliceHypotheses.push_back(*pSliceCRPfos);
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->RunWorkerInstance(pSliceCRWorker, masterSliceVector.at(sliceIndex), "SliceCRWorker", sliceIndex));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::GetCurrentPfoList(*pSliceCRWorker, pSliceCRPfos));
+            crSliceOutput.at(sliceIndex) = *pSliceCRPfos;
+        }
 
-            for (const ParticleFlowObject *const pPfo : *pSliceCRPfos)
-            {
-                PandoraContentApi::ParticleFlowObject::Metadata metadata;
-                metadata.m_propertiesToAdd["SliceIndex"] = sliceCounter;
-                PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::AlterMetadata(*this, pPfo, metadata));
-            }
+        return STATUS_CODE_SUCCESS;
+    };
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArMultiThreadingHelper::RunTasks(nSlices, nThreads, processSlice));
+
+    for (unsigned int sliceIndex = 0; sliceIndex < nSlices; ++sliceIndex)
+    {
+        if (m_shouldRunNeutrinoRecoOption)
+        {
+            nuSliceHypotheses.push_back(nuSliceOutput.at(sliceIndex));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->SetSliceIndex(nuSliceHypotheses.back(), sliceIndex));
         }
 
-        ++sliceCounter;
+        if (m_shouldRunCosmicRecoOption)
+        {
+            crSliceHypotheses.push_back(crSliceOutput.at(sliceIndex));
+            PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->SetSliceIndex(crSliceHypotheses.back(), sliceIndex));
+        }
     }
 
-    if (m_shouldRunNeutrinoRecoOption && m_shouldRunCosmicRecoOption && (nuSliceHypotheses.size() != crSliceHypotheses.size()))
-        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode MasterAlgorithm::SetSliceIndex(const PfoList &slicePfos, const unsigned int sliceIndex) const
+{
+    for (const ParticleFlowObject *const pPfo : slicePfos)
+    {
+        PandoraContentApi::ParticleFlowObject::Metadata metadata;
+        metadata.m_propertiesToAdd["SliceIndex"] = sliceIndex;
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::ParticleFlowObject::AlterMetadata(*this, pPfo, metadata));
+    }
 
     return STATUS_CODE_SUCCESS;
 }
@@ -608,11 +850,11 @@ StatusCode MasterAlgorithm::Reset()
     if (m_pSlicingWorkerInstance)
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*m_pSlicingWorkerInstance));
 
-    if (m_pSliceNuWorkerInstance)
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*m_pSliceNuWorkerInstance));
+    for (const Pandora *const pSliceNuWorker : m_sliceNuWorkerInstances)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*pSliceNuWorker));
 
-    if (m_pSliceCRWorkerInstance)
-        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*m_pSliceCRWorkerInstance));
+    for (const Pandora *const pSliceCRWorker : m_sliceCRWorkerInstances)
+        PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraApi::Reset(*pSliceCRWorker));
 
     return STATUS_CODE_SUCCESS;
 }
@@ -1156,6 +1398,45 @@ StatusCode MasterAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "PassMCParticlesToWorkerInstances", m_passMCParticlesToWorkerInstances));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "ShouldRunCRWorkersInParallel", m_shouldRunCRWorkersInParallel));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "NCRWorkerThreads", m_nCRWorkerThreads));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "NSliceWorkerInstances", m_nSliceWorkerInstances));
+
+    if (0 == m_nSliceWorkerInstances)
+    {
+        std::cout << "MasterAlgorithm::ReadSettings - NSliceWorkerInstances must be at least one" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "NSliceWorkerThreads", m_nSliceWorkerThreads));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "InstrumentationOutputFile", m_instrumentationOutputFile));
+
+    std::string instrumentationOutputFormat("csv");
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "InstrumentationOutputFormat", instrumentationOutputFormat));
+
+    if ("csv" == instrumentationOutputFormat)
+    {
+        m_instrumentationOutputFormat = LArStageInstrumentation::CSV;
+    }
+    else if ("json" == instrumentationOutputFormat)
+    {
+        m_instrumentationOutputFormat = LArStageInstrumentation::JSON;
+    }
+    else
+    {
+        std::cout << "MasterAlgorithm::ReadSettings - InstrumentationOutputFormat must be csv or json" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "FilePathEnvironmentVariable", m_filePathEnvironmentVariable));
 
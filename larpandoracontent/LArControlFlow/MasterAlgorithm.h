@@ -13,6 +13,8 @@
 
 #include "larpandoracontent/LArControlFlow/MultiPandoraApi.h"
 
+#include "larpandoracontent/LArObjects/LArStageInstrumentation.h"
+
 #include <unordered_map>
 
 namespace lar_content
@@ -93,16 +95,43 @@ protected:
 
     pandora::StatusCode Run();
 
+    /**
+     *  @brief  Run the worker stages for the current event
+     */
+    pandora::StatusCode RunWorkerStages();
+
     /**
      *  @brief  Initialize pandora worker instances
      */
     pandora::StatusCode InitializeWorkerInstances();
 
+    /**
+     *  @brief  Create per-slice nu and cr worker instances, as required, so that the pools of per-slice worker instances reach a given size
+     *
+     *  @param  poolSize the required pool size
+     *  @param  newWorkerInstances to receive the list of newly created worker instances
+     */
+    void CreateSliceWorkerInstances(const unsigned int poolSize, PandoraInstanceList &newWorkerInstances);
+
+    /**
+     *  @brief  If slices are to be processed concurrently, extend the pools of per-slice worker instances so that each slice has its own member
+     *
+     *  @param  nSlices the number of slices in the current event
+     */
+    pandora::StatusCode ExtendSliceWorkerPool(const unsigned int nSlices);
+
     /**
      *  @brief  Copy mc particles in the named input list to all pandora worker instances
      */
     pandora::StatusCode CopyMCParticles() const;
 
+    /**
+     *  @brief  Copy mc particles in the named input list to a list of pandora worker instances
+     *
+     *  @param  pandoraWorkerInstances the list of pandora worker instances
+     */
+    pandora::StatusCode CopyMCParticles(const PandoraInstanceList &pandoraWorkerInstances) const;
+
     /**
      *  @brief  Get the mapping from lar tpc volume id to lists of all hits, and truncated hits
      *
@@ -117,6 +146,24 @@ protected:
      */
     pandora::StatusCode RunCosmicRayReconstruction(const VolumeIdToHitListMap &volumeIdToHitListMap) const;
 
+    /**
+     *  @brief  Copy a list of calo hits to a worker instance and run the worker instance event processing
+     *
+     *  @param  pPandoraWorker the address of the pandora worker instance
+     *  @param  caloHitList the list of calo hits to copy to the worker instance
+     *  @param  stageNamePrefix the prefix of the name under which to record the stage instrumentation
+     *  @param  stageNameIndex the index completing the name under which to record the stage instrumentation
+     */
+    pandora::StatusCode RunWorkerInstance(const pandora::Pandora *const pPandoraWorker, const pandora::CaloHitList &caloHitList, const char *const stageNamePrefix,
+        const unsigned int stageNameIndex) const;
+
+    /**
+     *  @brief  Get the stage instrumentation for the current event
+     *
+     *  @return the address of the stage instrumentation, null if instrumentation is disabled
+     */
+    LArStageInstrumentation *GetStageInstrumentation() const;
+
     /**
      *  @brief  Recreate cosmic-ray pfos (created by worker instances) in the master instance
      *
@@ -165,6 +212,25 @@ protected:
      */
     pandora::StatusCode RunSliceReconstruction(SliceVector &sliceVector, SliceHypotheses &nuSliceHypotheses, SliceHypotheses &crSliceHypotheses) const;
 
+    /**
+     *  @brief  Process slices concurrently, each using its own member of the pools of per-slice worker instances, with output ordered as
+     *          for serial processing
+     *
+     *  @param  masterSliceVector the slice vector, containing the calo hits owned by the master instance
+     *  @param  nuSliceHypotheses to receive the vector of slice neutrino hypotheses
+     *  @param  crSliceHypotheses to receive the vector of slice cosmic-ray hypotheses
+     */
+    pandora::StatusCode RunSliceReconstructionWithWorkerPool(const SliceVector &masterSliceVector, SliceHypotheses &nuSliceHypotheses,
+        SliceHypotheses &crSliceHypotheses) const;
+
+    /**
+     *  @brief  Label the pfos in a slice hypothesis with the slice index
+     *
+     *  @param  slicePfos the list of pfos in the slice hypothesis
+     *  @param  sliceIndex the slice index
+     */
+    pandora::StatusCode SetSliceIndex(const pandora::PfoList &slicePfos, const unsigned int sliceIndex) const;
+
     /**
      *  @brief  Examine slice hypotheses to identify the most appropriate to provide in final event output
      *
@@ -318,11 +384,20 @@ protected:
 
     PandoraInstanceList         m_crWorkerInstances;                ///< The list of cosmic-ray reconstruction worker instances
     const pandora::Pandora     *m_pSlicingWorkerInstance;           ///< The slicing worker instance
-    const pandora::Pandora     *m_pSliceNuWorkerInstance;           ///< The per-slice neutrino reconstruction worker instance
-    const pandora::Pandora     *m_pSliceCRWorkerInstance;           ///< The per-slice cosmic-ray reconstruction worker instance
+    PandoraInstanceList         m_sliceNuWorkerInstances;           ///< The pool of per-slice neutrino reconstruction worker instances
+    PandoraInstanceList         m_sliceCRWorkerInstances;           ///< The pool of per-slice cosmic-ray reconstruction worker instances
 
     bool                        m_fullWidthCRWorkerWireGaps;        ///< Whether wire-type line gaps in cosmic-ray worker instances should cover all drift time
     bool                        m_passMCParticlesToWorkerInstances; ///< Whether to pass mc particle details (and links to calo hits) to worker instances
+    bool                        m_shouldRunCRWorkersInParallel;     ///< Whether to run the per-volume cosmic-ray worker instances concurrently (worker algorithms must share no mutable state)
+    unsigned int                m_nCRWorkerThreads;                 ///< The number of threads for cosmic-ray worker instances (default one, zero means one per core)
+    unsigned int                m_nSliceWorkerInstances;            ///< The initial number of nu and cr per-slice worker instances; if > 1, slices run concurrently and the pools grow to one member per slice
+    unsigned int                m_nSliceWorkerThreads;              ///< The number of threads for per-slice worker instances (zero means one per core)
+
+    std::string                 m_instrumentationOutputFile;        ///< The per-stage instrumentation output file (instrumentation disabled if empty)
+    LArStageInstrumentation::OutputFormat m_instrumentationOutputFormat; ///< The per-stage instrumentation output format
+    unsigned int                m_instrumentationEventNumber;       ///< The event number for per-stage instrumentation output
+    mutable LArStageInstrumentation m_stageInstrumentation;         ///< The per-stage instrumentation for the current event
 
     typedef std::vector<StitchingBaseTool*> StitchingToolVector;
     typedef std::vector<CosmicRayTaggingBaseTool*> CosmicRayTaggingToolVector;
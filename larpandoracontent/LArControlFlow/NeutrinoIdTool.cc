@@ -28,6 +28,7 @@ namespace lar_content
 template<typename T>
 NeutrinoIdTool<T>::NeutrinoIdTool() :
     m_useTrainingMode(false),
+    m_trainingOutputFormat(LArTrainingExampleWriter::TEXT),
     m_selectNuanceCode(false),
     m_nuance(-std::numeric_limits<int>::max()),
     m_minPurity(0.9f),
@@ -40,6 +41,15 @@ NeutrinoIdTool<T>::NeutrinoIdTool() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template<typename T>
+NeutrinoIdTool<T>::~NeutrinoIdTool()
+{
+    if (m_useTrainingMode)
+        LArTrainingExampleWriter::Close(m_trainingOutputFile);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template<typename T>
 void NeutrinoIdTool<T>::SelectOutputPfos(const Algorithm *const pAlgorithm, const SliceHypotheses &nuSliceHypotheses, const SliceHypotheses &crSliceHypotheses, PfoList &selectedPfos)
 {
@@ -67,9 +77,10 @@ void NeutrinoIdTool<T>::SelectOutputPfos(const Algorithm *const pAlgorithm, cons
 
             LArMvaHelper::MvaFeatureVector featureVector;
             features.GetFeatureVector(featureVector);
-            LArMvaHelper::ProduceTrainingExample(m_trainingOutputFile, sliceIndex == bestSliceIndex, featureVector);
+            LArMvaHelper::ProduceTrainingExample(m_trainingOutputFile, m_trainingOutputFormat, sliceIndex == bestSliceIndex, featureVector);
         }
 
+        LArTrainingExampleWriter::FlushAll();
         return;
     }
 
@@ -544,6 +555,12 @@ StatusCode NeutrinoIdTool<T>::ReadSettings(const TiXmlHandle xmlHandle)
     {
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle,
             "TrainingOutputFileName", m_trainingOutputFile));
+
+        bool useBinaryTrainingOutput(false);
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+            "UseBinaryTrainingOutput", useBinaryTrainingOutput));
+
+        m_trainingOutputFormat = (useBinaryTrainingOutput ? LArTrainingExampleWriter::BINARY : LArTrainingExampleWriter::TEXT);
     }
 
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
@@ -37,6 +37,11 @@ public:
      */
     NeutrinoIdTool();
 
+    /**
+     *  @brief  Destructor, closing any training example files
+     */
+    ~NeutrinoIdTool();
+
     void SelectOutputPfos(const pandora::Algorithm *const pAlgorithm, const SliceHypotheses &nuSliceHypotheses, const SliceHypotheses &crSliceHypotheses, pandora::PfoList &selectedPfos);
 
 private:
@@ -243,6 +248,7 @@ private:
     // Training
     bool                  m_useTrainingMode;              ///< Should use training mode. If true, training examples will be written to the output file
     std::string           m_trainingOutputFile;           ///< Output file name for training examples
+    LArTrainingExampleWriter::Format m_trainingOutputFormat; ///< Output file format for training examples
     bool                  m_selectNuanceCode;             ///< Should select training events by nuance code
     int                   m_nuance;                       ///< Nuance code to select for training
     float                 m_minPurity;                    ///< Minimum purity of the best slice to use event for training
@@ -187,24 +187,25 @@ void PreProcessingAlgorithm::PopulateVoidCaloHitLists() noexcept
 
 void PreProcessingAlgorithm::GetFilteredCaloHitList(const CaloHitList &inputList, CaloHitList &outputList)
 {
-    HitKDTree2D kdTree;
     HitKDNode2DList hitKDNode2DList;
 
     KDTreeBox hitsBoundingRegion2D = fill_and_bound_2d_kd_tree(inputList, hitKDNode2DList);
-    kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
+    m_kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
 
     // Remove hits that are in the same physical location!
+    HitKDTree2D::DistanceNodeInfoVector found;
+
     for (const CaloHit *const pCaloHit1 : inputList)
     {
         bool isUnique(true);
-        KDTreeBox searchRegionHits(build_2d_kd_search_region(pCaloHit1, m_searchRegion1D, m_searchRegion1D));
+        const HitKDNode2D targetHit(pCaloHit1, pCaloHit1->GetPositionVector().GetX(), pCaloHit1->GetPositionVector().GetZ());
 
-        HitKDNode2DList found;
-        kdTree.search(searchRegionHits, found);
+        found.clear();
+        m_kdTree.searchRadius(targetHit, m_searchRegion1D, found);
 
         for (const auto &hit : found)
         {
-            const CaloHit *const pCaloHit2(hit.data);
+            const CaloHit *const pCaloHit2(hit.second->data);
 
             if (pCaloHit1 == pCaloHit2)
                 continue;
@@ -234,6 +235,8 @@ void PreProcessingAlgorithm::GetFilteredCaloHitList(const CaloHitList &inputList
                 std::cout << "PreProcessingAlgorithm: found two hits in same location, will remove lowest pulse height" << std::endl;
         }
     }
+
+    m_kdTree.clear();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
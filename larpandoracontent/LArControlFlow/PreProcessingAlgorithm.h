@@ -10,12 +10,11 @@
 
 #include "Pandora/Algorithm.h"
 
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+
 namespace lar_content
 {
 
-template<typename, unsigned int> class KDTreeLinkerAlgo;
-template<typename, unsigned int> class KDTreeNodeInfoT;
-
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 /**
@@ -62,11 +61,12 @@ private:
     void ProcessMCParticles();
 
     pandora::CaloHitSet m_processedHits;                    ///< The set of all previously processed calo hits
+    HitKDTree2D         m_kdTree;                           ///< The kd tree for hit look-up, retaining its node pool between calls
 
     float               m_mipEquivalentCut;                 ///< Minimum mip equivalent energy for calo hit
     float               m_minCellLengthScale;               ///< The minimum length scale for calo hit
     float               m_maxCellLengthScale;               ///< The maximum length scale for calo hit
-    float               m_searchRegion1D;                   ///< Search region, applied to each dimension, for look-up from kd-trees
+    float               m_searchRegion1D;                   ///< Search radius for look-up of coincident hits from kd-trees
     unsigned int        m_maxEventHits;                     ///< The maximum number of hits in an event to proceed with the reconstruction
 
     bool                m_onlyAvailableCaloHits;            ///< Whether to only include available calo hits
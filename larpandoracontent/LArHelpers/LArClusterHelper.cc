@@ -8,6 +8,8 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 
+#include "larpandoracontent/LArObjects/LArClusterHitIndex.h"
+
 #include <algorithm>
 #include <cmath>
 #include <limits>
@@ -313,6 +315,114 @@ void LArClusterHelper::GetClosestPositions(const Cluster *const pCluster1, const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+float LArClusterHelper::GetClosestDistance(const ClusterList &clusterList1, const ClusterList &clusterList2, LArClusterHitIndex &clusterHitIndex)
+{
+    if (clusterList1.empty() || clusterList2.empty())
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    float closestDistance(std::numeric_limits<float>::max());
+
+    for (const Cluster *const pCluster1 : clusterList1)
+    {
+        const float thisDistance(LArClusterHelper::GetClosestDistance(pCluster1, clusterList2, clusterHitIndex));
+
+        if (thisDistance < closestDistance)
+            closestDistance = thisDistance;
+    }
+
+    return closestDistance;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float LArClusterHelper::GetClosestDistance(const Cluster *const pCluster, const ClusterList &clusterList, LArClusterHitIndex &clusterHitIndex)
+{
+    if (clusterList.empty())
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    float closestDistance(std::numeric_limits<float>::max());
+
+    for (const Cluster *const pTestCluster : clusterList)
+    {
+        const float thisDistance(LArClusterHelper::GetClosestDistance(pCluster, pTestCluster, clusterHitIndex));
+
+        if (thisDistance < closestDistance)
+            closestDistance = thisDistance;
+    }
+
+    return closestDistance;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float LArClusterHelper::GetClosestDistance(const Cluster *const pCluster1, const Cluster *const pCluster2, LArClusterHitIndex &clusterHitIndex)
+{
+    CartesianVector closestPosition1(0.f, 0.f, 0.f);
+    CartesianVector closestPosition2(0.f, 0.f, 0.f);
+
+    LArClusterHelper::GetClosestPositions(pCluster1, pCluster2, clusterHitIndex, closestPosition1, closestPosition2);
+
+    return (closestPosition1 - closestPosition2).GetMagnitude();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float LArClusterHelper::GetClosestDistance(const CartesianVector &position, const ClusterList &clusterList, LArClusterHitIndex &clusterHitIndex)
+{
+    return (position - LArClusterHelper::GetClosestPosition(position, clusterList, clusterHitIndex)).GetMagnitude();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float LArClusterHelper::GetClosestDistance(const CartesianVector &position, const Cluster *const pCluster, LArClusterHitIndex &clusterHitIndex)
+{
+    return (position - LArClusterHelper::GetClosestPosition(position, pCluster, clusterHitIndex)).GetMagnitude();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CartesianVector LArClusterHelper::GetClosestPosition(const CartesianVector &position, const ClusterList &clusterList, LArClusterHitIndex &clusterHitIndex)
+{
+    bool distanceFound(false);
+    float closestDistanceSquared(std::numeric_limits<float>::max());
+    CartesianVector closestPosition(0.f, 0.f, 0.f);
+
+    for (const Cluster *const pTestCluster : clusterList)
+    {
+        const CartesianVector thisPosition(LArClusterHelper::GetClosestPosition(position, pTestCluster, clusterHitIndex));
+        const float thisDistanceSquared((position - thisPosition).GetMagnitudeSquared());
+
+        if (thisDistanceSquared < closestDistanceSquared)
+        {
+            distanceFound = true;
+            closestDistanceSquared = thisDistanceSquared;
+            closestPosition = thisPosition;
+        }
+    }
+
+    if (distanceFound)
+        return closestPosition;
+
+    throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CartesianVector LArClusterHelper::GetClosestPosition(const CartesianVector &position, const Cluster *const pCluster, LArClusterHitIndex &clusterHitIndex)
+{
+    return clusterHitIndex.GetClosestPosition(position, pCluster);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArClusterHelper::GetClosestPositions(const Cluster *const pCluster1, const Cluster *const pCluster2, LArClusterHitIndex &clusterHitIndex,
+    CartesianVector &outputPosition1, CartesianVector &outputPosition2)
+{
+    clusterHitIndex.GetClosestPositions(pCluster1, pCluster2, outputPosition1, outputPosition2);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void LArClusterHelper::GetClusterBoundingBox(const Cluster *const pCluster, CartesianVector &minimumCoordinate, CartesianVector &maximumCoordinate)
 {
     const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
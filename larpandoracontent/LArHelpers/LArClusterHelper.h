@@ -13,6 +13,10 @@
 namespace lar_content
 {
 
+class LArClusterHitIndex;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 /**
  *  @brief  LArClusterHelper class
  */
@@ -185,6 +189,97 @@ public:
     static void GetClosestPositions(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2,
         pandora::CartesianVector &position1, pandora::CartesianVector &position2);
 
+    /**
+     *  @brief  Get closest distance between clusters in a pair of cluster lists, using a cluster hit index for the clusters in the second list
+     *
+     *  @param  clusterList1 the first cluster list
+     *  @param  clusterList2 the second cluster list
+     *  @param  clusterHitIndex the cluster hit index
+     *
+     *  @return the closest distance
+     */
+    static float GetClosestDistance(const pandora::ClusterList &clusterList1, const pandora::ClusterList &clusterList2, LArClusterHitIndex &clusterHitIndex);
+
+    /**
+     *  @brief  Get closest distance between a specified cluster and list of clusters, using a cluster hit index for the clusters in the list
+     *
+     *  @param  pCluster address of the input cluster
+     *  @param  clusterList list of input clusters
+     *  @param  clusterHitIndex the cluster hit index
+     *
+     *  @return the closest distance
+     */
+    static float GetClosestDistance(const pandora::Cluster *const pCluster, const pandora::ClusterList &clusterList, LArClusterHitIndex &clusterHitIndex);
+
+    /**
+     *  @brief  Get closest distance between a pair of clusters, using a cluster hit index for the second cluster
+     *
+     *  @param  pCluster1 address of the first cluster
+     *  @param  pCluster2 address of the second cluster
+     *  @param  clusterHitIndex the cluster hit index
+     *
+     *  @return the closest distance
+     */
+    static float GetClosestDistance(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2, LArClusterHitIndex &clusterHitIndex);
+
+    /**
+     *  @brief  Get closest distance between a specified position and list of clusters, using a cluster hit index
+     *
+     *  @param  position the position vector
+     *  @param  clusterList list of input clusters
+     *  @param  clusterHitIndex the cluster hit index
+     *
+     *  @return the closest distance
+     */
+    static float GetClosestDistance(const pandora::CartesianVector &position, const pandora::ClusterList &clusterList, LArClusterHitIndex &clusterHitIndex);
+
+    /**
+     *  @brief  Get closest distance between a specified position vector and the hits in a specified cluster, using a cluster hit index
+     *
+     *  @param  position the position vector
+     *  @param  pCluster address of the cluster
+     *  @param  clusterHitIndex the cluster hit index
+     *
+     *  @return the closest distance
+     */
+    static float GetClosestDistance(const pandora::CartesianVector &position, const pandora::Cluster *const pCluster, LArClusterHitIndex &clusterHitIndex);
+
+    /**
+     *  @brief  Get closest position in a list of clusters to a specified input position vector, using a cluster hit index
+     *
+     *  @param  position the position vector
+     *  @param  clusterList list of input clusters
+     *  @param  clusterHitIndex the cluster hit index
+     *
+     *  @return the closest position
+     */
+    static pandora::CartesianVector GetClosestPosition(const pandora::CartesianVector &position, const pandora::ClusterList &clusterList,
+        LArClusterHitIndex &clusterHitIndex);
+
+    /**
+     *  @brief  Get closest position on a cluster to a specified input position vector, using a cluster hit index
+     *
+     *  @param  position the position vector
+     *  @param  pCluster address of the cluster
+     *  @param  clusterHitIndex the cluster hit index
+     *
+     *  @return the closest position
+     */
+    static pandora::CartesianVector GetClosestPosition(const pandora::CartesianVector &position, const pandora::Cluster *const pCluster,
+        LArClusterHitIndex &clusterHitIndex);
+
+    /**
+     *  @brief  Get pair of closest positions for a pair of clusters, using a cluster hit index for the second cluster
+     *
+     *  @param  pCluster1 the address of the first cluster
+     *  @param  pCluster2 the address of the second cluster
+     *  @param  clusterHitIndex the cluster hit index
+     *  @param  the closest position in the first cluster
+     *  @param  the closest position in the second cluster
+     */
+    static void GetClosestPositions(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2, LArClusterHitIndex &clusterHitIndex,
+        pandora::CartesianVector &position1, pandora::CartesianVector &position2);
+
     /**
      *  @brief  Get positions of the two most distant calo hits in a list of cluster (ordered by Z)
      *
@@ -19,8 +19,11 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 
+#include "larpandoracontent/LArObjects/LArDetectorGapIndex.h"
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
+#include "larpandoracontent/LArPlugins/LArRotationalTransformationPlugin.h"
+
 #include "Plugins/LArTransformationPlugin.h"
 
 using namespace pandora;
@@ -401,9 +404,22 @@ CartesianVector LArGeometryHelper::GetWireAxis(const Pandora &pandora, const Hit
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 bool LArGeometryHelper::IsInGap(const Pandora &pandora, const CartesianVector &testPoint2D, const HitType hitType, const float gapTolerance)
+{
+    return LArGeometryHelper::IsInGap(pandora, nullptr, testPoint2D, hitType, gapTolerance);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArGeometryHelper::IsInGap(const Pandora &pandora, const LArDetectorGapIndex *const pDetectorGapIndex, const CartesianVector &testPoint2D,
+    const HitType hitType, const float gapTolerance)
 {
     // ATTN: input test point MUST be a 2D position vector
-    for (const DetectorGap *const pDetectorGap : pandora.GetGeometry()->GetDetectorGapList())
+    const DetectorGapList &detectorGapList(pandora.GetGeometry()->GetDetectorGapList());
+
+    if (pDetectorGapIndex && pDetectorGapIndex->IsIndexed(detectorGapList))
+        return pDetectorGapIndex->IsInGap(testPoint2D, hitType, gapTolerance);
+
+    for (const DetectorGap *const pDetectorGap : detectorGapList)
     {
         if (pDetectorGap->IsInGap(testPoint2D, hitType, gapTolerance))
             return true;
@@ -415,15 +431,31 @@ bool LArGeometryHelper::IsInGap(const Pandora &pandora, const CartesianVector &t
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 bool LArGeometryHelper::IsInGap3D(const Pandora &pandora, const CartesianVector &testPoint3D, const HitType hitType, const float gapTolerance)
+{
+    return LArGeometryHelper::IsInGap3D(pandora, nullptr, testPoint3D, hitType, gapTolerance);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArGeometryHelper::IsInGap3D(const Pandora &pandora, const LArDetectorGapIndex *const pDetectorGapIndex, const CartesianVector &testPoint3D,
+    const HitType hitType, const float gapTolerance)
 {
     const CartesianVector testPoint2D(LArGeometryHelper::ProjectPosition(pandora, testPoint3D, hitType));
-    return LArGeometryHelper::IsInGap(pandora, testPoint2D, hitType, gapTolerance);
+    return LArGeometryHelper::IsInGap(pandora, pDetectorGapIndex, testPoint2D, hitType, gapTolerance);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 bool LArGeometryHelper::IsXSamplingPointInGap(const Pandora &pandora, const float xSample, const TwoDSlidingFitResult &slidingFitResult,
     const float gapTolerance)
+{
+    return LArGeometryHelper::IsXSamplingPointInGap(pandora, nullptr, xSample, slidingFitResult, gapTolerance);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArGeometryHelper::IsXSamplingPointInGap(const Pandora &pandora, const LArDetectorGapIndex *const pDetectorGapIndex, const float xSample,
+    const TwoDSlidingFitResult &slidingFitResult, const float gapTolerance)
 {
     const HitType hitType(LArClusterHelper::GetClusterHitType(slidingFitResult.GetCluster()));
     const CartesianVector minLayerPosition(slidingFitResult.GetGlobalMinLayerPosition());
@@ -438,7 +470,7 @@ bool LArGeometryHelper::IsXSamplingPointInGap(const Pandora &pandora, const floa
         CartesianVector slidingFitPosition(0.f, 0.f, 0.f);
 
         if (STATUS_CODE_SUCCESS == slidingFitResult.GetGlobalFitPositionAtX(xSample, slidingFitPosition))
-            return (LArGeometryHelper::IsInGap(pandora, slidingFitPosition, hitType, gapTolerance));
+            return (LArGeometryHelper::IsInGap(pandora, pDetectorGapIndex, slidingFitPosition, hitType, gapTolerance));
     }
 
     const CartesianVector lowXDirection(minLayerIsAtLowX ? slidingFitResult.GetGlobalMinLayerDirection() : slidingFitResult.GetGlobalMaxLayerDirection());
@@ -454,19 +486,32 @@ bool LArGeometryHelper::IsXSamplingPointInGap(const Pandora &pandora, const floa
     const float pathLength((xSample - startPosition.GetX()) / startDirection.GetX());
     const CartesianVector samplingPoint(startPosition + startDirection * pathLength);
 
-    return (LArGeometryHelper::IsInGap(pandora, samplingPoint, hitType, gapTolerance));
+    return (LArGeometryHelper::IsInGap(pandora, pDetectorGapIndex, samplingPoint, hitType, gapTolerance));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 float LArGeometryHelper::CalculateGapDeltaZ(const Pandora &pandora, const float minZ, const float maxZ, const HitType hitType)
+{
+    return LArGeometryHelper::CalculateGapDeltaZ(pandora, nullptr, minZ, maxZ, hitType);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float LArGeometryHelper::CalculateGapDeltaZ(const Pandora &pandora, const LArDetectorGapIndex *const pDetectorGapIndex, const float minZ,
+    const float maxZ, const HitType hitType)
 {
     if (maxZ - minZ < std::numeric_limits<float>::epsilon())
         throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
+    const DetectorGapList &detectorGapList(pandora.GetGeometry()->GetDetectorGapList());
+
+    if (pDetectorGapIndex && pDetectorGapIndex->IsIndexed(detectorGapList))
+        return pDetectorGapIndex->CalculateGapDeltaZ(minZ, maxZ, hitType);
+
     float gapDeltaZ(0.f);
 
-    for (const DetectorGap *const pDetectorGap : pandora.GetGeometry()->GetDetectorGapList())
+    for (const DetectorGap *const pDetectorGap : detectorGapList)
     {
         const LineGap *const pLineGap = dynamic_cast<const LineGap*>(pDetectorGap);
 
@@ -524,4 +569,14 @@ float LArGeometryHelper::GetSigmaUVW(const Pandora &pandora, const float maxSigm
     return sigmaUVW;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const LArRotationalTransformation *LArGeometryHelper::GetRotationalTransformation(const Pandora &pandora)
+{
+    const LArRotationalTransformationPlugin *const pRotationalPlugin(
+        dynamic_cast<const LArRotationalTransformationPlugin*>(pandora.GetPlugins()->GetLArTransformationPlugin()));
+
+    return (pRotationalPlugin ? &(pRotationalPlugin->GetTransformation()) : nullptr);
+}
+
 } // namespace lar_content
@@ -18,6 +18,8 @@ namespace pandora {class CartesianVector; class Pandora;}
 namespace lar_content
 {
 
+class LArDetectorGapIndex;
+class LArRotationalTransformation;
 class TwoDSlidingFitResult;
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -210,6 +212,21 @@ public:
     static bool IsInGap(const pandora::Pandora &pandora, const pandora::CartesianVector &testPoint2D, const pandora::HitType hitType,
         const float gapTolerance = 0.f);
 
+    /**
+     *  @brief  Whether a 2D test point lies in a registered gap with the associated hit type, using a detector gap index if it describes the
+     *          current detector gap list
+     *
+     *  @param  pandora the associated pandora instance
+     *  @param  pDetectorGapIndex address of the detector gap index, or nullptr to examine all registered gaps
+     *  @param  testPoint the test point
+     *  @param  hitType the hit type
+     *  @param  gapTolerance the gap tolerance
+     *
+     *  @return boolean
+     */
+    static bool IsInGap(const pandora::Pandora &pandora, const LArDetectorGapIndex *const pDetectorGapIndex, const pandora::CartesianVector &testPoint2D,
+        const pandora::HitType hitType, const float gapTolerance = 0.f);
+
     /**
      *  @brief  Whether a 3D test point lies in a registered gap with the associated hit type
      *
@@ -223,6 +240,21 @@ public:
     static bool IsInGap3D(const pandora::Pandora &pandora, const pandora::CartesianVector &testPoint3D, const pandora::HitType hitType,
         const float gapTolerance = 0.f);
 
+    /**
+     *  @brief  Whether a 3D test point lies in a registered gap with the associated hit type, using a detector gap index if it describes the
+     *          current detector gap list
+     *
+     *  @param  pandora the associated pandora instance
+     *  @param  pDetectorGapIndex address of the detector gap index, or nullptr to examine all registered gaps
+     *  @param  testPoint the test point
+     *  @param  hitType the hit type
+     *  @param  gapTolerance the gap tolerance
+     *
+     *  @return boolean
+     */
+    static bool IsInGap3D(const pandora::Pandora &pandora, const LArDetectorGapIndex *const pDetectorGapIndex,
+        const pandora::CartesianVector &testPoint3D, const pandora::HitType hitType, const float gapTolerance = 0.f);
+
     /**
      *  @brief  Whether there is a gap in a cluster (described via its sliding fit result) at a specified x sampling position
      *
@@ -236,6 +268,21 @@ public:
     static bool IsXSamplingPointInGap(const pandora::Pandora &pandora, const float xSample, const TwoDSlidingFitResult &slidingFitResult,
         const float gapTolerance = 0.f);
 
+    /**
+     *  @brief  Whether there is a gap in a cluster (described via its sliding fit result) at a specified x sampling position, using a detector
+     *          gap index if it describes the current detector gap list
+     *
+     *  @param  pandora the associated pandora instance
+     *  @param  pDetectorGapIndex address of the detector gap index, or nullptr to examine all registered gaps
+     *  @param  xSample the x sampling position
+     *  @param  slidingFitResult the sliding fit result for a cluster
+     *  @param  gapTolerance the gap tolerance
+     *
+     *  @return boolean
+     */
+    static bool IsXSamplingPointInGap(const pandora::Pandora &pandora, const LArDetectorGapIndex *const pDetectorGapIndex, const float xSample,
+        const TwoDSlidingFitResult &slidingFitResult, const float gapTolerance = 0.f);
+
     /**
      *  @brief  Calculate the total distance within a given 2D region that is composed of detector gaps
      *
@@ -246,6 +293,19 @@ public:
      */
     static float CalculateGapDeltaZ(const pandora::Pandora &pandora, const float minZ, const float maxZ, const pandora::HitType hitType);
 
+    /**
+     *  @brief  Calculate the total distance within a given 2D region that is composed of detector gaps, using a detector gap index if it
+     *          describes the current detector gap list
+     *
+     *  @param  pandora the associated pandora instance
+     *  @param  pDetectorGapIndex address of the detector gap index, or nullptr to examine all registered gaps
+     *  @param  minZ the start position in Z
+     *  @param  maxZ the end position in Z
+     *  @param  hitType the hit type
+     */
+    static float CalculateGapDeltaZ(const pandora::Pandora &pandora, const LArDetectorGapIndex *const pDetectorGapIndex, const float minZ,
+        const float maxZ, const pandora::HitType hitType);
+
     /**
      *  @brief  Find the sigmaUVW value for the detector geometry
      *
@@ -253,6 +313,17 @@ public:
      *  @param  maxSigmaDiscrepancy maximum allowed discrepancy between lar tpc sigmaUVW values
      */
     static float GetSigmaUVW(const pandora::Pandora &pandora, const float maxSigmaDiscrepancy = 0.01);
+
+    /**
+     *  @brief  Get the value-type snapshot of the coordinate transformation, if the registered transformation plugin is the rotational
+     *          transformation plugin. The snapshot provides inlinable and batched transformations, avoiding virtual plugin calls. The
+     *          address is fixed for the lifetime of the plugin, so clients should look it up once (e.g. in Initialize) and cache it.
+     *
+     *  @param  pandora the associated pandora instance
+     *
+     *  @return address of the rotational transformation, or nullptr if a different transformation plugin is registered
+     */
+    static const LArRotationalTransformation *GetRotationalTransformation(const pandora::Pandora &pandora);
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -22,6 +22,7 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <unordered_set>
 
 namespace lar_content
 {
@@ -542,55 +543,108 @@ void LArMCParticleHelper::GetTestBeamHierarchyPfoToReconstructable2DHitsMap(cons
 void LArMCParticleHelper::GetPfoMCParticleHitSharingMaps(const PfoContributionMap &pfoToReconstructable2DHitsMap, const MCContributionMapVector &selectedMCParticleToHitsMaps,
     PfoToMCParticleHitSharingMap &pfoToMCParticleHitSharingMap, MCParticleToPfoHitSharingMap &mcParticleToPfoHitSharingMap)
 {
+    typedef std::vector<unsigned int> MCEntryIndexVector;
+    typedef std::unordered_map<const CaloHit*, MCEntryIndexVector> CaloHitToMCEntryIndicesMap;
+
+    // Index each mc particle entry, in input map order then address order, and each hit to the entries whose hit lists contain it
+    MCParticleVector mcEntryParticles;
+    CaloHitToMCEntryIndicesMap caloHitToMCEntryIndicesMap;
+
+    for (const MCContributionMap &mcParticleToHitsMap : selectedMCParticleToHitsMaps)
+    {
+        MCParticleVector sortedMCParticles;
+        for (const auto &mapEntry : mcParticleToHitsMap) sortedMCParticles.push_back(mapEntry.first);
+        std::sort(sortedMCParticles.begin(), sortedMCParticles.end(), PointerLessThan<MCParticle>());
+
+        for (const MCParticle *const pMCParticle : sortedMCParticles)
+        {
+            const unsigned int mcEntryIndex(mcEntryParticles.size());
+            mcEntryParticles.push_back(pMCParticle);
+
+            for (const CaloHit *const pCaloHit : mcParticleToHitsMap.at(pMCParticle))
+            {
+                MCEntryIndexVector &mcEntryIndices(caloHitToMCEntryIndicesMap[pCaloHit]);
+
+                if (mcEntryIndices.empty() || (mcEntryIndices.back() != mcEntryIndex))
+                    mcEntryIndices.push_back(mcEntryIndex);
+            }
+        }
+    }
+
+    // ATTN An mc particle may appear in more than one input map, which is only an error if it shares hits with a pfo via an earlier map entry
+    std::vector<bool> mcEntryHasLaterEntry(mcEntryParticles.size(), false);
+    std::unordered_set<const MCParticle*> laterMCParticles;
+
+    for (unsigned int mcEntryIndex = mcEntryParticles.size(); mcEntryIndex > 0; --mcEntryIndex)
+    {
+        mcEntryHasLaterEntry.at(mcEntryIndex - 1) = (laterMCParticles.count(mcEntryParticles.at(mcEntryIndex - 1)) > 0);
+        laterMCParticles.insert(mcEntryParticles.at(mcEntryIndex - 1));
+    }
+
+    // Every pfo and every mc particle receives a map entry, provided there is at least one of the other
+    if (mcEntryParticles.empty() || pfoToReconstructable2DHitsMap.empty())
+        return;
+
+    for (const auto &mapEntry : pfoToReconstructable2DHitsMap)
+        (void) pfoToMCParticleHitSharingMap.insert(PfoToMCParticleHitSharingMap::value_type(mapEntry.first, MCParticleToSharedHitsVector()));
+
+    for (const MCParticle *const pMCParticle : mcEntryParticles)
+        (void) mcParticleToPfoHitSharingMap.insert(MCParticleToPfoHitSharingMap::value_type(pMCParticle, PfoToSharedHitsVector()));
+
     PfoVector sortedPfos;
     for (const auto &mapEntry : pfoToReconstructable2DHitsMap) sortedPfos.push_back(mapEntry.first);
     std::sort(sortedPfos.begin(), sortedPfos.end(), LArPfoHelper::SortByNHits);
 
+    std::vector<CaloHitList> mcEntrySharedHits(mcEntryParticles.size());
+    MCEntryIndexVector sharingMCEntryIndices;
+
     for (const ParticleFlowObject *const pPfo : sortedPfos)
     {
-        for (const MCContributionMap &mcParticleToHitsMap : selectedMCParticleToHitsMaps)
+        // Collect the shared hits for each mc particle entry, in pfo hit list order
+        for (const CaloHit *const pCaloHit : pfoToReconstructable2DHitsMap.at(pPfo))
         {
-            MCParticleVector sortedMCParticles;
-            for (const auto &mapEntry : mcParticleToHitsMap) sortedMCParticles.push_back(mapEntry.first);
-            std::sort(sortedMCParticles.begin(), sortedMCParticles.end(), PointerLessThan<MCParticle>());
+            CaloHitToMCEntryIndicesMap::const_iterator indicesIter(caloHitToMCEntryIndicesMap.find(pCaloHit));
+
+            if (caloHitToMCEntryIndicesMap.end() == indicesIter)
+                continue;
 
-            for (const MCParticle *const pMCParticle : sortedMCParticles)
+            for (const unsigned int mcEntryIndex : indicesIter->second)
             {
-                // Add map entries for this Pfo & MCParticle if required
-                if (pfoToMCParticleHitSharingMap.find(pPfo) == pfoToMCParticleHitSharingMap.end())
-                    if (!pfoToMCParticleHitSharingMap.insert(PfoToMCParticleHitSharingMap::value_type(pPfo, MCParticleToSharedHitsVector())).second)
-                        throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT); // ATTN maybe overkill
+                if (mcEntrySharedHits.at(mcEntryIndex).empty())
+                    sharingMCEntryIndices.push_back(mcEntryIndex);
 
-                if (mcParticleToPfoHitSharingMap.find(pMCParticle) == mcParticleToPfoHitSharingMap.end())
-                    if (!mcParticleToPfoHitSharingMap.insert(MCParticleToPfoHitSharingMap::value_type(pMCParticle, PfoToSharedHitsVector())).second)
-                        throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
+                mcEntrySharedHits.at(mcEntryIndex).push_back(pCaloHit);
+            }
+        }
 
-                // Check this Pfo & MCParticle pairing hasn't already been checked
-                MCParticleToSharedHitsVector &mcHitPairs(pfoToMCParticleHitSharingMap.at(pPfo));
-                PfoToSharedHitsVector &pfoHitPairs(mcParticleToPfoHitSharingMap.at(pMCParticle));
+        // Add records to maps in the order in which mc particle entries are indexed, re-sorting after each addition as before
+        std::sort(sharingMCEntryIndices.begin(), sharingMCEntryIndices.end());
 
-                if (std::any_of(mcHitPairs.begin(), mcHitPairs.end(), [&] (const MCParticleCaloHitListPair &pair) { return (pair.first == pMCParticle); }))
-                    throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
+        MCParticleToSharedHitsVector &mcHitPairs(pfoToMCParticleHitSharingMap.at(pPfo));
 
-                if (std::any_of(pfoHitPairs.begin(), pfoHitPairs.end(), [&] (const PfoCaloHitListPair &pair) { return (pair.first == pPfo); }))
-                    throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
+        for (const unsigned int mcEntryIndex : sharingMCEntryIndices)
+        {
+            if (mcEntryHasLaterEntry.at(mcEntryIndex))
+                throw StatusCodeException(STATUS_CODE_ALREADY_PRESENT);
 
-                // Add records to maps if there are any shared hits
-                const CaloHitList sharedHits(LArMCParticleHelper::GetSharedHits(pfoToReconstructable2DHitsMap.at(pPfo), mcParticleToHitsMap.at(pMCParticle)));
+            const MCParticle *const pMCParticle(mcEntryParticles.at(mcEntryIndex));
+            PfoToSharedHitsVector &pfoHitPairs(mcParticleToPfoHitSharingMap.at(pMCParticle));
+            const CaloHitList &sharedHits(mcEntrySharedHits.at(mcEntryIndex));
 
-                if (!sharedHits.empty())
-                {
-                    mcHitPairs.push_back(MCParticleCaloHitListPair(pMCParticle, sharedHits));
-                    pfoHitPairs.push_back(PfoCaloHitListPair(pPfo, sharedHits));
+            mcHitPairs.push_back(MCParticleCaloHitListPair(pMCParticle, sharedHits));
+            pfoHitPairs.push_back(PfoCaloHitListPair(pPfo, sharedHits));
 
-                    std::sort(mcHitPairs.begin(), mcHitPairs.end(), [] (const MCParticleCaloHitListPair &a, const MCParticleCaloHitListPair &b) -> bool {
-                        return ((a.second.size() != b.second.size()) ? a.second.size() > b.second.size() : LArMCParticleHelper::SortByMomentum(a.first, b.first)); });
+            std::sort(mcHitPairs.begin(), mcHitPairs.end(), [] (const MCParticleCaloHitListPair &a, const MCParticleCaloHitListPair &b) -> bool {
+                return ((a.second.size() != b.second.size()) ? a.second.size() > b.second.size() : LArMCParticleHelper::SortByMomentum(a.first, b.first)); });
 
-                    std::sort(pfoHitPairs.begin(), pfoHitPairs.end(), [] (const PfoCaloHitListPair &a, const PfoCaloHitListPair &b) -> bool {
-                        return ((a.second.size() != b.second.size()) ? a.second.size() > b.second.size() : LArPfoHelper::SortByNHits(a.first, b.first)); });
-                }
-            }
+            std::sort(pfoHitPairs.begin(), pfoHitPairs.end(), [] (const PfoCaloHitListPair &a, const PfoCaloHitListPair &b) -> bool {
+                return ((a.second.size() != b.second.size()) ? a.second.size() > b.second.size() : LArPfoHelper::SortByNHits(a.first, b.first)); });
         }
+
+        for (const unsigned int mcEntryIndex : sharingMCEntryIndices)
+            mcEntrySharedHits.at(mcEntryIndex).clear();
+
+        sharingMCEntryIndices.clear();
     }
 }
 
@@ -828,19 +882,4 @@ bool LArMCParticleHelper::PassMCParticleChecks(const MCParticle *const pOriginal
     return false;
 }
 
-//------------------------------------------------------------------------------------------------------------------------------------------
-
-CaloHitList LArMCParticleHelper::GetSharedHits(const CaloHitList &hitListA, const CaloHitList &hitListB)
-{
-    CaloHitList sharedHits;
-
-    for (const CaloHit *const pCaloHit : hitListA)
-    {
-        if (std::find(hitListB.begin(), hitListB.end(), pCaloHit) != hitListB.end())
-            sharedHits.push_back(pCaloHit);
-    }
-
-    return sharedHits;
-}
-
 } // namespace lar_content
@@ -413,16 +413,6 @@ private:
      */
     static bool PassMCParticleChecks(const pandora::MCParticle *const pOriginalPrimary, const pandora::MCParticle *const pThisMCParticle,
         const pandora::MCParticle *const pHitMCParticle, const float maxPhotonPropagation);
-
-    /**
-     *  @brief  Get the hits in the intersection of two hit lists
-     *
-     *  @param  hitListA an input hit list
-     *  @param  hitListB another input hit list
-     *
-     *  @return The hits that are found in both hitListA and hitListB
-     */
-    static pandora::CaloHitList GetSharedHits(const pandora::CaloHitList &hitListA, const pandora::CaloHitList &hitListB);
 };
 
 } // namespace lar_content
@@ -0,0 +1,37 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArMultiThreadingHelper.cc
+ *
+ *  @brief  Implementation of the multi threading helper class.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArHelpers/LArMultiThreadingHelper.h"
+
+#include <algorithm>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+unsigned int LArMultiThreadingHelper::GetNThreads(const unsigned int nRequestedThreads, const unsigned int nTasks)
+{
+    if (LArMultiThreadingHelper::IsPoolThread())
+        return 1;
+
+    const unsigned int nHardwareThreads(std::max(1u, std::thread::hardware_concurrency()));
+    const unsigned int nThreads((0 == nRequestedThreads) ? nHardwareThreads : nRequestedThreads);
+
+    return std::max(1u, std::min(nThreads, nTasks));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool &LArMultiThreadingHelper::IsPoolThread()
+{
+    thread_local bool isPoolThread(false);
+    return isPoolThread;
+}
+
+} // namespace lar_content
@@ -0,0 +1,134 @@
+/**
+ *  @file   larpandoracontent/LArHelpers/LArMultiThreadingHelper.h
+ *
+ *  @brief  Header file for the multi threading helper class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_MULTI_THREADING_HELPER_H
+#define LAR_MULTI_THREADING_HELPER_H 1
+
+#include "Pandora/StatusCodes.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArMultiThreadingHelper class
+ */
+class LArMultiThreadingHelper
+{
+public:
+    /**
+     *  @brief  Get the number of threads to use for a given number of independent tasks. Within a task already running on a pool thread
+     *          (e.g. in a worker instance run concurrently by the master algorithm), nested levels are serialised, rather than oversubscribe cores.
+     *
+     *  @param  nRequestedThreads the requested number of threads (zero indicates one thread per available hardware core)
+     *  @param  nTasks the number of independent tasks
+     *
+     *  @return the number of threads
+     */
+    static unsigned int GetNThreads(const unsigned int nRequestedThreads, const unsigned int nTasks);
+
+    /**
+     *  @brief  Run a number of independent tasks, each identified by its index, on a pool of threads. Tasks are claimed by threads in
+     *          index order. Exceptions are caught within each task, and the first failure (in task index order, not time order) is reported.
+     *
+     *  @param  nTasks the number of tasks
+     *  @param  nThreads the number of threads; if one or fewer, all tasks are run in the calling thread
+     *  @param  task the task functor, callable with signature pandora::StatusCode(unsigned int taskIndex)
+     *
+     *  @return the status code of the first failed task, in task index order, or success
+     */
+    template <typename TASK>
+    static pandora::StatusCode RunTasks(const unsigned int nTasks, const unsigned int nThreads, const TASK &task);
+
+private:
+    /**
+     *  @brief  Get the flag indicating whether the calling thread is a pool thread, created by RunTasks
+     *
+     *  @return the address of the thread-local flag
+     */
+    static bool &IsPoolThread();
+
+    /**
+     *  @brief  Run a single task, converting any exception into a status code
+     *
+     *  @param  taskIndex the task index
+     *  @param  task the task functor
+     *
+     *  @return the status code
+     */
+    template <typename TASK>
+    static pandora::StatusCode RunTask(const unsigned int taskIndex, const TASK &task);
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename TASK>
+pandora::StatusCode LArMultiThreadingHelper::RunTasks(const unsigned int nTasks, const unsigned int nThreads, const TASK &task)
+{
+    std::vector<pandora::StatusCode> statusCodes(nTasks, pandora::STATUS_CODE_SUCCESS);
+
+    if ((nThreads <= 1) || (nTasks <= 1))
+    {
+        for (unsigned int taskIndex = 0; taskIndex < nTasks; ++taskIndex)
+            statusCodes.at(taskIndex) = LArMultiThreadingHelper::RunTask(taskIndex, task);
+    }
+    else
+    {
+        std::atomic<unsigned int> nextTaskIndex(0);
+
+        auto threadFunction = [&]()
+        {
+            LArMultiThreadingHelper::IsPoolThread() = true;
+
+            for (unsigned int taskIndex = nextTaskIndex++; taskIndex < nTasks; taskIndex = nextTaskIndex++)
+                statusCodes[taskIndex] = LArMultiThreadingHelper::RunTask(taskIndex, task);
+        };
+
+        std::vector<std::thread> threads;
+
+        for (unsigned int iThread = 0; iThread < std::min(nThreads, nTasks); ++iThread)
+            threads.emplace_back(threadFunction);
+
+        for (std::thread &thread : threads)
+            thread.join();
+    }
+
+    for (const pandora::StatusCode statusCode : statusCodes)
+    {
+        if (pandora::STATUS_CODE_SUCCESS != statusCode)
+            return statusCode;
+    }
+
+    return pandora::STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename TASK>
+pandora::StatusCode LArMultiThreadingHelper::RunTask(const unsigned int taskIndex, const TASK &task)
+{
+    try
+    {
+        return task(taskIndex);
+    }
+    catch (const pandora::StatusCodeException &statusCodeException)
+    {
+        return statusCodeException.GetStatusCode();
+    }
+    catch (...)
+    {
+        return pandora::STATUS_CODE_FAILURE;
+    }
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_MULTI_THREADING_HELPER_H
@@ -9,11 +9,11 @@
 #define LAR_MVA_HELPER_H 1
 
 #include "larpandoracontent/LArObjects/LArMvaInterface.h"
+#include "larpandoracontent/LArObjects/LArTrainingExampleFile.h"
 
 #include "Pandora/AlgorithmTool.h"
 #include "Pandora/StatusCodes.h"
 
-#include <fstream>
 #include <chrono>
 #include <ctime>
 
@@ -58,9 +58,10 @@ public:
     typedef MvaTypes::MvaFeatureVector MvaFeatureVector;
 
     /**
-     *  @brief  Produce a training example with the given features and result
+     *  @brief  Produce a training example with the given features and result, in the text format
      *
      *  @param  trainingOutputFile the file to which to append the example
+     *  @param  result the result (class) of the example
      *  @param  featureLists the lists of features
      *
      *  @return success
@@ -68,6 +69,21 @@ public:
     template <typename ...TLISTS>
     static pandora::StatusCode ProduceTrainingExample(const std::string &trainingOutputFile, const bool result, TLISTS &&... featureLists);
 
+    /**
+     *  @brief  Produce a training example with the given features and result, in a given format. The example is buffered by a persistent
+     *          writer for the output file, see LArTrainingExampleWriter, and may be read back with LArTrainingExampleReader.
+     *
+     *  @param  trainingOutputFile the file to which to append the example
+     *  @param  format the format of the output file
+     *  @param  result the result (class) of the example
+     *  @param  featureLists the lists of features
+     *
+     *  @return success
+     */
+    template <typename ...TLISTS>
+    static pandora::StatusCode ProduceTrainingExample(const std::string &trainingOutputFile, const LArTrainingExampleWriter::Format format,
+        const bool result, TLISTS &&... featureLists);
+
     /**
      *  @brief  Use the trained classifier to predict the boolean class of an example
      *
@@ -135,45 +151,6 @@ public:
     static pandora::StatusCode AddFeatureToolToVector(pandora::AlgorithmTool *const pFeatureTool, MvaFeatureToolVector<Ts...> &featureToolVector);
 
 private:
-    /**
-     *  @brief  Get a timestamp string for this point in time
-     *
-     *  @return a timestamp string
-     */
-    static std::string GetTimestampString();
-
-    /**
-     *  @brief  Recursively write the features of the given lists to file
-     *
-     *  @param  outfile the std::ofstream object to use
-     *  @param  delimiter the delimiter string
-     *  @param  featureList a list of features to write
-     *  @param  featureLists optional further lists of features to write
-     *
-     *  @return success
-     */
-    template <typename TLIST, typename ...TLISTS>
-    static pandora::StatusCode WriteFeaturesToFile(std::ofstream &outfile, const std::string &delimiter, TLIST &&featureList, TLISTS &&... featureLists);
-
-    /**
-     *  @brief  Recursively write the features of the given lists to file (terminating method)
-     *
-     *  @return success
-     */
-    static pandora::StatusCode WriteFeaturesToFile(std::ofstream &, const std::string &);
-
-    /**
-     *  @brief  Write the features of the given list to file (implementation method)
-     *
-     *  @param  outfile the std::ofstream object to use
-     *  @param  delimiter the delimiter string
-     *  @param  featureList a list of features to write
-     *
-     *  @return success
-     */
-    template <typename TLIST>
-    static pandora::StatusCode WriteFeaturesToFileImpl(std::ofstream &outfile, const std::string &delimiter, TLIST &&featureList);
-
     /**
      *  @brief  Recursively concatenate vectors of features
      *
@@ -196,22 +173,19 @@ private:
 template <typename ...TLISTS>
 pandora::StatusCode LArMvaHelper::ProduceTrainingExample(const std::string &trainingOutputFile, const bool result, TLISTS &&... featureLists)
 {
-    std::ofstream outfile;
-    outfile.open(trainingOutputFile, std::ios_base::app); // always append to the output file
-
-    if (!outfile.is_open())
-    {
-        std::cout << "LArMvaHelper: could not open file for training examples at " << trainingOutputFile << std::endl;
-        return pandora::STATUS_CODE_FAILURE;
-    }
+    return LArMvaHelper::ProduceTrainingExample(trainingOutputFile, LArTrainingExampleWriter::TEXT, result, std::forward<TLISTS>(featureLists)...);
+}
 
-    std::string delimiter(",");
-    outfile << GetTimestampString() << delimiter;
+//------------------------------------------------------------------------------------------------------------------------------------------
 
-    PANDORA_RETURN_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, WriteFeaturesToFile(outfile, delimiter, featureLists...));
-    outfile << static_cast<int>(result) << '\n';
+template <typename ...TLISTS>
+pandora::StatusCode LArMvaHelper::ProduceTrainingExample(const std::string &trainingOutputFile, const LArTrainingExampleWriter::Format format,
+    const bool result, TLISTS &&... featureLists)
+{
+    const std::time_t timestamp(std::chrono::system_clock::to_time_t(std::chrono::system_clock::now()));
 
-    return pandora::STATUS_CODE_SUCCESS;
+    return LArTrainingExampleWriter::WriteExample(trainingOutputFile, format, timestamp, result,
+        ConcatenateFeatureLists(std::forward<TLISTS>(featureLists)...));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -284,56 +258,6 @@ pandora::StatusCode LArMvaHelper::AddFeatureToolToVector(pandora::AlgorithmTool
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-inline std::string LArMvaHelper::GetTimestampString()
-{
-    std::time_t timestampNow = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
-
-    struct tm *pTimeInfo(NULL);
-    char buffer[80];
-
-    pTimeInfo = localtime(&timestampNow);
-    strftime(buffer, 80, "%x_%X", pTimeInfo);
-
-    std::string timeString(buffer);
-
-    if (!timeString.empty() && timeString.back() == '\n') // last char is always a newline
-        timeString.pop_back();
-
-    return timeString;
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
-template <typename TLIST, typename ...TLISTS>
-inline pandora::StatusCode LArMvaHelper::WriteFeaturesToFile(std::ofstream &outfile, const std::string &delimiter, TLIST &&featureList, TLISTS &&... featureLists)
-{
-    static_assert(std::is_same<typename std::decay<TLIST>::type, LArMvaHelper::MvaFeatureVector>::value,
-        "LArMvaHelper: Could not write training set example because a passed parameter was not a vector of MvaFeatures");
-
-    PANDORA_RETURN_RESULT_IF(pandora::STATUS_CODE_SUCCESS, !=, WriteFeaturesToFileImpl(outfile, delimiter, featureList));
-    return WriteFeaturesToFile(outfile, delimiter, featureLists...);
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
-inline pandora::StatusCode LArMvaHelper::WriteFeaturesToFile(std::ofstream &, const std::string &)
-{
-    return pandora::STATUS_CODE_SUCCESS;
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
-template <typename TLIST>
-pandora::StatusCode LArMvaHelper::WriteFeaturesToFileImpl(std::ofstream &outfile, const std::string &delimiter, TLIST &&featureList)
-{
-    for (const MvaFeature feature : featureList)
-        outfile << feature.Get() << delimiter;
-
-    return pandora::STATUS_CODE_SUCCESS;
-}
-
-//------------------------------------------------------------------------------------------------------------------------------------------
-
 template <typename TLIST, typename ...TLISTS>
 LArMvaHelper::MvaFeatureVector LArMvaHelper::ConcatenateFeatureLists(TLIST &&featureList, TLISTS &&... featureLists)
 {
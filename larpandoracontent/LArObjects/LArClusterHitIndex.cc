@@ -0,0 +1,201 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArClusterHitIndex.cc
+ *
+ *  @brief  Implementation of the lar cluster hit index class.
+ *
+ *  $Log: $
+ */
+
+#include "Objects/CaloHit.h"
+#include "Objects/Cluster.h"
+
+#include "larpandoracontent/LArObjects/LArClusterHitIndex.h"
+
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+/**
+ *  @brief  ClusterEntry class, holding the calo hits of a cluster in ordered calo hit list order and a kd tree of their indices
+ */
+class LArClusterHitIndex::ClusterEntry
+{
+public:
+    typedef KDTreeLinkerAlgo<unsigned int, 3> IndexKDTree3D;
+    typedef KDTreeNodeInfoT<unsigned int, 3> IndexKDNode3D;
+    typedef std::vector<IndexKDNode3D> IndexKDNode3DList;
+    typedef IndexKDTree3D::DistanceNodeInfoVector DistanceNodeInfoVector;
+
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  pCluster address of the cluster
+     */
+    ClusterEntry(const Cluster *const pCluster);
+
+    CaloHitVector           m_caloHitVector;    ///< The calo hits, in ordered calo hit list order
+    IndexKDTree3D           m_kdTree;           ///< The kd tree of calo hit indices
+    DistanceNodeInfoVector  m_found;            ///< Reusable storage for kd tree query results
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArClusterHitIndex::ClusterEntry::ClusterEntry(const Cluster *const pCluster)
+{
+    IndexKDNode3DList hitKDNode3DList;
+    float minX(std::numeric_limits<float>::max()), maxX(-std::numeric_limits<float>::max());
+    float minY(std::numeric_limits<float>::max()), maxY(-std::numeric_limits<float>::max());
+    float minZ(std::numeric_limits<float>::max()), maxZ(-std::numeric_limits<float>::max());
+
+    for (const OrderedCaloHitList::value_type &layerEntry : pCluster->GetOrderedCaloHitList())
+    {
+        for (const CaloHit *const pCaloHit : *layerEntry.second)
+        {
+            const CartesianVector &position(pCaloHit->GetPositionVector());
+            hitKDNode3DList.emplace_back(static_cast<unsigned int>(m_caloHitVector.size()), position.GetX(), position.GetY(), position.GetZ());
+            m_caloHitVector.push_back(pCaloHit);
+
+            minX = std::min(minX, position.GetX()); maxX = std::max(maxX, position.GetX());
+            minY = std::min(minY, position.GetY()); maxY = std::max(maxY, position.GetY());
+            minZ = std::min(minZ, position.GetZ()); maxZ = std::max(maxZ, position.GetZ());
+        }
+    }
+
+    if (!hitKDNode3DList.empty())
+        m_kdTree.build(hitKDNode3DList, KDTreeCube(minX, maxX, minY, maxY, minZ, maxZ));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArClusterHitIndex::LArClusterHitIndex()
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArClusterHitIndex::~LArClusterHitIndex()
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CartesianVector LArClusterHitIndex::GetClosestPosition(const CartesianVector &position, const Cluster *const pCluster)
+{
+    ClusterEntry &clusterEntry(this->GetClusterEntry(pCluster));
+
+    unsigned int closestHitIndex(0);
+    float closestDistanceSquared(std::numeric_limits<float>::max());
+    LArClusterHitIndex::FindClosestHit(clusterEntry, position, closestHitIndex, closestDistanceSquared);
+
+    return clusterEntry.m_caloHitVector.at(closestHitIndex)->GetPositionVector();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArClusterHitIndex::GetClosestPositions(const Cluster *const pCluster1, const Cluster *const pCluster2, CartesianVector &position1,
+    CartesianVector &position2)
+{
+    ClusterEntry &clusterEntry2(this->GetClusterEntry(pCluster2));
+
+    bool distanceFound(false);
+    float minDistanceSquared(std::numeric_limits<float>::max());
+
+    const CaloHit *pClosestCaloHit1(nullptr), *pClosestCaloHit2(nullptr);
+
+    // ATTN Strict comparison, with hits in cluster 1 visited in ordered calo hit list order, reproduces the exhaustive pairwise search
+    for (const OrderedCaloHitList::value_type &layerEntry : pCluster1->GetOrderedCaloHitList())
+    {
+        for (const CaloHit *const pCaloHit1 : *layerEntry.second)
+        {
+            unsigned int closestHitIndex(0);
+            float closestDistanceSquared(std::numeric_limits<float>::max());
+            LArClusterHitIndex::FindClosestHit(clusterEntry2, pCaloHit1->GetPositionVector(), closestHitIndex, closestDistanceSquared);
+
+            if (closestDistanceSquared < minDistanceSquared)
+            {
+                minDistanceSquared = closestDistanceSquared;
+                pClosestCaloHit1 = pCaloHit1;
+                pClosestCaloHit2 = clusterEntry2.m_caloHitVector.at(closestHitIndex);
+                distanceFound = true;
+            }
+        }
+    }
+
+    if (!distanceFound)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    position1 = pClosestCaloHit1->GetPositionVector();
+    position2 = pClosestCaloHit2->GetPositionVector();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArClusterHitIndex::Invalidate(const Cluster *const pCluster)
+{
+    m_clusterEntryMap.erase(pCluster);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArClusterHitIndex::Clear()
+{
+    m_clusterEntryMap.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArClusterHitIndex::ClusterEntry &LArClusterHitIndex::GetClusterEntry(const Cluster *const pCluster)
+{
+    std::unique_ptr<ClusterEntry> &pClusterEntry(m_clusterEntryMap[pCluster]);
+
+    if (!pClusterEntry)
+        pClusterEntry.reset(new ClusterEntry(pCluster));
+
+    return *pClusterEntry;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArClusterHitIndex::FindClosestHit(ClusterEntry &clusterEntry, const CartesianVector &position, unsigned int &closestHitIndex,
+    float &closestDistanceSquared)
+{
+    const ClusterEntry::IndexKDNode3D point(0, position.GetX(), position.GetY(), position.GetZ());
+    clusterEntry.m_kdTree.findKNearestNeighbours(point, 1, clusterEntry.m_found);
+
+    if (clusterEntry.m_found.empty())
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    // ATTN Collect all hits that could be equidistant under exact arithmetic, then choose as the exhaustive search would
+    const float searchRadius(clusterEntry.m_found.front().first * (1.f + 10.f * std::numeric_limits<float>::epsilon()) + std::numeric_limits<float>::epsilon());
+    clusterEntry.m_found.clear();
+    clusterEntry.m_kdTree.searchRadius(point, searchRadius, clusterEntry.m_found);
+
+    bool distanceFound(false);
+    closestDistanceSquared = std::numeric_limits<float>::max();
+
+    for (const ClusterEntry::IndexKDTree3D::DistanceNodeInfoPair &distanceNodeInfo : clusterEntry.m_found)
+    {
+        const unsigned int hitIndex(distanceNodeInfo.second->data);
+        const float distanceSquared((clusterEntry.m_caloHitVector.at(hitIndex)->GetPositionVector() - position).GetMagnitudeSquared());
+
+        if ((distanceSquared < closestDistanceSquared) || (distanceFound && (distanceSquared == closestDistanceSquared) && (hitIndex < closestHitIndex)))
+        {
+            closestHitIndex = hitIndex;
+            closestDistanceSquared = distanceSquared;
+            distanceFound = true;
+        }
+    }
+
+    if (!distanceFound)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+}
+
+} // namespace lar_content
@@ -0,0 +1,106 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArClusterHitIndex.h
+ *
+ *  @brief  Header file for the lar cluster hit index class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_CLUSTER_HIT_INDEX_H
+#define LAR_CLUSTER_HIT_INDEX_H 1
+
+#include "Objects/CartesianVector.h"
+
+#include "Pandora/PandoraInternal.h"
+
+#include <memory>
+#include <unordered_map>
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArClusterHitIndex class, a lazily-built spatial index of the calo hits in each queried cluster, for closest approach queries.
+ *          Results, including the choice between equidistant hits, are identical to the exhaustive searches in LArClusterHelper.
+ *          An index entry is built when its cluster is first queried and is not checked against the cluster thereafter, so any cluster that
+ *          is modified or deleted while the index is in use must be invalidated explicitly. Intended to be owned by an algorithm, for the
+ *          duration of a phase in which the queried clusters are not otherwise modified, and cleared at the end of that phase.
+ */
+class LArClusterHitIndex
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    LArClusterHitIndex();
+
+    /**
+     *  @brief  Destructor
+     */
+    ~LArClusterHitIndex();
+
+    /**
+     *  @brief  Get closest position on a cluster to a specified input position vector
+     *
+     *  @param  position the position vector
+     *  @param  pCluster address of the cluster
+     *
+     *  @return the closest position
+     */
+    pandora::CartesianVector GetClosestPosition(const pandora::CartesianVector &position, const pandora::Cluster *const pCluster);
+
+    /**
+     *  @brief  Get pair of closest positions for a pair of clusters
+     *
+     *  @param  pCluster1 the address of the first cluster
+     *  @param  pCluster2 the address of the second cluster, for which the index is used
+     *  @param  position1 to receive the closest position in the first cluster
+     *  @param  position2 to receive the closest position in the second cluster
+     */
+    void GetClosestPositions(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2, pandora::CartesianVector &position1,
+        pandora::CartesianVector &position2);
+
+    /**
+     *  @brief  Remove the index entry for a cluster, which must be called if the cluster is modified or deleted
+     *
+     *  @param  pCluster address of the cluster
+     */
+    void Invalidate(const pandora::Cluster *const pCluster);
+
+    /**
+     *  @brief  Remove all index entries
+     */
+    void Clear();
+
+private:
+    class ClusterEntry;
+    typedef std::unordered_map<const pandora::Cluster*, std::unique_ptr<ClusterEntry> > ClusterEntryMap;
+
+    /**
+     *  @brief  Get the index entry for a cluster, building it if there is none
+     *
+     *  @param  pCluster address of the cluster
+     *
+     *  @return the index entry
+     */
+    ClusterEntry &GetClusterEntry(const pandora::Cluster *const pCluster);
+
+    /**
+     *  @brief  Find the hit in an indexed cluster closest to a specified position, choosing the first in ordered calo hit list order if
+     *          several hits are equidistant
+     *
+     *  @param  clusterEntry the index entry for the cluster
+     *  @param  position the position vector
+     *  @param  closestHitIndex to receive the index of the closest hit
+     *  @param  closestDistanceSquared to receive the squared distance to the closest hit
+     */
+    static void FindClosestHit(ClusterEntry &clusterEntry, const pandora::CartesianVector &position, unsigned int &closestHitIndex,
+        float &closestDistanceSquared);
+
+    ClusterEntryMap     m_clusterEntryMap;      ///< The map from cluster to index entry
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_CLUSTER_HIT_INDEX_H
@@ -0,0 +1,271 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArDetectorGapIndex.cc
+ *
+ *  @brief  Implementation of the lar detector gap index class.
+ *
+ *  $Log: $
+ */
+
+#include "Geometry/DetectorGap.h"
+
+#include "Managers/GeometryManager.h"
+
+#include "Objects/CartesianVector.h"
+
+#include "Pandora/Pandora.h"
+
+#include "larpandoracontent/LArObjects/LArDetectorGapIndex.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+LArDetectorGapIndex::LArDetectorGapIndex(const DetectorGapList &detectorGapList) :
+    m_pDetectorGapList(&detectorGapList),
+    m_nDetectorGaps(detectorGapList.size()),
+    m_hasNonLineGaps(false)
+{
+    unsigned int listPosition(0);
+
+    for (const DetectorGap *const pDetectorGap : detectorGapList)
+    {
+        const LineGap *const pLineGap(dynamic_cast<const LineGap*>(pDetectorGap));
+
+        if (!pLineGap)
+        {
+            m_hasNonLineGaps = true;
+            m_unindexedGaps.push_back(pDetectorGap);
+        }
+        else if (TPC_WIRE_GAP_VIEW_U == pLineGap->GetLineGapType())
+        {
+            m_wireGapsU.m_indexedLineGaps.emplace_back(pLineGap, listPosition, pLineGap->GetLineStartZ(), pLineGap->GetLineEndZ());
+        }
+        else if (TPC_WIRE_GAP_VIEW_V == pLineGap->GetLineGapType())
+        {
+            m_wireGapsV.m_indexedLineGaps.emplace_back(pLineGap, listPosition, pLineGap->GetLineStartZ(), pLineGap->GetLineEndZ());
+        }
+        else if (TPC_WIRE_GAP_VIEW_W == pLineGap->GetLineGapType())
+        {
+            m_wireGapsW.m_indexedLineGaps.emplace_back(pLineGap, listPosition, pLineGap->GetLineStartZ(), pLineGap->GetLineEndZ());
+        }
+        else if (TPC_DRIFT_GAP == pLineGap->GetLineGapType())
+        {
+            const float minX(std::min(pLineGap->GetLineStartX(), pLineGap->GetLineEndX()));
+            const float maxX(std::max(pLineGap->GetLineStartX(), pLineGap->GetLineEndX()));
+            m_driftGaps.m_indexedLineGaps.emplace_back(pLineGap, listPosition, minX, maxX);
+        }
+        else
+        {
+            m_unindexedGaps.push_back(pDetectorGap);
+        }
+
+        ++listPosition;
+    }
+
+    m_wireGapsU.Sort();
+    m_wireGapsV.Sort();
+    m_wireGapsW.Sort();
+    m_driftGaps.Sort();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::shared_ptr<const LArDetectorGapIndex> LArDetectorGapIndex::GetSharedInstance(const Pandora &pandora)
+{
+    // ATTN Registry holds weak references only, so that indices are owned (and destroyed) by their holders rather than by static storage
+    typedef std::unordered_map<const Pandora*, std::weak_ptr<const LArDetectorGapIndex> > InstanceMap;
+
+    static std::mutex instanceMutex;
+    static InstanceMap instanceMap;
+
+    const DetectorGapList &detectorGapList(pandora.GetGeometry()->GetDetectorGapList());
+    std::lock_guard<std::mutex> lock(instanceMutex);
+
+    for (InstanceMap::iterator iter = instanceMap.begin(); iter != instanceMap.end(); )
+        iter = (iter->second.expired() ? instanceMap.erase(iter) : std::next(iter));
+
+    std::weak_ptr<const LArDetectorGapIndex> &weakInstance(instanceMap[&pandora]);
+    std::shared_ptr<const LArDetectorGapIndex> pInstance(weakInstance.lock());
+
+    if (!pInstance || !pInstance->IsIndexed(detectorGapList))
+    {
+        pInstance = std::make_shared<const LArDetectorGapIndex>(detectorGapList);
+        weakInstance = pInstance;
+    }
+
+    return pInstance;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArDetectorGapIndex::IsIndexed(const DetectorGapList &detectorGapList) const
+{
+    return ((&detectorGapList == m_pDetectorGapList) && (detectorGapList.size() == m_nDetectorGaps));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArDetectorGapIndex::IsInGap(const CartesianVector &testPoint2D, const HitType hitType, const float gapTolerance) const
+{
+    // ATTN Candidate selection uses padded ranges, so that they are supersets of the gaps for which the exact gap test can succeed
+    const float tolerance(std::fabs(gapTolerance));
+    const float paddingZ(tolerance + std::numeric_limits<float>::epsilon() * (1.f + std::fabs(testPoint2D.GetZ())));
+    const float paddingX(tolerance + std::numeric_limits<float>::epsilon() * (1.f + std::fabs(testPoint2D.GetX())));
+
+    IndexedLineGapVector::const_iterator beginIter, endIter;
+    this->GetWireGapIndex(hitType).GetCandidateRange(testPoint2D.GetZ() - paddingZ, testPoint2D.GetZ() + paddingZ, beginIter, endIter);
+
+    for (IndexedLineGapVector::const_iterator iter = beginIter; iter != endIter; ++iter)
+    {
+        if (iter->m_pLineGap->IsInGap(testPoint2D, hitType, gapTolerance))
+            return true;
+    }
+
+    // ATTN A drift gap applies to all views, but can only contain points within its extent in x
+    m_driftGaps.GetCandidateRange(testPoint2D.GetX() - paddingX, testPoint2D.GetX() + paddingX, beginIter, endIter);
+
+    for (IndexedLineGapVector::const_iterator iter = beginIter; iter != endIter; ++iter)
+    {
+        if (iter->m_pLineGap->IsInGap(testPoint2D, hitType, gapTolerance))
+            return true;
+    }
+
+    for (const DetectorGap *const pDetectorGap : m_unindexedGaps)
+    {
+        if (pDetectorGap->IsInGap(testPoint2D, hitType, gapTolerance))
+            return true;
+    }
+
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float LArDetectorGapIndex::CalculateGapDeltaZ(const float minZ, const float maxZ, const HitType hitType) const
+{
+    if (m_hasNonLineGaps)
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    const IntervalIndex &wireGapIndex(this->GetWireGapIndex(hitType));
+
+    IndexedLineGapVector::const_iterator beginIter, endIter;
+    wireGapIndex.GetCandidateRange(minZ, maxZ, beginIter, endIter);
+
+    float gapDeltaZ(0.f);
+
+    if (wireGapIndex.m_isInListOrder)
+    {
+        for (IndexedLineGapVector::const_iterator iter = beginIter; iter != endIter; ++iter)
+            LArDetectorGapIndex::AddGapDeltaZ(*iter, minZ, maxZ, gapDeltaZ);
+
+        return gapDeltaZ;
+    }
+
+    // ATTN Accumulate in detector gap list order, to reproduce the exhaustive calculation exactly
+    std::vector<const IndexedLineGap*> candidateVector;
+
+    for (IndexedLineGapVector::const_iterator iter = beginIter; iter != endIter; ++iter)
+        candidateVector.push_back(&(*iter));
+
+    std::sort(candidateVector.begin(), candidateVector.end(), [](const IndexedLineGap *const pLhs, const IndexedLineGap *const pRhs)
+        {return (pLhs->m_listPosition < pRhs->m_listPosition);});
+
+    for (const IndexedLineGap *const pIndexedLineGap : candidateVector)
+        LArDetectorGapIndex::AddGapDeltaZ(*pIndexedLineGap, minZ, maxZ, gapDeltaZ);
+
+    return gapDeltaZ;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArDetectorGapIndex::AddGapDeltaZ(const IndexedLineGap &indexedLineGap, const float minZ, const float maxZ, float &gapDeltaZ)
+{
+    if ((indexedLineGap.m_start > maxZ) || (indexedLineGap.m_end < minZ))
+        return;
+
+    const float gapMinZ(std::max(minZ, indexedLineGap.m_start));
+    const float gapMaxZ(std::min(maxZ, indexedLineGap.m_end));
+
+    if ((gapMaxZ - gapMinZ) > std::numeric_limits<float>::epsilon())
+        gapDeltaZ += (gapMaxZ - gapMinZ);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+const LArDetectorGapIndex::IntervalIndex &LArDetectorGapIndex::GetWireGapIndex(const HitType hitType) const
+{
+    if (TPC_VIEW_U == hitType)
+        return m_wireGapsU;
+
+    if (TPC_VIEW_V == hitType)
+        return m_wireGapsV;
+
+    if (TPC_VIEW_W == hitType)
+        return m_wireGapsW;
+
+    return m_noWireGaps;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArDetectorGapIndex::IndexedLineGap::IndexedLineGap(const LineGap *const pLineGap, const unsigned int listPosition, const float start,
+        const float end) :
+    m_pLineGap(pLineGap),
+    m_listPosition(listPosition),
+    m_start(start),
+    m_end(end),
+    m_maxEnd(end)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArDetectorGapIndex::IntervalIndex::IntervalIndex() :
+    m_isInListOrder(true)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArDetectorGapIndex::IntervalIndex::Sort()
+{
+    std::sort(m_indexedLineGaps.begin(), m_indexedLineGaps.end(), [](const IndexedLineGap &lhs, const IndexedLineGap &rhs)
+        {return ((lhs.m_start < rhs.m_start) || ((lhs.m_start == rhs.m_start) && (lhs.m_listPosition < rhs.m_listPosition)));});
+
+    float maxEnd(-std::numeric_limits<float>::max());
+    m_isInListOrder = true;
+
+    for (IndexedLineGapVector::iterator iter = m_indexedLineGaps.begin(); iter != m_indexedLineGaps.end(); ++iter)
+    {
+        maxEnd = std::max(maxEnd, iter->m_end);
+        iter->m_maxEnd = maxEnd;
+
+        if ((m_indexedLineGaps.begin() != iter) && (std::prev(iter)->m_listPosition > iter->m_listPosition))
+            m_isInListOrder = false;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArDetectorGapIndex::IntervalIndex::GetCandidateRange(const float min, const float max, IndexedLineGapVector::const_iterator &beginIter,
+    IndexedLineGapVector::const_iterator &endIter) const
+{
+    // Gaps starting beyond max cannot overlap; the running maximum end is non-decreasing, so gaps before the first to reach min cannot overlap
+    endIter = std::upper_bound(m_indexedLineGaps.begin(), m_indexedLineGaps.end(), max,
+        [](const float value, const IndexedLineGap &indexedLineGap) {return (value < indexedLineGap.m_start);});
+
+    beginIter = std::lower_bound(m_indexedLineGaps.begin(), endIter, min,
+        [](const IndexedLineGap &indexedLineGap, const float value) {return (indexedLineGap.m_maxEnd < value);});
+}
+
+} // namespace lar_content
@@ -0,0 +1,176 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArDetectorGapIndex.h
+ *
+ *  @brief  Header file for the lar detector gap index class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_DETECTOR_GAP_INDEX_H
+#define LAR_DETECTOR_GAP_INDEX_H 1
+
+#include "Pandora/PandoraEnumeratedTypes.h"
+#include "Pandora/PandoraInternal.h"
+
+#include <memory>
+#include <vector>
+
+namespace pandora {class LineGap; class Pandora;}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArDetectorGapIndex class, an index of the registered detector gaps. Wire gaps are sorted, per view, by their extent in the wire
+ *          coordinate and drift gaps are sorted by their extent in x, so that only the gaps spanning a query position need be examined. Any
+ *          other gaps are examined exhaustively. The index is built from the detector gap list of a pandora instance, independent of the
+ *          registered plugins, and is read-only thereafter, so may be used concurrently without locking.
+ */
+class LArDetectorGapIndex
+{
+public:
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  detectorGapList the detector gap list
+     */
+    LArDetectorGapIndex(const pandora::DetectorGapList &detectorGapList);
+
+    /**
+     *  @brief  Get the detector gap index for a pandora instance, shared by all current holders and built from the detector gap list if there
+     *          are none, or if gaps have been registered since it was built. The index is destroyed when the last holder releases it, so holders
+     *          should be owned by the pandora instance (e.g. algorithms, acquiring the index in Initialize) to ensure that a later pandora
+     *          instance at the same address cannot receive a stale index.
+     *
+     *  @param  pandora the pandora instance
+     *
+     *  @return the detector gap index
+     */
+    static std::shared_ptr<const LArDetectorGapIndex> GetSharedInstance(const pandora::Pandora &pandora);
+
+    /**
+     *  @brief  Whether the index describes the current contents of a detector gap list, i.e. no gaps have been registered since it was built
+     *
+     *  @param  detectorGapList the detector gap list
+     *
+     *  @return boolean
+     */
+    bool IsIndexed(const pandora::DetectorGapList &detectorGapList) const;
+
+    /**
+     *  @brief  Whether a 2D test point lies in a registered gap with the associated hit type
+     *
+     *  @param  testPoint2D the test point
+     *  @param  hitType the hit type
+     *  @param  gapTolerance the gap tolerance
+     *
+     *  @return boolean
+     */
+    bool IsInGap(const pandora::CartesianVector &testPoint2D, const pandora::HitType hitType, const float gapTolerance) const;
+
+    /**
+     *  @brief  Calculate the total distance within a given 2D region that is composed of detector gaps
+     *
+     *  @param  minZ the start position in Z
+     *  @param  maxZ the end position in Z
+     *  @param  hitType the hit type
+     *
+     *  @return the total gap distance
+     */
+    float CalculateGapDeltaZ(const float minZ, const float maxZ, const pandora::HitType hitType) const;
+
+private:
+    /**
+     *  @brief  IndexedLineGap class
+     */
+    class IndexedLineGap
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pLineGap address of the line gap
+         *  @param  listPosition the position of the line gap in the detector gap list
+         *  @param  start the start of the line gap extent in the indexed coordinate
+         *  @param  end the end of the line gap extent in the indexed coordinate
+         */
+        IndexedLineGap(const pandora::LineGap *const pLineGap, const unsigned int listPosition, const float start, const float end);
+
+        const pandora::LineGap     *m_pLineGap;         ///< The address of the line gap
+        unsigned int                m_listPosition;     ///< The position of the line gap in the detector gap list
+        float                       m_start;            ///< The start of the line gap extent in the indexed coordinate
+        float                       m_end;              ///< The end of the line gap extent in the indexed coordinate
+        float                       m_maxEnd;           ///< The maximum end of this and all preceding line gaps in the index
+    };
+
+    typedef std::vector<IndexedLineGap> IndexedLineGapVector;
+
+    /**
+     *  @brief  IntervalIndex class, line gaps sorted by the start of their extent in a single coordinate
+     */
+    class IntervalIndex
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        IntervalIndex();
+
+        /**
+         *  @brief  Sort the line gaps by start position, record the running maximum end position and whether the sorted order matches the
+         *          detector gap list order
+         */
+        void Sort();
+
+        /**
+         *  @brief  Get the range of sorted line gaps that may overlap a given interval. Gaps in the range must still be checked individually,
+         *          but no gap outside the range can overlap the interval.
+         *
+         *  @param  min the minimum of the interval
+         *  @param  max the maximum of the interval
+         *  @param  beginIter to receive the iterator to the first candidate line gap
+         *  @param  endIter to receive the iterator past the last candidate line gap
+         */
+        void GetCandidateRange(const float min, const float max, IndexedLineGapVector::const_iterator &beginIter,
+            IndexedLineGapVector::const_iterator &endIter) const;
+
+        IndexedLineGapVector        m_indexedLineGaps;  ///< The line gaps, sorted by start position
+        bool                        m_isInListOrder;    ///< Whether the sorted order matches the detector gap list order
+    };
+
+    typedef std::vector<const pandora::DetectorGap*> DetectorGapVector;
+
+    /**
+     *  @brief  Add the extent of an indexed wire gap that lies within a given range to a running total
+     *
+     *  @param  indexedLineGap the indexed wire gap
+     *  @param  minZ the start position in Z
+     *  @param  maxZ the end position in Z
+     *  @param  gapDeltaZ the running total gap distance
+     */
+    static void AddGapDeltaZ(const IndexedLineGap &indexedLineGap, const float minZ, const float maxZ, float &gapDeltaZ);
+
+    /**
+     *  @brief  Get the wire gap index for a given hit type
+     *
+     *  @param  hitType the hit type
+     *
+     *  @return the wire gap index, empty if the hit type has no associated wire gaps
+     */
+    const IntervalIndex &GetWireGapIndex(const pandora::HitType hitType) const;
+
+    const pandora::DetectorGapList *m_pDetectorGapList;     ///< The address of the indexed detector gap list
+    unsigned int                    m_nDetectorGaps;        ///< The number of gaps in the indexed detector gap list
+    bool                            m_hasNonLineGaps;       ///< Whether the detector gap list contains gaps that are not line gaps
+    IntervalIndex                   m_wireGapsU;            ///< The u view wire gaps, indexed in the wire coordinate
+    IntervalIndex                   m_wireGapsV;            ///< The v view wire gaps, indexed in the wire coordinate
+    IntervalIndex                   m_wireGapsW;            ///< The w view wire gaps, indexed in the wire coordinate
+    IntervalIndex                   m_driftGaps;            ///< The drift gaps, indexed in x
+    IntervalIndex                   m_noWireGaps;           ///< An empty index, for hit types without wire gaps
+    DetectorGapVector               m_unindexedGaps;        ///< The gaps that are not indexed, examined exhaustively
+};
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_DETECTOR_GAP_INDEX_H
@@ -0,0 +1,251 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArStageInstrumentation.cc
+ *
+ *  @brief  Implementation of the lar stage instrumentation class.
+ *
+ *  $Log: $
+ */
+
+#include "Pandora/StatusCodes.h"
+
+#include "larpandoracontent/LArObjects/LArStageInstrumentation.h"
+
+#include <fstream>
+#include <iostream>
+
+#include <sys/resource.h>
+#include <time.h>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+LArStageInstrumentation::StageRecord::StageRecord() :
+    m_wallTime(0.),
+    m_cpuTime(0.),
+    m_nCaloHits(0),
+    m_nClusters(0),
+    m_nPfos(0),
+    m_processPeakMemory(0)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArStageInstrumentation::ScopedStage::ScopedStage(LArStageInstrumentation *const pStageInstrumentation, const char *const stageName) :
+    m_pStageInstrumentation(pStageInstrumentation),
+    m_stageIndex(0),
+    m_nCaloHits(0),
+    m_nClusters(0),
+    m_nPfos(0)
+{
+    if (m_pStageInstrumentation)
+        m_stageIndex = m_pStageInstrumentation->StartStage(stageName);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArStageInstrumentation::ScopedStage::ScopedStage(LArStageInstrumentation *const pStageInstrumentation, const char *const stageNamePrefix,
+        const unsigned int stageNameIndex) :
+    m_pStageInstrumentation(pStageInstrumentation),
+    m_stageIndex(0),
+    m_nCaloHits(0),
+    m_nClusters(0),
+    m_nPfos(0)
+{
+    if (m_pStageInstrumentation)
+        m_stageIndex = m_pStageInstrumentation->StartStage(stageNamePrefix + std::to_string(stageNameIndex));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArStageInstrumentation::ScopedStage::~ScopedStage()
+{
+    if (!m_pStageInstrumentation)
+        return;
+
+    try
+    {
+        m_pStageInstrumentation->EndStage(m_stageIndex, m_nCaloHits, m_nClusters, m_nPfos);
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        std::cout << "LArStageInstrumentation::ScopedStage - unable to finish stage " << m_stageIndex << ", " << statusCodeException.ToString() << std::endl;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArStageInstrumentation::LArStageInstrumentation() :
+    m_outputFormat(CSV)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+unsigned int LArStageInstrumentation::StartStage(const std::string &stageName)
+{
+    StageStart stageStart;
+    stageStart.m_cpuTime = LArStageInstrumentation::GetThreadCpuTime();
+    stageStart.m_wallTime = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    StageRecord stageRecord;
+    stageRecord.m_stageName = stageName;
+    m_stageRecords.push_back(stageRecord);
+    m_stageStarts.push_back(stageStart);
+
+    return (m_stageRecords.size() - 1);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArStageInstrumentation::EndStage(const unsigned int stageIndex, const unsigned int nCaloHits, const unsigned int nClusters, const unsigned int nPfos)
+{
+    const std::chrono::steady_clock::time_point wallTime(std::chrono::steady_clock::now());
+    const double cpuTime(LArStageInstrumentation::GetThreadCpuTime());
+    const long processPeakMemory(LArStageInstrumentation::GetProcessPeakMemory());
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (stageIndex >= m_stageRecords.size())
+        throw StatusCodeException(STATUS_CODE_OUT_OF_RANGE);
+
+    const StageStart &stageStart(m_stageStarts.at(stageIndex));
+    StageRecord &stageRecord(m_stageRecords.at(stageIndex));
+    stageRecord.m_wallTime = std::chrono::duration<double, std::milli>(wallTime - stageStart.m_wallTime).count();
+    stageRecord.m_cpuTime = cpuTime - stageStart.m_cpuTime;
+    stageRecord.m_nCaloHits = nCaloHits;
+    stageRecord.m_nClusters = nClusters;
+    stageRecord.m_nPfos = nPfos;
+    stageRecord.m_processPeakMemory = processPeakMemory;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArStageInstrumentation::OpenOutputFile(const std::string &fileName, const OutputFormat outputFormat)
+{
+    if (m_outputFile.is_open())
+        throw StatusCodeException(STATUS_CODE_ALREADY_INITIALIZED);
+
+    if ((CSV != outputFormat) && (JSON != outputFormat))
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    m_outputFormat = outputFormat;
+    m_outputFile.open(fileName, std::ios_base::app | std::ios_base::ate);
+
+    if (!m_outputFile.good())
+    {
+        std::cout << "LArStageInstrumentation::OpenOutputFile - unable to open output file " << fileName << std::endl;
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+    }
+
+    // ATTN The file is opened positioned at its end, so a zero put position identifies a new (or empty) file
+    if ((CSV == m_outputFormat) && (0 == m_outputFile.tellp()))
+        m_outputFile << "Event,Stage,WallTimeMs,ThreadCpuTimeMs,NCaloHits,NClusters,NPfos,ProcessPeakMemoryKB" << std::endl;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArStageInstrumentation::WriteEvent(const unsigned int eventNumber)
+{
+    if (!m_outputFile.is_open())
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+
+    if (CSV == m_outputFormat)
+    {
+        for (const StageRecord &stageRecord : m_stageRecords)
+        {
+            m_outputFile << eventNumber << "," << stageRecord.m_stageName << "," << stageRecord.m_wallTime << "," << stageRecord.m_cpuTime << ","
+                         << stageRecord.m_nCaloHits << "," << stageRecord.m_nClusters << "," << stageRecord.m_nPfos << "," << stageRecord.m_processPeakMemory
+                         << std::endl;
+        }
+    }
+    else
+    {
+        m_outputFile << "{\"event\": " << eventNumber << ", \"stages\": [";
+
+        for (StageRecordVector::const_iterator iter = m_stageRecords.begin(); iter != m_stageRecords.end(); ++iter)
+        {
+            m_outputFile << ((m_stageRecords.begin() == iter) ? "" : ", ") << "{\"stage\": \"" << LArStageInstrumentation::EscapeJson(iter->m_stageName)
+                         << "\", \"wallTimeMs\": " << iter->m_wallTime << ", \"threadCpuTimeMs\": " << iter->m_cpuTime << ", \"nCaloHits\": "
+                         << iter->m_nCaloHits << ", \"nClusters\": " << iter->m_nClusters << ", \"nPfos\": " << iter->m_nPfos
+                         << ", \"processPeakMemoryKB\": " << iter->m_processPeakMemory << "}";
+        }
+
+        m_outputFile << "]}" << std::endl;
+    }
+
+    if (!m_outputFile.good())
+    {
+        std::cout << "LArStageInstrumentation::WriteEvent - unable to write to output file" << std::endl;
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArStageInstrumentation::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stageRecords.clear();
+    m_stageStarts.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+long LArStageInstrumentation::GetProcessPeakMemory()
+{
+    struct rusage resourceUsage;
+
+    if (0 != getrusage(RUSAGE_SELF, &resourceUsage))
+        return 0;
+
+    return resourceUsage.ru_maxrss;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+double LArStageInstrumentation::GetThreadCpuTime()
+{
+    struct timespec cpuTime;
+
+    if (0 != clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpuTime))
+        return 0.;
+
+    return (1000. * static_cast<double>(cpuTime.tv_sec) + 1.e-6 * static_cast<double>(cpuTime.tv_nsec));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::string LArStageInstrumentation::EscapeJson(const std::string &input)
+{
+    std::string output;
+    output.reserve(input.size());
+
+    for (const char character : input)
+    {
+        if (('"' == character) || ('\\' == character))
+        {
+            output.push_back('\\');
+            output.push_back(character);
+        }
+        else if (static_cast<unsigned char>(character) < 0x20)
+        {
+            const char *const hexDigits("0123456789abcdef");
+            output += "\\u00";
+            output.push_back(hexDigits[(character >> 4) & 0xf]);
+            output.push_back(hexDigits[character & 0xf]);
+        }
+        else
+        {
+            output.push_back(character);
+        }
+    }
+
+    return output;
+}
+
+} // namespace lar_content
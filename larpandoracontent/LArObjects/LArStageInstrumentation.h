@@ -0,0 +1,245 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArStageInstrumentation.h
+ *
+ *  @brief  Header file for the lar stage instrumentation class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_STAGE_INSTRUMENTATION_H
+#define LAR_STAGE_INSTRUMENTATION_H 1
+
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArStageInstrumentation class, recording the resources used by each named processing stage of an event
+ */
+class LArStageInstrumentation
+{
+public:
+    /**
+     *  @brief  StageRecord class
+     */
+    class StageRecord
+    {
+    public:
+        /**
+         *  @brief  Default constructor
+         */
+        StageRecord();
+
+        std::string     m_stageName;                ///< The stage name
+        double          m_wallTime;                 ///< The wall time, in ms
+        double          m_cpuTime;                  ///< The cpu time of the thread running the stage (excluding any threads it spawns), in ms
+        unsigned int    m_nCaloHits;                ///< The number of calo hits handled by the stage
+        unsigned int    m_nClusters;                ///< The number of clusters produced or handled by the stage
+        unsigned int    m_nPfos;                    ///< The number of pfos produced or handled by the stage
+        long            m_processPeakMemory;        ///< The process-wide peak resident memory (high-water mark) at the end of the stage, in kB
+    };
+
+    typedef std::vector<StageRecord> StageRecordVector;
+
+    /**
+     *  @brief  ScopedStage class, recording a stage from construction until destruction, so that the stage is closed on all exit paths.
+     *          The stage must be started and finished on the same thread.
+     */
+    class ScopedStage
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pStageInstrumentation the address of the stage instrumentation (no stage is recorded if null)
+         *  @param  stageName the stage name
+         */
+        ScopedStage(LArStageInstrumentation *const pStageInstrumentation, const char *const stageName);
+
+        /**
+         *  @brief  Constructor, with the stage name formed from a prefix and an index
+         *
+         *  @param  pStageInstrumentation the address of the stage instrumentation (no stage is recorded, or name formed, if null)
+         *  @param  stageNamePrefix the stage name prefix
+         *  @param  stageNameIndex the stage name index
+         */
+        ScopedStage(LArStageInstrumentation *const pStageInstrumentation, const char *const stageNamePrefix, const unsigned int stageNameIndex);
+
+        /**
+         *  @brief  Destructor, finishing the stage
+         */
+        ~ScopedStage();
+
+        /**
+         *  @brief  Whether a stage is being recorded, i.e. whether it is worth evaluating the stage counts
+         *
+         *  @return boolean
+         */
+        bool IsEnabled() const;
+
+        /**
+         *  @brief  Set the counts to be recorded when the stage finishes
+         *
+         *  @param  nCaloHits the number of calo hits handled by the stage
+         *  @param  nClusters the number of clusters produced or handled by the stage
+         *  @param  nPfos the number of pfos produced or handled by the stage
+         */
+        void SetCounts(const unsigned int nCaloHits, const unsigned int nClusters, const unsigned int nPfos);
+
+    private:
+        LArStageInstrumentation    *m_pStageInstrumentation;    ///< The address of the stage instrumentation, null if disabled
+        unsigned int                m_stageIndex;               ///< The stage index
+        unsigned int                m_nCaloHits;                ///< The number of calo hits handled by the stage
+        unsigned int                m_nClusters;                ///< The number of clusters produced or handled by the stage
+        unsigned int                m_nPfos;                    ///< The number of pfos produced or handled by the stage
+    };
+
+    /**
+     *  @brief  OutputFormat enum
+     */
+    enum OutputFormat
+    {
+        CSV,
+        JSON
+    };
+
+    /**
+     *  @brief  Default constructor
+     */
+    LArStageInstrumentation();
+
+    /**
+     *  @brief  Start recording a named stage; may be called concurrently from multiple threads
+     *
+     *  @param  stageName the stage name
+     *
+     *  @return the stage index, to be provided when the stage ends
+     */
+    unsigned int StartStage(const std::string &stageName);
+
+    /**
+     *  @brief  Finish recording a stage; may be called concurrently from multiple threads
+     *
+     *  @param  stageIndex the stage index
+     *  @param  nCaloHits the number of calo hits handled by the stage
+     *  @param  nClusters the number of clusters produced or handled by the stage
+     *  @param  nPfos the number of pfos produced or handled by the stage
+     */
+    void EndStage(const unsigned int stageIndex, const unsigned int nCaloHits, const unsigned int nClusters, const unsigned int nPfos);
+
+    /**
+     *  @brief  Get the stage records, in stage start order
+     *
+     *  @return the stage records
+     */
+    const StageRecordVector &GetStageRecords() const;
+
+    /**
+     *  @brief  Open the output file, to which the stage records for each event will be appended. For csv output, a header row is written
+     *          if the file is new; for json output, one json object is written per event (json lines).
+     *
+     *  @param  fileName the output file name
+     *  @param  outputFormat the output format
+     */
+    void OpenOutputFile(const std::string &fileName, const OutputFormat outputFormat);
+
+    /**
+     *  @brief  Whether the output file has been opened
+     *
+     *  @return boolean
+     */
+    bool IsOutputFileOpen() const;
+
+    /**
+     *  @brief  Append the stage records for an event to the output file
+     *
+     *  @param  eventNumber the event number
+     */
+    void WriteEvent(const unsigned int eventNumber);
+
+    /**
+     *  @brief  Clear all stage records, in preparation for the next event
+     */
+    void Clear();
+
+    /**
+     *  @brief  Get the process-wide peak resident memory. This is a high-water mark for the whole process, so cannot be attributed to
+     *          any one of a number of concurrent stages.
+     *
+     *  @return the process peak resident memory, in kB
+     */
+    static long GetProcessPeakMemory();
+
+    /**
+     *  @brief  Get the cpu time used by the calling thread
+     *
+     *  @return the thread cpu time, in ms
+     */
+    static double GetThreadCpuTime();
+
+private:
+    /**
+     *  @brief  StageStart class
+     */
+    class StageStart
+    {
+    public:
+        std::chrono::steady_clock::time_point   m_wallTime;     ///< The wall time at the stage start
+        double                                  m_cpuTime;      ///< The thread cpu time at the stage start, in ms
+    };
+
+    typedef std::vector<StageStart> StageStartVector;
+
+    /**
+     *  @brief  Escape a string for use as a json string value
+     *
+     *  @param  input the input string
+     *
+     *  @return the escaped string
+     */
+    static std::string EscapeJson(const std::string &input);
+
+    std::mutex          m_mutex;                    ///< The mutex protecting the stage records
+    StageRecordVector   m_stageRecords;             ///< The stage records
+    StageStartVector    m_stageStarts;              ///< The stage start details
+    OutputFormat        m_outputFormat;             ///< The output format
+    std::ofstream       m_outputFile;               ///< The output file
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const LArStageInstrumentation::StageRecordVector &LArStageInstrumentation::GetStageRecords() const
+{
+    return m_stageRecords;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool LArStageInstrumentation::IsOutputFileOpen() const
+{
+    return m_outputFile.is_open();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool LArStageInstrumentation::ScopedStage::IsEnabled() const
+{
+    return (nullptr != m_pStageInstrumentation);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void LArStageInstrumentation::ScopedStage::SetCounts(const unsigned int nCaloHits, const unsigned int nClusters, const unsigned int nPfos)
+{
+    m_nCaloHits = nCaloHits;
+    m_nClusters = nClusters;
+    m_nPfos = nPfos;
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_STAGE_INSTRUMENTATION_H
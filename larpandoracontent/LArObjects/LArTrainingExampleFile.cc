@@ -0,0 +1,417 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArTrainingExampleFile.cc
+ *
+ *  @brief  Implementation of the lar training example file writer and reader classes.
+ *
+ *  $Log: $
+ */
+
+#include "larpandoracontent/LArObjects/LArTrainingExampleFile.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+const char LArTrainingExampleWriter::m_binaryIdentifier[8] = {'L', 'A', 'R', 'M', 'V', 'A', 'E', 'X'};
+const std::uint32_t LArTrainingExampleWriter::m_binaryVersion(1);
+const std::uint32_t LArTrainingExampleWriter::m_binaryByteOrderMark(0x01020304);
+const unsigned int LArTrainingExampleWriter::m_streamBufferSize(1 << 20);
+const unsigned int LArTrainingExampleWriter::m_maxBlockSize(4096);
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode LArTrainingExampleWriter::WriteExample(const std::string &fileName, const Format format, const std::time_t timestamp, const bool result,
+    const MvaTypes::MvaFeatureVector &featureVector)
+{
+    WriterRegistry &writerRegistry(LArTrainingExampleWriter::GetWriterRegistry());
+    std::lock_guard<std::mutex> lock(writerRegistry.m_mutex);
+
+    LArTrainingExampleWriter *pWriter(nullptr);
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArTrainingExampleWriter::GetWriter(fileName, format, pWriter));
+
+    pWriter->Write(timestamp, result, featureVector);
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArTrainingExampleWriter::FlushAll()
+{
+    WriterRegistry &writerRegistry(LArTrainingExampleWriter::GetWriterRegistry());
+    std::lock_guard<std::mutex> lock(writerRegistry.m_mutex);
+
+    for (WriterMap::value_type &mapEntry : writerRegistry.m_writerMap)
+        mapEntry.second->Flush();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArTrainingExampleWriter::Close(const std::string &fileName)
+{
+    WriterRegistry &writerRegistry(LArTrainingExampleWriter::GetWriterRegistry());
+    std::lock_guard<std::mutex> lock(writerRegistry.m_mutex);
+    writerRegistry.m_writerMap.erase(fileName);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::string LArTrainingExampleWriter::GetTimestampString(const std::time_t timestamp)
+{
+    struct tm *pTimeInfo(NULL);
+    char buffer[80];
+
+    pTimeInfo = localtime(&timestamp);
+    strftime(buffer, 80, "%x_%X", pTimeInfo);
+
+    std::string timeString(buffer);
+
+    if (!timeString.empty() && timeString.back() == '\n') // last char is always a newline
+        timeString.pop_back();
+
+    return timeString;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArTrainingExampleWriter::~LArTrainingExampleWriter()
+{
+    this->Flush();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArTrainingExampleWriter::LArTrainingExampleWriter(const std::string &fileName, const Format format) :
+    m_format(format),
+    m_isOpen(false),
+    m_pStreamBuffer(new char[m_streamBufferSize]),
+    m_lastTimestamp(0),
+    m_nBlockFeatures(0)
+{
+    // ATTN Refuse to append examples in one format to a file holding examples in the other
+    std::ifstream infile(fileName, std::ios_base::binary);
+    const bool isEmpty(!infile.is_open() || (infile.peek() == std::ifstream::traits_type::eof()));
+    const StatusCode headerStatusCode(isEmpty ? STATUS_CODE_NOT_FOUND : LArTrainingExampleWriter::ReadBinaryHeader(infile));
+    infile.close();
+
+    if (!isEmpty && ((STATUS_CODE_NOT_FOUND != headerStatusCode) != (BINARY == m_format)))
+    {
+        std::cout << "LArTrainingExampleWriter: " << fileName << " already holds training examples in another format" << std::endl;
+        return;
+    }
+
+    if (!isEmpty && (STATUS_CODE_INVALID_PARAMETER == headerStatusCode))
+    {
+        std::cout << "LArTrainingExampleWriter: " << fileName << " has an unsupported binary format version or byte order" << std::endl;
+        return;
+    }
+
+    m_outfile.rdbuf()->pubsetbuf(m_pStreamBuffer.get(), m_streamBufferSize);
+    m_outfile.open(fileName, (BINARY == m_format) ? (std::ios_base::app | std::ios_base::binary) : std::ios_base::app); // always append to the output file
+
+    if (!m_outfile.is_open())
+        return;
+
+    if ((BINARY == m_format) && isEmpty)
+    {
+        LArTrainingExampleWriter::WriteValues(m_outfile, m_binaryIdentifier, sizeof(m_binaryIdentifier));
+        LArTrainingExampleWriter::WriteValues(m_outfile, &m_binaryVersion, 1);
+        LArTrainingExampleWriter::WriteValues(m_outfile, &m_binaryByteOrderMark, 1);
+    }
+
+    m_isOpen = true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArTrainingExampleWriter::WriterRegistry &LArTrainingExampleWriter::GetWriterRegistry()
+{
+    // ATTN Users close their files explicitly at teardown; any writers still open at exit are flushed and closed when the registry is destroyed
+    static WriterRegistry writerRegistry;
+    return writerRegistry;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode LArTrainingExampleWriter::GetWriter(const std::string &fileName, const Format format, LArTrainingExampleWriter *&pWriter)
+{
+    WriterMap &writerMap(LArTrainingExampleWriter::GetWriterRegistry().m_writerMap);
+    std::unique_ptr<LArTrainingExampleWriter> &pMapWriter(writerMap[fileName]);
+
+    if (!pMapWriter)
+    {
+        pMapWriter.reset(new LArTrainingExampleWriter(fileName, format));
+
+        if (!pMapWriter->m_isOpen)
+        {
+            std::cout << "LArTrainingExampleWriter: could not open file for training examples at " << fileName << std::endl;
+            writerMap.erase(fileName);
+            return STATUS_CODE_FAILURE;
+        }
+    }
+
+    if (format != pMapWriter->m_format)
+    {
+        std::cout << "LArTrainingExampleWriter: file for training examples at " << fileName << " is already open in another format" << std::endl;
+        return STATUS_CODE_FAILURE;
+    }
+
+    pWriter = pMapWriter.get();
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode LArTrainingExampleWriter::ReadBinaryHeader(std::ifstream &stream)
+{
+    char identifier[sizeof(m_binaryIdentifier)];
+
+    if (!LArTrainingExampleWriter::ReadValues(stream, identifier, sizeof(m_binaryIdentifier)) ||
+        (0 != std::memcmp(identifier, m_binaryIdentifier, sizeof(m_binaryIdentifier))))
+    {
+        return STATUS_CODE_NOT_FOUND;
+    }
+
+    std::uint32_t version(0), byteOrderMark(0);
+
+    if (!LArTrainingExampleWriter::ReadValues(stream, &version, 1) || !LArTrainingExampleWriter::ReadValues(stream, &byteOrderMark, 1) ||
+        (m_binaryVersion != version) || (m_binaryByteOrderMark != byteOrderMark))
+    {
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArTrainingExampleWriter::Write(const std::time_t timestamp, const bool result, const MvaTypes::MvaFeatureVector &featureVector)
+{
+    if (TEXT == m_format)
+    {
+        if (m_lastTimestampString.empty() || (timestamp != m_lastTimestamp))
+        {
+            m_lastTimestamp = timestamp;
+            m_lastTimestampString = LArTrainingExampleWriter::GetTimestampString(timestamp);
+        }
+
+        const std::string delimiter(",");
+        m_outfile << m_lastTimestampString << delimiter;
+
+        for (const MvaTypes::MvaFeature &feature : featureVector)
+            m_outfile << feature.Get() << delimiter;
+
+        m_outfile << static_cast<int>(result) << '\n';
+        return;
+    }
+
+    if (!m_blockResults.empty() && (featureVector.size() != m_nBlockFeatures))
+        this->WriteBlock();
+
+    // Read all features before buffering, so that an uninitialized feature leaves the block unchanged
+    FeatureVector features;
+    features.reserve(featureVector.size());
+
+    for (const MvaTypes::MvaFeature &feature : featureVector)
+        features.push_back(feature.Get());
+
+    m_nBlockFeatures = featureVector.size();
+    m_blockTimestamps.push_back(static_cast<std::int64_t>(timestamp));
+    m_blockResults.push_back(result ? 1 : 0);
+    m_blockFeatures.insert(m_blockFeatures.end(), features.begin(), features.end());
+
+    if (m_blockResults.size() >= m_maxBlockSize)
+        this->WriteBlock();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArTrainingExampleWriter::Flush()
+{
+    this->WriteBlock();
+    m_outfile.flush();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArTrainingExampleWriter::WriteBlock()
+{
+    if (m_blockResults.empty())
+        return;
+
+    const std::uint32_t nExamples(m_blockResults.size()), nFeatures(m_nBlockFeatures);
+    LArTrainingExampleWriter::WriteValues(m_outfile, &nExamples, 1);
+    LArTrainingExampleWriter::WriteValues(m_outfile, &nFeatures, 1);
+    LArTrainingExampleWriter::WriteValues(m_outfile, m_blockTimestamps.data(), nExamples);
+    LArTrainingExampleWriter::WriteValues(m_outfile, m_blockResults.data(), nExamples);
+
+    FeatureVector featureColumn(nExamples);
+
+    for (unsigned int iFeature = 0; iFeature < nFeatures; ++iFeature)
+    {
+        for (unsigned int iExample = 0; iExample < nExamples; ++iExample)
+            featureColumn[iExample] = m_blockFeatures[iExample * nFeatures + iFeature];
+
+        LArTrainingExampleWriter::WriteValues(m_outfile, featureColumn.data(), nExamples);
+    }
+
+    m_blockTimestamps.clear();
+    m_blockResults.clear();
+    m_blockFeatures.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArTrainingExampleReader::LArTrainingExampleReader(const std::string &fileName) :
+    m_format(LArTrainingExampleWriter::TEXT),
+    m_infile(fileName, std::ios_base::binary),
+    m_nBlockExamples(0),
+    m_nBlockFeatures(0),
+    m_blockPosition(0)
+{
+    if (!m_infile.is_open())
+    {
+        std::cout << "LArTrainingExampleReader: could not open file of training examples at " << fileName << std::endl;
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+    }
+
+    const StatusCode headerStatusCode(LArTrainingExampleWriter::ReadBinaryHeader(m_infile));
+
+    if (STATUS_CODE_NOT_FOUND == headerStatusCode)
+    {
+        m_infile.clear();
+        m_infile.seekg(0);
+        return;
+    }
+
+    if (STATUS_CODE_SUCCESS != headerStatusCode)
+    {
+        std::cout << "LArTrainingExampleReader: " << fileName << " has an unsupported binary format version or byte order" << std::endl;
+        throw StatusCodeException(headerStatusCode);
+    }
+
+    m_format = LArTrainingExampleWriter::BINARY;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArTrainingExampleReader::ReadExample(std::string &timestamp, bool &result, MvaTypes::MvaFeatureVector &featureVector)
+{
+    featureVector.clear();
+
+    if (LArTrainingExampleWriter::BINARY == m_format)
+        return this->ReadBinaryExample(timestamp, result, featureVector);
+
+    return this->ReadTextExample(timestamp, result, featureVector);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArTrainingExampleReader::ReadTextExample(std::string &timestamp, bool &result, MvaTypes::MvaFeatureVector &featureVector)
+{
+    std::string line;
+
+    while (line.empty())
+    {
+        if (!std::getline(m_infile, line))
+            return false;
+
+        if (!line.empty() && ('\r' == line.back()))
+            line.pop_back();
+    }
+
+    std::vector<std::string> tokens;
+    std::string::size_type tokenStart(0);
+
+    for (std::string::size_type delimiterPosition = line.find(','); std::string::npos != delimiterPosition; delimiterPosition = line.find(',', tokenStart))
+    {
+        tokens.push_back(line.substr(tokenStart, delimiterPosition - tokenStart));
+        tokenStart = delimiterPosition + 1;
+    }
+
+    tokens.push_back(line.substr(tokenStart));
+
+    if (tokens.size() < 2)
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    if ((tokens.back() != "0") && (tokens.back() != "1"))
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    timestamp = tokens.front();
+    result = (tokens.back() == "1");
+
+    for (unsigned int iToken = 1; iToken + 1 < tokens.size(); ++iToken)
+    {
+        // ATTN strtod, unlike stream extraction, parses the nan and inf values written by stream insertion
+        const char *const pToken(tokens.at(iToken).c_str());
+        char *pEnd(nullptr);
+        const double value(std::strtod(pToken, &pEnd));
+
+        if ((pEnd == pToken) || (*pEnd != '\0'))
+            throw StatusCodeException(STATUS_CODE_FAILURE);
+
+        featureVector.push_back(value);
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArTrainingExampleReader::ReadBinaryExample(std::string &timestamp, bool &result, MvaTypes::MvaFeatureVector &featureVector)
+{
+    if ((m_blockPosition >= m_nBlockExamples) && !this->ReadBlock())
+        return false;
+
+    timestamp = LArTrainingExampleWriter::GetTimestampString(static_cast<std::time_t>(m_blockTimestamps.at(m_blockPosition)));
+    result = (0 != m_blockResults.at(m_blockPosition));
+
+    for (unsigned int iFeature = 0; iFeature < m_nBlockFeatures; ++iFeature)
+        featureVector.push_back(m_blockFeatures.at(iFeature * m_nBlockExamples + m_blockPosition));
+
+    ++m_blockPosition;
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool LArTrainingExampleReader::ReadBlock()
+{
+    std::uint32_t nExamples(0), nFeatures(0);
+
+    if (!LArTrainingExampleWriter::ReadValues(m_infile, &nExamples, 1))
+    {
+        if (0 != m_infile.gcount())
+            throw StatusCodeException(STATUS_CODE_FAILURE);
+
+        return false;
+    }
+
+    if (!LArTrainingExampleWriter::ReadValues(m_infile, &nFeatures, 1) || (0 == nExamples))
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+
+    m_blockTimestamps.resize(nExamples);
+    m_blockResults.resize(nExamples);
+    m_blockFeatures.resize(static_cast<std::size_t>(nExamples) * nFeatures);
+
+    if (!LArTrainingExampleWriter::ReadValues(m_infile, m_blockTimestamps.data(), nExamples) ||
+        !LArTrainingExampleWriter::ReadValues(m_infile, m_blockResults.data(), nExamples) ||
+        !LArTrainingExampleWriter::ReadValues(m_infile, m_blockFeatures.data(), m_blockFeatures.size()))
+    {
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+    }
+
+    m_nBlockExamples = nExamples;
+    m_nBlockFeatures = nFeatures;
+    m_blockPosition = 0;
+
+    return true;
+}
+
+} // namespace lar_content
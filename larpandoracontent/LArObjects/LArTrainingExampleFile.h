@@ -0,0 +1,310 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArTrainingExampleFile.h
+ *
+ *  @brief  Header file for the lar training example file writer and reader classes.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_TRAINING_EXAMPLE_FILE_H
+#define LAR_TRAINING_EXAMPLE_FILE_H 1
+
+#include "larpandoracontent/LArObjects/LArMvaInterface.h"
+
+#include "Pandora/StatusCodes.h"
+
+#include <cstdint>
+#include <ctime>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArTrainingExampleWriter class, a persistent and buffered writer of mva training examples. Writers are held in a process-wide
+ *          registry, one per output file, so that each file is opened once and examples are appended to it until the writers are closed.
+ *          Users of the writers should call FlushAll at the end of each event and Close for each file they have written at teardown, so that
+ *          at most one event of examples is lost if the process terminates abnormally.
+ *
+ *          The text format has one delimited line per example: the timestamp, each feature and the integer result. The binary format has a
+ *          file header followed by blocks of examples, with each block holding its example count, its feature count, then the columns of
+ *          timestamps (int64, seconds since epoch), results (uint8) and each feature in turn (double), in native byte order.
+ */
+class LArTrainingExampleWriter
+{
+public:
+    /**
+     *  @brief  Format enum
+     */
+    enum Format
+    {
+        TEXT,           ///< Delimited text, one example per line
+        BINARY          ///< Binary, with examples stored in blocks of feature columns
+    };
+
+    /**
+     *  @brief  Append a training example to a file, opening the file on first use
+     *
+     *  @param  fileName the name of the file to which to append the example
+     *  @param  format the format of the file
+     *  @param  timestamp the timestamp of the example
+     *  @param  result the result (class) of the example
+     *  @param  featureVector the features of the example
+     *
+     *  @return success, or failure if the file cannot be opened, holds examples in another format, or has already been opened in another format
+     */
+    static pandora::StatusCode WriteExample(const std::string &fileName, const Format format, const std::time_t timestamp, const bool result,
+        const MvaTypes::MvaFeatureVector &featureVector);
+
+    /**
+     *  @brief  Flush all buffered examples to their files, keeping the files open; to be called at the end of each event
+     */
+    static void FlushAll();
+
+    /**
+     *  @brief  Flush any buffered examples to a file and close the file, if open; to be called at teardown for each file written. Any
+     *          subsequent examples, e.g. from another user of the same file, reopen the file in append mode.
+     *
+     *  @param  fileName the name of the file to close
+     */
+    static void Close(const std::string &fileName);
+
+    /**
+     *  @brief  Get the text timestamp string for a given time, as written to the text format
+     *
+     *  @param  timestamp the time
+     *
+     *  @return the timestamp string
+     */
+    static std::string GetTimestampString(const std::time_t timestamp);
+
+    /**
+     *  @brief  Destructor, flushing any buffered examples
+     */
+    ~LArTrainingExampleWriter();
+
+private:
+    /**
+     *  @brief  Constructor, opening the file in append mode
+     *
+     *  @param  fileName the file name
+     *  @param  format the format
+     */
+    LArTrainingExampleWriter(const std::string &fileName, const Format format);
+
+    typedef std::unordered_map<std::string, std::unique_ptr<LArTrainingExampleWriter> > WriterMap;
+
+    /**
+     *  @brief  WriterRegistry class
+     */
+    class WriterRegistry
+    {
+    public:
+        std::mutex              m_mutex;                    ///< The mutex protecting the writer map and all writers
+        WriterMap               m_writerMap;                ///< The map from file name to writer
+    };
+
+    /**
+     *  @brief  Get the process-wide writer registry
+     *
+     *  @return the writer registry
+     */
+    static WriterRegistry &GetWriterRegistry();
+
+    /**
+     *  @brief  Get the writer for a file, creating it if necessary; the registry mutex must be held by the caller
+     *
+     *  @param  fileName the file name
+     *  @param  format the format
+     *  @param  pWriter to receive the address of the writer
+     *
+     *  @return success, or failure if the writer could not be created or has another format
+     */
+    static pandora::StatusCode GetWriter(const std::string &fileName, const Format format, LArTrainingExampleWriter *&pWriter);
+
+    /**
+     *  @brief  Read and check the binary file header at the current position of a file stream
+     *
+     *  @param  stream the file stream
+     *
+     *  @return success, not found if there is no binary file identifier, or invalid parameter for an unsupported version or byte order
+     */
+    static pandora::StatusCode ReadBinaryHeader(std::ifstream &stream);
+
+    /**
+     *  @brief  Write raw values to a file stream
+     *
+     *  @param  stream the file stream
+     *  @param  pValues address of the first value
+     *  @param  nValues the number of values
+     */
+    template <typename T>
+    static void WriteValues(std::ofstream &stream, const T *const pValues, const std::size_t nValues);
+
+    /**
+     *  @brief  Read raw values from a file stream
+     *
+     *  @param  stream the file stream
+     *  @param  pValues address of the first value to receive
+     *  @param  nValues the number of values
+     *
+     *  @return whether all values were read
+     */
+    template <typename T>
+    static bool ReadValues(std::ifstream &stream, T *const pValues, const std::size_t nValues);
+
+    /**
+     *  @brief  Append a training example
+     *
+     *  @param  timestamp the timestamp of the example
+     *  @param  result the result of the example
+     *  @param  featureVector the features of the example
+     */
+    void Write(const std::time_t timestamp, const bool result, const MvaTypes::MvaFeatureVector &featureVector);
+
+    /**
+     *  @brief  Write any buffered binary block and flush the file
+     */
+    void Flush();
+
+    /**
+     *  @brief  Write the buffered binary block, if any, to the file
+     */
+    void WriteBlock();
+
+    typedef std::vector<std::int64_t> TimestampVector;
+    typedef std::vector<unsigned char> ResultVector;
+    typedef std::vector<double> FeatureVector;
+
+    static const char           m_binaryIdentifier[8];      ///< The identifier at the start of a binary file
+    static const std::uint32_t  m_binaryVersion;            ///< The binary format version
+    static const std::uint32_t  m_binaryByteOrderMark;      ///< The byte order mark, written in native byte order
+    static const unsigned int   m_streamBufferSize;         ///< The size of the file stream buffer
+    static const unsigned int   m_maxBlockSize;             ///< The maximum number of examples in a binary block
+
+    Format                      m_format;                   ///< The format
+    bool                        m_isOpen;                   ///< Whether the file was opened successfully, and holds examples in this format
+    std::unique_ptr<char[]>     m_pStreamBuffer;            ///< The file stream buffer
+    std::ofstream               m_outfile;                  ///< The output file stream
+    std::time_t                 m_lastTimestamp;            ///< The last timestamp formatted for the text format
+    std::string                 m_lastTimestampString;      ///< The formatted last timestamp
+    unsigned int                m_nBlockFeatures;           ///< The number of features per example in the buffered binary block
+    TimestampVector             m_blockTimestamps;          ///< The timestamps in the buffered binary block
+    ResultVector                m_blockResults;             ///< The results in the buffered binary block
+    FeatureVector               m_blockFeatures;            ///< The features in the buffered binary block, example by example
+
+    friend class LArTrainingExampleReader;
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  LArTrainingExampleReader class, reading training examples written in either format by LArTrainingExampleWriter
+ */
+class LArTrainingExampleReader
+{
+public:
+    /**
+     *  @brief  Constructor, opening the file and identifying its format
+     *
+     *  @param  fileName the file name
+     *
+     *  @throw  StatusCodeException, if the file cannot be opened or has an unsupported binary header
+     */
+    LArTrainingExampleReader(const std::string &fileName);
+
+    /**
+     *  @brief  Get the format of the file
+     *
+     *  @return the format
+     */
+    LArTrainingExampleWriter::Format GetFormat() const;
+
+    /**
+     *  @brief  Read the next training example. Binary timestamps are converted to the text timestamp string in the local time zone.
+     *
+     *  @param  timestamp to receive the timestamp string
+     *  @param  result to receive the result
+     *  @param  featureVector to receive the features
+     *
+     *  @return whether an example was read, false at the end of the file
+     *
+     *  @throw  StatusCodeException, if the file is malformed
+     */
+    bool ReadExample(std::string &timestamp, bool &result, MvaTypes::MvaFeatureVector &featureVector);
+
+private:
+    /**
+     *  @brief  Read the next text example
+     *
+     *  @param  timestamp to receive the timestamp string
+     *  @param  result to receive the result
+     *  @param  featureVector to receive the features
+     *
+     *  @return whether an example was read
+     */
+    bool ReadTextExample(std::string &timestamp, bool &result, MvaTypes::MvaFeatureVector &featureVector);
+
+    /**
+     *  @brief  Read the next binary example
+     *
+     *  @param  timestamp to receive the timestamp string
+     *  @param  result to receive the result
+     *  @param  featureVector to receive the features
+     *
+     *  @return whether an example was read
+     */
+    bool ReadBinaryExample(std::string &timestamp, bool &result, MvaTypes::MvaFeatureVector &featureVector);
+
+    /**
+     *  @brief  Read the next binary block
+     *
+     *  @return whether a block was read, false at the end of the file
+     */
+    bool ReadBlock();
+
+    typedef std::vector<std::int64_t> TimestampVector;
+    typedef std::vector<unsigned char> ResultVector;
+    typedef std::vector<double> FeatureVector;
+
+    LArTrainingExampleWriter::Format    m_format;               ///< The format
+    std::ifstream                       m_infile;               ///< The input file stream
+    unsigned int                        m_nBlockExamples;       ///< The number of examples in the current binary block
+    unsigned int                        m_nBlockFeatures;       ///< The number of features per example in the current binary block
+    unsigned int                        m_blockPosition;        ///< The index of the next example to read from the current binary block
+    TimestampVector                     m_blockTimestamps;      ///< The timestamps in the current binary block
+    ResultVector                        m_blockResults;         ///< The results in the current binary block
+    FeatureVector                       m_blockFeatures;        ///< The features in the current binary block, feature column by column
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void LArTrainingExampleWriter::WriteValues(std::ofstream &stream, const T *const pValues, const std::size_t nValues)
+{
+    stream.write(reinterpret_cast<const char*>(pValues), nValues * sizeof(T));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline bool LArTrainingExampleWriter::ReadValues(std::ifstream &stream, T *const pValues, const std::size_t nValues)
+{
+    stream.read(reinterpret_cast<char*>(pValues), nValues * sizeof(T));
+    return (static_cast<std::size_t>(stream.gcount()) == nValues * sizeof(T));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline LArTrainingExampleWriter::Format LArTrainingExampleReader::GetFormat() const
+{
+    return m_format;
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_TRAINING_EXAMPLE_FILE_H
@@ -0,0 +1,120 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArTwoDSlidingFitCache.cc
+ *
+ *  @brief  Implementation of the lar two dimensional sliding fit cache class.
+ *
+ *  $Log: $
+ */
+
+#include "Objects/Cluster.h"
+
+#include "larpandoracontent/LArObjects/LArTwoDSlidingFitCache.h"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+using namespace pandora;
+
+namespace lar_content
+{
+
+std::shared_ptr<LArTwoDSlidingFitCache> LArTwoDSlidingFitCache::GetSharedInstance(const Pandora &pandora)
+{
+    // ATTN Registry holds weak references only, so that caches are owned (and destroyed) by their holders rather than by static storage
+    typedef std::unordered_map<const Pandora*, std::weak_ptr<LArTwoDSlidingFitCache> > InstanceMap;
+
+    static std::mutex instanceMutex;
+    static InstanceMap instanceMap;
+
+    std::lock_guard<std::mutex> lock(instanceMutex);
+
+    for (InstanceMap::iterator iter = instanceMap.begin(); iter != instanceMap.end(); )
+        iter = (iter->second.expired() ? instanceMap.erase(iter) : std::next(iter));
+
+    std::weak_ptr<LArTwoDSlidingFitCache> &weakInstance(instanceMap[&pandora]);
+    std::shared_ptr<LArTwoDSlidingFitCache> pInstance(weakInstance.lock());
+
+    if (!pInstance)
+    {
+        pInstance.reset(new LArTwoDSlidingFitCache);
+        weakInstance = pInstance;
+    }
+
+    return pInstance;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArTwoDSlidingFitCache::TwoDSlidingFitResultPtr LArTwoDSlidingFitCache::GetSlidingFitResult(const Cluster *const pCluster,
+    const unsigned int layerFitHalfWindow, const float layerPitch)
+{
+    const CacheKey cacheKey(pCluster, layerFitHalfWindow, layerPitch);
+    const ClusterHits clusterHits(pCluster);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        CacheMap::const_iterator iter(m_cacheMap.find(cacheKey));
+
+        if ((m_cacheMap.end() != iter) && (iter->second.m_clusterHits == clusterHits))
+            return iter->second.m_fitResultPtr;
+    }
+
+    // Fit outside the lock, so that fits for different clusters can proceed concurrently
+    const TwoDSlidingFitResultPtr fitResultPtr(std::make_shared<TwoDSlidingFitResult>(pCluster, layerFitHalfWindow, layerPitch));
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    CacheMap::iterator iter(m_cacheMap.find(cacheKey));
+
+    if (m_cacheMap.end() != iter)
+    {
+        iter->second = CacheEntry(clusterHits, fitResultPtr);
+    }
+    else
+    {
+        m_cacheMap.insert(CacheMap::value_type(cacheKey, CacheEntry(clusterHits, fitResultPtr)));
+    }
+
+    return fitResultPtr;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArTwoDSlidingFitCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_cacheMap.clear();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArTwoDSlidingFitCache::LArTwoDSlidingFitCache()
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+std::size_t LArTwoDSlidingFitCache::CacheKeyHasher::operator()(const CacheKey &cacheKey) const
+{
+    const std::size_t clusterHash(std::hash<const Cluster*>()(cacheKey.m_pCluster));
+    const std::size_t halfWindowHash(std::hash<unsigned int>()(cacheKey.m_layerFitHalfWindow));
+    const std::size_t layerPitchHash(std::hash<float>()(cacheKey.m_layerPitch));
+
+    return (clusterHash ^ (halfWindowHash << 1) ^ (layerPitchHash << 2));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+LArTwoDSlidingFitCache::ClusterHits::ClusterHits(const Cluster *const pCluster)
+{
+    // ATTN Sliding fits use only the ordered calo hit list; isolated hits do not contribute
+    const OrderedCaloHitList &orderedCaloHitList(pCluster->GetOrderedCaloHitList());
+    m_caloHits.reserve(pCluster->GetNCaloHits());
+
+    for (const OrderedCaloHitList::value_type &layerEntry : orderedCaloHitList)
+        m_caloHits.insert(m_caloHits.end(), layerEntry.second->begin(), layerEntry.second->end());
+
+    std::sort(m_caloHits.begin(), m_caloHits.end());
+}
+
+} // namespace lar_content
@@ -0,0 +1,204 @@
+/**
+ *  @file   larpandoracontent/LArObjects/LArTwoDSlidingFitCache.h
+ *
+ *  @brief  Header file for the lar two dimensional sliding fit cache class.
+ *
+ *  $Log: $
+ */
+#ifndef LAR_TWO_D_SLIDING_FIT_CACHE_H
+#define LAR_TWO_D_SLIDING_FIT_CACHE_H 1
+
+#include "Pandora/PandoraInternal.h"
+
+#include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace pandora {class Pandora;}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+namespace lar_content
+{
+
+/**
+ *  @brief  LArTwoDSlidingFitCache class, an event-scoped store of cluster sliding fit results shared by the algorithms of a pandora instance.
+ *          Results are keyed by cluster, layer fit half window and layer pitch. Each result records the calo hits in the cluster when it was
+ *          fitted and is refitted on request if the cluster hits have changed, e.g. because the cluster has been modified, merged, or deleted
+ *          and its address reused.
+ */
+class LArTwoDSlidingFitCache
+{
+public:
+    typedef std::shared_ptr<const TwoDSlidingFitResult> TwoDSlidingFitResultPtr;
+    typedef std::unordered_map<const pandora::Cluster*, TwoDSlidingFitResultPtr> TwoDSlidingFitResultPtrMap;
+
+    /**
+     *  @brief  Get the sliding fit cache for a pandora instance, shared by all current holders and created if there are none. The cache is
+     *          destroyed when the last holder releases it, so holders should be owned by the pandora instance (e.g. algorithms, acquiring the
+     *          cache in Initialize) to ensure that a later pandora instance at the same address cannot receive stale entries.
+     *
+     *  @param  pandora the pandora instance
+     *
+     *  @return the sliding fit cache
+     */
+    static std::shared_ptr<LArTwoDSlidingFitCache> GetSharedInstance(const pandora::Pandora &pandora);
+
+    /**
+     *  @brief  Get the sliding fit result for a cluster, fitting the cluster if there is no valid cached result; may be called concurrently
+     *          from multiple threads. The result remains valid for as long as the returned pointer is held, even if the cache is cleared.
+     *
+     *  @param  pCluster address of the cluster
+     *  @param  layerFitHalfWindow the layer fit half window
+     *  @param  layerPitch the layer pitch, units cm
+     *
+     *  @return the sliding fit result
+     *
+     *  @throw  StatusCodeException, if the cluster cannot be fitted
+     */
+    TwoDSlidingFitResultPtr GetSlidingFitResult(const pandora::Cluster *const pCluster, const unsigned int layerFitHalfWindow, const float layerPitch);
+
+    /**
+     *  @brief  Clear all cached results, in preparation for the next event
+     */
+    void Clear();
+
+private:
+    /**
+     *  @brief  Default constructor
+     */
+    LArTwoDSlidingFitCache();
+
+    /**
+     *  @brief  CacheKey class
+     */
+    class CacheKey
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pCluster address of the cluster
+         *  @param  layerFitHalfWindow the layer fit half window
+         *  @param  layerPitch the layer pitch, units cm
+         */
+        CacheKey(const pandora::Cluster *const pCluster, const unsigned int layerFitHalfWindow, const float layerPitch);
+
+        /**
+         *  @brief  Equality operator
+         *
+         *  @param  rhs the cache key for comparison
+         *
+         *  @return whether the cache keys are equal
+         */
+        bool operator==(const CacheKey &rhs) const;
+
+        const pandora::Cluster     *m_pCluster;             ///< The address of the cluster
+        unsigned int                m_layerFitHalfWindow;   ///< The layer fit half window
+        float                       m_layerPitch;           ///< The layer pitch, units cm
+    };
+
+    /**
+     *  @brief  CacheKeyHasher class
+     */
+    class CacheKeyHasher
+    {
+    public:
+        /**
+         *  @brief  Get the hash of a cache key
+         *
+         *  @param  cacheKey the cache key
+         *
+         *  @return the hash
+         */
+        std::size_t operator()(const CacheKey &cacheKey) const;
+    };
+
+    typedef std::vector<const pandora::CaloHit*> CaloHitAddressVector;
+
+    /**
+     *  @brief  ClusterHits class, recording exactly which calo hits a cluster contains, independent of the order in which they were added
+     */
+    class ClusterHits
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pCluster address of the cluster
+         */
+        ClusterHits(const pandora::Cluster *const pCluster);
+
+        /**
+         *  @brief  Equality operator
+         *
+         *  @param  rhs the cluster hits for comparison
+         *
+         *  @return whether the cluster hits are identical
+         */
+        bool operator==(const ClusterHits &rhs) const;
+
+        CaloHitAddressVector        m_caloHits;             ///< The addresses of the calo hits in the cluster, sorted by address
+    };
+
+    /**
+     *  @brief  CacheEntry class
+     */
+    class CacheEntry
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  clusterHits the cluster hits when fitted
+         *  @param  fitResultPtr the sliding fit result
+         */
+        CacheEntry(const ClusterHits &clusterHits, const TwoDSlidingFitResultPtr &fitResultPtr);
+
+        ClusterHits                 m_clusterHits;          ///< The cluster hits when fitted
+        TwoDSlidingFitResultPtr     m_fitResultPtr;         ///< The sliding fit result
+    };
+
+    typedef std::unordered_map<CacheKey, CacheEntry, CacheKeyHasher> CacheMap;
+
+    std::mutex              m_mutex;                        ///< The mutex protecting the cache map
+    CacheMap                m_cacheMap;                     ///< The cache map
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline LArTwoDSlidingFitCache::CacheKey::CacheKey(const pandora::Cluster *const pCluster, const unsigned int layerFitHalfWindow, const float layerPitch) :
+    m_pCluster(pCluster),
+    m_layerFitHalfWindow(layerFitHalfWindow),
+    m_layerPitch(layerPitch)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool LArTwoDSlidingFitCache::CacheKey::operator==(const CacheKey &rhs) const
+{
+    return ((m_pCluster == rhs.m_pCluster) && (m_layerFitHalfWindow == rhs.m_layerFitHalfWindow) && (m_layerPitch == rhs.m_layerPitch));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool LArTwoDSlidingFitCache::ClusterHits::operator==(const ClusterHits &rhs) const
+{
+    return (m_caloHits == rhs.m_caloHits);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline LArTwoDSlidingFitCache::CacheEntry::CacheEntry(const ClusterHits &clusterHits, const TwoDSlidingFitResultPtr &fitResultPtr) :
+    m_clusterHits(clusterHits),
+    m_fitResultPtr(fitResultPtr)
+{
+}
+
+} // namespace lar_content
+
+#endif // #ifndef LAR_TWO_D_SLIDING_FIT_CACHE_H
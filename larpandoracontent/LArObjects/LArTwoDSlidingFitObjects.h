@@ -81,7 +81,57 @@ private:
     double          m_rms;                                  ///< The rms of the fit residuals
 };
 
-typedef std::map<int, LayerFitResult> LayerFitResultMap;
+/**
+ *  @brief  LayerFitResultMap class, flat storage for the layer fit results of a sliding fit, ordered by layer. The std::map style accessors
+ *          used by clients are provided, whilst lookups by layer use a table indexed by the layer offset from the min layer.
+ */
+class LayerFitResultMap
+{
+public:
+    typedef std::pair<int, LayerFitResult> value_type;
+    typedef std::vector<value_type>::const_iterator const_iterator;
+    typedef std::vector<value_type>::const_reverse_iterator const_reverse_iterator;
+
+    /**
+     *  @brief  Append the fit result for a layer above all layers already present
+     *
+     *  @param  layer the layer
+     *  @param  layerFitResult the layer fit result
+     */
+    void Append(const int layer, const LayerFitResult &layerFitResult);
+
+    /**
+     *  @brief  Find the fit result for a specified layer, in constant time
+     *
+     *  @param  layer the layer
+     *
+     *  @return the iterator for the layer fit result, or the end iterator if the layer has no fit result
+     */
+    const_iterator find(const int layer) const;
+
+    /**
+     *  @brief  Find the fit result for the highest layer with a fit result at or below a specified layer, in constant time
+     *
+     *  @param  layer the layer, which must lie between the min and max layers
+     *
+     *  @return the iterator for the layer fit result
+     */
+    const_iterator FindAtOrBelow(const int layer) const;
+
+    const_iterator begin() const;
+    const_iterator end() const;
+    const_reverse_iterator rbegin() const;
+    const_reverse_iterator rend() const;
+    bool empty() const;
+    std::size_t size() const;
+
+private:
+    typedef std::vector<value_type> LayerFitResultVector;
+    typedef std::vector<unsigned int> IndexVector;
+
+    LayerFitResultVector    m_layerFitResults;      ///< The layer fit results, ordered by layer
+    IndexVector             m_atOrBelowIndices;     ///< Index of highest fit result at or below each layer, indexed by offset from min layer
+};
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -104,6 +154,14 @@ public:
      */
     void AddPoint(const float l, const float t);
 
+    /**
+     *  @brief  Remove a point, previously added, from layer fit
+     *
+     *  @param  l the longitudinal coordinate
+     *  @param  t the transverse coordinate
+     */
+    void RemovePoint(const float l, const float t);
+
     /**
      *  @brief  Get the sum t
      *
@@ -331,6 +389,85 @@ inline double LayerFitResult::GetRms() const
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline void LayerFitResultMap::Append(const int layer, const LayerFitResult &layerFitResult)
+{
+    if (!m_layerFitResults.empty() && (layer <= m_layerFitResults.back().first))
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+
+    // Layers between the previous max layer and the new layer have no fit result, so refer to the previous max layer
+    if (!m_layerFitResults.empty())
+        m_atOrBelowIndices.insert(m_atOrBelowIndices.end(), layer - m_layerFitResults.back().first - 1, m_layerFitResults.size() - 1);
+
+    m_atOrBelowIndices.push_back(m_layerFitResults.size());
+    m_layerFitResults.push_back(value_type(layer, layerFitResult));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline LayerFitResultMap::const_iterator LayerFitResultMap::find(const int layer) const
+{
+    if (m_layerFitResults.empty() || (layer < m_layerFitResults.front().first) || (layer > m_layerFitResults.back().first))
+        return m_layerFitResults.end();
+
+    const const_iterator iter(this->FindAtOrBelow(layer));
+    return ((layer == iter->first) ? iter : m_layerFitResults.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline LayerFitResultMap::const_iterator LayerFitResultMap::FindAtOrBelow(const int layer) const
+{
+    if (m_layerFitResults.empty())
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_INITIALIZED);
+
+    return (m_layerFitResults.begin() + m_atOrBelowIndices.at(layer - m_layerFitResults.front().first));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline LayerFitResultMap::const_iterator LayerFitResultMap::begin() const
+{
+    return m_layerFitResults.begin();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline LayerFitResultMap::const_iterator LayerFitResultMap::end() const
+{
+    return m_layerFitResults.end();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline LayerFitResultMap::const_reverse_iterator LayerFitResultMap::rbegin() const
+{
+    return m_layerFitResults.rbegin();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline LayerFitResultMap::const_reverse_iterator LayerFitResultMap::rend() const
+{
+    return m_layerFitResults.rend();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline bool LayerFitResultMap::empty() const
+{
+    return m_layerFitResults.empty();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline std::size_t LayerFitResultMap::size() const
+{
+    return m_layerFitResults.size();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline LayerFitContribution::LayerFitContribution() :
     m_sumT(0.),
     m_sumL(0.),
@@ -358,6 +495,24 @@ inline void LayerFitContribution::AddPoint(const float l, const float t)
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline void LayerFitContribution::RemovePoint(const float l, const float t)
+{
+    if (0 == m_nPoints)
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_FOUND);
+
+    const double T = static_cast<double>(t);
+    const double L = static_cast<double>(l);
+
+    m_sumT -= T;
+    m_sumL -= L;
+    m_sumTT -= T * T;
+    m_sumLT -= L * T;
+    m_sumLL -= L * L;
+    --m_nPoints;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline double LayerFitContribution::GetSumT() const
 {
     return m_sumT;
@@ -14,7 +14,9 @@
 
 #include <algorithm>
 #include <cmath>
+#include <iterator>
 #include <limits>
+#include <vector>
 
 using namespace pandora;
 
@@ -106,6 +108,44 @@ TwoDSlidingFitResult::TwoDSlidingFitResult(const unsigned int layerFitHalfWindow
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+TwoDSlidingFitResult::TwoDSlidingFitResult(const Cluster *const pCluster, const TwoDSlidingFitResult &fitResult, const CartesianPointVector &addedPointVector,
+        const CartesianPointVector &removedPointVector) :
+    m_pCluster(pCluster),
+    m_layerFitHalfWindow(fitResult.m_layerFitHalfWindow),
+    m_layerPitch(fitResult.m_layerPitch),
+    m_axisIntercept(fitResult.m_axisIntercept),
+    m_axisDirection(fitResult.m_axisDirection),
+    m_orthoDirection(fitResult.m_orthoDirection),
+    m_layerFitContributionMap(fitResult.m_layerFitContributionMap)
+{
+    for (const CartesianVector &addedPoint : addedPointVector)
+    {
+        float rL(0.f), rT(0.f);
+        this->GetLocalPosition(addedPoint, rL, rT);
+        m_layerFitContributionMap[this->GetLayer(rL)].AddPoint(rL, rT);
+    }
+
+    for (const CartesianVector &removedPoint : removedPointVector)
+    {
+        float rL(0.f), rT(0.f);
+        this->GetLocalPosition(removedPoint, rL, rT);
+        LayerFitContributionMap::iterator iter(m_layerFitContributionMap.find(this->GetLayer(rL)));
+
+        if (m_layerFitContributionMap.end() == iter)
+            throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+        iter->second.RemovePoint(rL, rT);
+
+        if (0 == iter->second.GetNPoints())
+            m_layerFitContributionMap.erase(iter);
+    }
+
+    this->PerformSlidingLinearFit();
+    this->FindSlidingFitSegments();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 const pandora::Cluster *TwoDSlidingFitResult::GetCluster() const
 {
     if (!m_pCluster)
@@ -430,6 +470,42 @@ StatusCode TwoDSlidingFitResult::GetTransverseProjection(const float x, const Fi
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void TwoDSlidingFitResult::GetTransverseProjections(const FloatVector &xList, const FitSegment &fitSegment, CartesianPointVector &positionList,
+    CartesianPointVector &directionList, std::vector<bool> &isProjectedList) const
+{
+    positionList.assign(xList.size(), CartesianVector(0.f, 0.f, 0.f));
+    directionList.assign(xList.size(), CartesianVector(0.f, 0.f, 0.f));
+    isProjectedList.assign(xList.size(), false);
+
+    LayerFitResultMap::const_iterator minLayerIter, maxLayerIter;
+    CartesianVector minPosition(0.f, 0.f, 0.f), maxPosition(0.f, 0.f, 0.f);
+
+    if (STATUS_CODE_SUCCESS != this->GetTransverseBoundingLayers(fitSegment.GetStartLayer(), fitSegment.GetEndLayer(), minLayerIter, maxLayerIter,
+        minPosition, maxPosition))
+    {
+        return;
+    }
+
+    for (unsigned int index = 0, indexEnd = xList.size(); index < indexEnd; ++index)
+    {
+        const float x(xList[index]);
+        LayerFitResultMap::const_iterator firstLayerIter, secondLayerIter;
+
+        if (STATUS_CODE_SUCCESS != this->GetTransverseSurroundingLayers(x, minLayerIter, maxLayerIter, minPosition, maxPosition, firstLayerIter, secondLayerIter))
+            continue;
+
+        double firstWeight(0.), secondWeight(0.);
+        this->GetTransverseInterpolationWeights(x, firstLayerIter, secondLayerIter, firstWeight, secondWeight);
+        const LayerInterpolation layerInterpolation(firstLayerIter, secondLayerIter, firstWeight, secondWeight);
+
+        positionList[index] = this->GetGlobalFitPosition(layerInterpolation);
+        directionList[index] = this->GetGlobalFitDirection(layerInterpolation);
+        isProjectedList[index] = true;
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TwoDSlidingFitResult::GetExtrapolatedPosition(const float rL, CartesianVector &position) const
 {
     const StatusCode statusCode(this->GetGlobalFitPosition(rL, position));
@@ -620,51 +696,59 @@ void TwoDSlidingFitResult::PerformSlidingLinearFit()
 
     const LayerFitContributionMap &layerFitContributionMap(this->GetLayerFitContributionMap());
     const int innerLayer(layerFitContributionMap.begin()->first);
+    const int outerLayer(layerFitContributionMap.rbegin()->first);
     const int layerFitHalfWindow(static_cast<int>(this->GetLayerFitHalfWindow()));
 
+    // Flat lookup of layer contributions, indexed by layer offset from the inner layer, to avoid repeated map searches in the sliding window
+    std::vector<const LayerFitContribution*> contributionLookup(outerLayer - innerLayer + 1, nullptr);
+
+    for (const LayerFitContributionMap::value_type &mapEntry : layerFitContributionMap)
+        contributionLookup.at(mapEntry.first - innerLayer) = &mapEntry.second;
+
+    auto getContribution = [&](const int layer) -> const LayerFitContribution*
+    {
+        return (((layer < innerLayer) || (layer > outerLayer)) ? nullptr : contributionLookup[layer - innerLayer]);
+    };
+
     for (int iLayer = innerLayer; iLayer < innerLayer + layerFitHalfWindow; ++iLayer)
     {
-        LayerFitContributionMap::const_iterator lyrIter = layerFitContributionMap.find(iLayer);
+        const LayerFitContribution *const pContribution(getContribution(iLayer));
 
-        if (layerFitContributionMap.end() != lyrIter)
+        if (pContribution)
         {
-            slidingSumT += lyrIter->second.GetSumT();
-            slidingSumL += lyrIter->second.GetSumL();
-            slidingSumTT += lyrIter->second.GetSumTT();
-            slidingSumLT += lyrIter->second.GetSumLT();
-            slidingSumLL += lyrIter->second.GetSumLL();
-            slidingNPoints += lyrIter->second.GetNPoints();
+            slidingSumT += pContribution->GetSumT();
+            slidingSumL += pContribution->GetSumL();
+            slidingSumTT += pContribution->GetSumTT();
+            slidingSumLT += pContribution->GetSumLT();
+            slidingSumLL += pContribution->GetSumLL();
+            slidingNPoints += pContribution->GetNPoints();
         }
     }
 
-    const int outerLayer(layerFitContributionMap.rbegin()->first);
-
     for (int iLayer = innerLayer; iLayer <= outerLayer; ++iLayer)
     {
-        const int fwdLayer(iLayer + layerFitHalfWindow);
-        LayerFitContributionMap::const_iterator fwdIter = layerFitContributionMap.find(fwdLayer);
+        const LayerFitContribution *const pFwdContribution(getContribution(iLayer + layerFitHalfWindow));
 
-        if (layerFitContributionMap.end() != fwdIter)
+        if (pFwdContribution)
         {
-            slidingSumT += fwdIter->second.GetSumT();
-            slidingSumL += fwdIter->second.GetSumL();
-            slidingSumTT += fwdIter->second.GetSumTT();
-            slidingSumLT += fwdIter->second.GetSumLT();
-            slidingSumLL += fwdIter->second.GetSumLL();
-            slidingNPoints += fwdIter->second.GetNPoints();
+            slidingSumT += pFwdContribution->GetSumT();
+            slidingSumL += pFwdContribution->GetSumL();
+            slidingSumTT += pFwdContribution->GetSumTT();
+            slidingSumLT += pFwdContribution->GetSumLT();
+            slidingSumLL += pFwdContribution->GetSumLL();
+            slidingNPoints += pFwdContribution->GetNPoints();
         }
 
-        const int bwdLayer(iLayer - layerFitHalfWindow - 1);
-        LayerFitContributionMap::const_iterator bwdIter = layerFitContributionMap.find(bwdLayer);
+        const LayerFitContribution *const pBwdContribution(getContribution(iLayer - layerFitHalfWindow - 1));
 
-        if (layerFitContributionMap.end() != bwdIter)
+        if (pBwdContribution)
         {
-            slidingSumT -= bwdIter->second.GetSumT();
-            slidingSumL -= bwdIter->second.GetSumL();
-            slidingSumTT -= bwdIter->second.GetSumTT();
-            slidingSumLT -= bwdIter->second.GetSumLT();
-            slidingSumLL -= bwdIter->second.GetSumLL();
-            slidingNPoints -= bwdIter->second.GetNPoints();
+            slidingSumT -= pBwdContribution->GetSumT();
+            slidingSumL -= pBwdContribution->GetSumL();
+            slidingSumTT -= pBwdContribution->GetSumTT();
+            slidingSumLT -= pBwdContribution->GetSumLT();
+            slidingSumLL -= pBwdContribution->GetSumLL();
+            slidingNPoints -= pBwdContribution->GetNPoints();
         }
 
         // require three points for meaningful results
@@ -672,7 +756,7 @@ void TwoDSlidingFitResult::PerformSlidingLinearFit()
             continue;
 
         // only fill the result map if there is an entry in the contribution map
-        if (layerFitContributionMap.end() == layerFitContributionMap.find(iLayer))
+        if (!getContribution(iLayer))
             continue;
 
         const double denominator(slidingSumLL - slidingSumL * slidingSumL / static_cast<double>(slidingNPoints));
@@ -694,8 +778,9 @@ void TwoDSlidingFitResult::PerformSlidingLinearFit()
         const double l(this->GetL(iLayer));
         const double fitT(intercept + gradient * l);
 
+        // layers are visited in increasing order, so each new entry is appended after all existing entries
         const LayerFitResult layerFitResult(l, fitT, gradient, rms);
-        (void) m_layerFitResultMap.insert(LayerFitResultMap::value_type(iLayer, layerFitResult));
+        m_layerFitResultMap.Append(iLayer, layerFitResult);
     }
 
     if (m_layerFitResultMap.empty())
@@ -931,8 +1016,8 @@ StatusCode TwoDSlidingFitResult::GetLongitudinalSurroundingLayers(const float rL
     // Allow special case of single-layer sliding fit result
     if (minLayer == thisLayer && thisLayer == maxLayer)
     {
-        firstLayerIter = m_layerFitResultMap.find(minLayer);
-        secondLayerIter = m_layerFitResultMap.find(maxLayer);
+        firstLayerIter = m_layerFitResultMap.begin();
+        secondLayerIter = m_layerFitResultMap.begin();
         return STATUS_CODE_SUCCESS;
     }
 
@@ -942,30 +1027,9 @@ StatusCode TwoDSlidingFitResult::GetLongitudinalSurroundingLayers(const float rL
     if ((startLayer < minLayer) || (startLayer >= maxLayer))
         return STATUS_CODE_NOT_FOUND;
 
-    // First layer iterator
-    firstLayerIter = m_layerFitResultMap.end();
-
-    for (int iLayer = startLayer; iLayer >= minLayer; --iLayer)
-    {
-        firstLayerIter = m_layerFitResultMap.find(iLayer);
-
-        if (m_layerFitResultMap.end() != firstLayerIter)
-            break;
-    }
-
-    if (m_layerFitResultMap.end() == firstLayerIter)
-        return STATUS_CODE_NOT_FOUND;
-
-    // Second layer iterator
-    secondLayerIter = m_layerFitResultMap.end();
-
-    for (int iLayer = startLayer + 1; iLayer <= maxLayer; ++iLayer)
-    {
-        secondLayerIter = m_layerFitResultMap.find(iLayer);
-
-        if (m_layerFitResultMap.end() != secondLayerIter)
-            break;
-    }
+    // First layer iterator is the highest layer with a fit result at or below the start layer, second layer iterator is the next highest
+    firstLayerIter = m_layerFitResultMap.FindAtOrBelow(startLayer);
+    secondLayerIter = std::next(firstLayerIter);
 
     if (m_layerFitResultMap.end() == secondLayerIter)
         return STATUS_CODE_NOT_FOUND;
@@ -977,51 +1041,72 @@ StatusCode TwoDSlidingFitResult::GetLongitudinalSurroundingLayers(const float rL
 
 StatusCode TwoDSlidingFitResult::GetTransverseSurroundingLayers(const float x, const int minLayer, const int maxLayer,
     LayerFitResultMap::const_iterator &firstLayerIter, LayerFitResultMap::const_iterator &secondLayerIter) const
+{
+    LayerFitResultMap::const_iterator minLayerIter, maxLayerIter;
+    CartesianVector minPosition(0.f, 0.f, 0.f), maxPosition(0.f, 0.f, 0.f);
+
+    const StatusCode statusCode(this->GetTransverseBoundingLayers(minLayer, maxLayer, minLayerIter, maxLayerIter, minPosition, maxPosition));
+
+    if (STATUS_CODE_SUCCESS != statusCode)
+        return statusCode;
+
+    return this->GetTransverseSurroundingLayers(x, minLayerIter, maxLayerIter, minPosition, maxPosition, firstLayerIter, secondLayerIter);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode TwoDSlidingFitResult::GetTransverseBoundingLayers(const int minLayer, const int maxLayer, LayerFitResultMap::const_iterator &minLayerIter,
+    LayerFitResultMap::const_iterator &maxLayerIter, CartesianVector &minPosition, CartesianVector &maxPosition) const
 {
     if (m_layerFitResultMap.empty())
         throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
 
-    LayerFitResultMap::const_iterator minLayerIter = m_layerFitResultMap.find(minLayer);
+    minLayerIter = m_layerFitResultMap.find(minLayer);
     if (m_layerFitResultMap.end() == minLayerIter)
         throw StatusCodeException(STATUS_CODE_FAILURE);
 
-    LayerFitResultMap::const_iterator maxLayerIter = m_layerFitResultMap.find(maxLayer);
+    maxLayerIter = m_layerFitResultMap.find(maxLayer);
     if (m_layerFitResultMap.end() == maxLayerIter)
         throw StatusCodeException(STATUS_CODE_FAILURE);
 
-    CartesianVector minPosition(0.f, 0.f, 0.f), maxPosition(0.f, 0.f, 0.f);
     this->GetGlobalPosition(minLayerIter->second.GetL(), minLayerIter->second.GetFitT(), minPosition);
     this->GetGlobalPosition(maxLayerIter->second.GetL(), maxLayerIter->second.GetFitT(), maxPosition);
 
     if ((std::fabs(maxPosition.GetX() - minPosition.GetX()) < std::numeric_limits<float>::epsilon()))
         return STATUS_CODE_NOT_FOUND;
 
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode TwoDSlidingFitResult::GetTransverseSurroundingLayers(const float x, const LayerFitResultMap::const_iterator &minLayerIter,
+    const LayerFitResultMap::const_iterator &maxLayerIter, const CartesianVector &minPosition, const CartesianVector &maxPosition,
+    LayerFitResultMap::const_iterator &firstLayerIter, LayerFitResultMap::const_iterator &secondLayerIter) const
+{
+    const int minLayer(minLayerIter->first), maxLayer(maxLayerIter->first);
+
     // Find start layer
     const float minL(minLayerIter->second.GetL());
     const float maxL(maxLayerIter->second.GetL());
     const float startL(minL + (maxL - minL) * (x - minPosition.GetX()) / (maxPosition.GetX() - minPosition.GetX()));
     const int startLayer(std::max(minLayer, std::min(maxLayer, this->GetLayer(startL))));
 
-    // Find nearest layer iterator to start layer
-    LayerFitResultMap::const_iterator startLayerIter = m_layerFitResultMap.end();
+    // Find nearest layer iterator to start layer (the lowest layer with a fit result at or above the start layer)
+    LayerFitResultMap::const_iterator startLayerIter = m_layerFitResultMap.FindAtOrBelow(startLayer);
     CartesianVector startLayerPosition(0.f, 0.f, 0.f);
 
-    for (int iLayer = startLayer; iLayer <= maxLayer; ++iLayer)
-    {
-        startLayerIter = m_layerFitResultMap.find(iLayer);
+    if (startLayerIter->first < startLayer)
+        ++startLayerIter;
 
-        if (m_layerFitResultMap.end() != startLayerIter)
-            break;
-    }
-
-    if (m_layerFitResultMap.end() == startLayerIter)
+    if ((m_layerFitResultMap.end() == startLayerIter) || (startLayerIter->first > maxLayer))
         return STATUS_CODE_NOT_FOUND;
 
     this->GetGlobalPosition(startLayerIter->second.GetL(), startLayerIter->second.GetFitT(), startLayerPosition);
 
     const bool startIsAhead((startLayerPosition.GetX() - x) > std::numeric_limits<float>::epsilon());
     const bool increasesWithLayers(maxPosition.GetX() > minPosition.GetX());
-    const int increment = ((startIsAhead == increasesWithLayers) ? -1 : +1);
+    const bool stepToHigherLayers(startIsAhead != increasesWithLayers);
 
     // Find surrounding layer iterators
     // (Second layer iterator comes immediately after the fit has crossed the target X coordinate
@@ -1032,15 +1117,14 @@ StatusCode TwoDSlidingFitResult::GetTransverseSurroundingLayers(const float x, c
     CartesianVector firstLayerPosition(0.f, 0.f, 0.f);
     CartesianVector secondLayerPosition(0.f, 0.f, 0.f);
 
-    for (int iLayer = startLayerIter->first; (iLayer >= minLayer) && (iLayer <= maxLayer); iLayer += increment)
-    {
-        LayerFitResultMap::const_iterator tempIter = m_layerFitResultMap.find(iLayer);
-        if (m_layerFitResultMap.end() == tempIter)
-            continue;
+    // (Adjacent layers with fit results are reached by stepping the map iterator, rather than searching the map layer by layer).
+    LayerFitResultMap::const_iterator layerIter(startLayerIter);
 
+    while (true)
+    {
         firstLayerIter = secondLayerIter;
         firstLayerPosition = secondLayerPosition;
-        secondLayerIter = tempIter;
+        secondLayerIter = layerIter;
 
         this->GetGlobalPosition(secondLayerIter->second.GetL(), secondLayerIter->second.GetFitT(), secondLayerPosition);
         const bool isAhead(secondLayerPosition.GetX() > x);
@@ -1049,6 +1133,17 @@ StatusCode TwoDSlidingFitResult::GetTransverseSurroundingLayers(const float x, c
             break;
 
         firstLayerIter = m_layerFitResultMap.end();
+
+        if (stepToHigherLayers)
+        {
+            if ((m_layerFitResultMap.end() == ++layerIter) || (layerIter->first > maxLayer))
+                break;
+        }
+        else
+        {
+            if ((m_layerFitResultMap.begin() == layerIter) || ((--layerIter)->first < minLayer))
+                break;
+        }
     }
 
     if (m_layerFitResultMap.end() == firstLayerIter || m_layerFitResultMap.end() == secondLayerIter)
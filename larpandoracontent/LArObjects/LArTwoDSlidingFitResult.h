@@ -13,6 +13,7 @@
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitObjects.h"
 
 #include <unordered_map>
+#include <vector>
 
 namespace lar_content
 {
@@ -62,6 +63,23 @@ public:
     TwoDSlidingFitResult(const unsigned int layerFitHalfWindow, const float layerPitch, const pandora::CartesianVector &axisIntercept,
         const pandora::CartesianVector &axisDirection, const pandora::CartesianVector &orthoDirection, const LayerFitContributionMap &layerFitContributionMap);
 
+    /**
+     *  @brief  Constructor for the fit obtained by adding positions to, and removing previously-fitted positions from, an existing fit.
+     *          The primary axis, axis intercept and layer definitions of the existing fit are retained, so only the added and removed
+     *          positions and the sliding window are revisited. The result is identical to a fit of the modified positions made with the
+     *          existing axes specified. It is not identical to a fit made from scratch, which would calculate new axes by PCA, so callers
+     *          must accept the retained axes as an approximation.
+     *
+     *  @param  pCluster address of the cluster described by the modified fit (may be null)
+     *  @param  fitResult the existing fit
+     *  @param  addedPointVector the positions to add
+     *  @param  removedPointVector the positions to remove, each of which must have been included in the existing fit
+     *
+     *  @throw  StatusCodeException
+     */
+    TwoDSlidingFitResult(const pandora::Cluster *const pCluster, const TwoDSlidingFitResult &fitResult, const pandora::CartesianPointVector &addedPointVector,
+        const pandora::CartesianPointVector &removedPointVector);
+
     /**
      *  @brief  Get the address of the cluster, if originally provided
      *
@@ -354,6 +372,19 @@ public:
     pandora::StatusCode GetTransverseProjection(const float x, const FitSegment &fitSegment, pandora::CartesianVector &position,
         pandora::CartesianVector &direction) const;
 
+    /**
+     *  @brief  Get projected positions and directions for a list of input x coordinates and a fit segment, resolving the segment bounds
+     *          once for the whole list rather than once per coordinate
+     *
+     *  @param  xList the input x coordinates
+     *  @param  fitSegment the portion of sliding linear fit
+     *  @param  positionList to receive the output positions, one per input x coordinate
+     *  @param  directionList to receive the output directions, one per input x coordinate
+     *  @param  isProjectedList to receive, for each input x coordinate, whether a projection was found
+     */
+    void GetTransverseProjections(const pandora::FloatVector &xList, const FitSegment &fitSegment, pandora::CartesianPointVector &positionList,
+        pandora::CartesianPointVector &directionList, std::vector<bool> &isProjectedList) const;
+
     /**
      *  @brief  Get extrapolated position (beyond span) for a given input coordinate
      *
@@ -505,6 +536,38 @@ private:
     pandora::StatusCode GetTransverseSurroundingLayers(const float x, const int minLayer, const int maxLayer,
         LayerFitResultMap::const_iterator &firstLayerIter, LayerFitResultMap::const_iterator &secondLayerIter) const;
 
+    /**
+     *  @brief  Get iterators and global positions for the layers bounding a transverse search
+     *
+     *  @param  minLayer the minimum allowed layer
+     *  @param  maxLayer the maximum allowed layer
+     *  @param  minLayerIter to receive the iterator for the minimum layer
+     *  @param  maxLayerIter to receive the iterator for the maximum layer
+     *  @param  minPosition to receive the global fit position at the minimum layer
+     *  @param  maxPosition to receive the global fit position at the maximum layer
+     *
+     *  @return status code, faster than throwing in regular use-cases
+     */
+    pandora::StatusCode GetTransverseBoundingLayers(const int minLayer, const int maxLayer, LayerFitResultMap::const_iterator &minLayerIter,
+        LayerFitResultMap::const_iterator &maxLayerIter, pandora::CartesianVector &minPosition, pandora::CartesianVector &maxPosition) const;
+
+    /**
+     *  @brief  Get iterators for layers surrounding a specified transverse position, given the layers bounding the search
+     *
+     *  @param  x the transverse coordinate
+     *  @param  minLayerIter the iterator for the minimum allowed layer
+     *  @param  maxLayerIter the iterator for the maximum allowed layer
+     *  @param  minPosition the global fit position at the minimum allowed layer
+     *  @param  maxPosition the global fit position at the maximum allowed layer
+     *  @param  firstLayerIter to receive the iterator for the layer just below the input coordinate
+     *  @param  secondLayerIter to receive the iterator for the layer just above the input coordinate
+     *
+     *  @return status code, faster than throwing in regular use-cases
+     */
+    pandora::StatusCode GetTransverseSurroundingLayers(const float x, const LayerFitResultMap::const_iterator &minLayerIter,
+        const LayerFitResultMap::const_iterator &maxLayerIter, const pandora::CartesianVector &minPosition, const pandora::CartesianVector &maxPosition,
+        LayerFitResultMap::const_iterator &firstLayerIter, LayerFitResultMap::const_iterator &secondLayerIter) const;
+
     /**
      *  @brief  Get interpolation weights for layers surrounding a specified longitudinal position
      *
@@ -26,18 +26,6 @@ namespace lar_content
 using namespace pandora;
 
 LArRotationalTransformationPlugin::LArRotationalTransformationPlugin() :
-    m_thetaU(0.),
-    m_thetaV(0.),
-    m_thetaW(0.),
-    m_sinU(0.),
-    m_sinV(0.),
-    m_sinW(0.),
-    m_cosU(0.),
-    m_cosV(0.),
-    m_cosW(0.),
-    m_sinVminusU(0.),
-    m_sinWminusV(0.),
-    m_sinUminusW(0.),
     m_maxAngularDiscrepancyU(0.03),
     m_maxAngularDiscrepancyV(0.03),
     m_maxAngularDiscrepancyW(0.03),
@@ -49,84 +37,84 @@ LArRotationalTransformationPlugin::LArRotationalTransformationPlugin() :
 
 double LArRotationalTransformationPlugin::UVtoW(const double u, const double v) const
 {
-    return (-1. * (u * m_sinWminusV + v * m_sinUminusW) / m_sinVminusU);
+    return m_transformation.UVtoW(u, v);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 double LArRotationalTransformationPlugin::VWtoU(const double v, const double w) const
 {
-    return (-1. * (v * m_sinUminusW + w * m_sinVminusU) / m_sinWminusV);
+    return m_transformation.VWtoU(v, w);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 double LArRotationalTransformationPlugin::WUtoV(const double w, const double u) const
 {
-    return (-1. * (u * m_sinWminusV + w * m_sinVminusU) / m_sinUminusW);
+    return m_transformation.WUtoV(w, u);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 double LArRotationalTransformationPlugin::UVtoY(const double u, const double v) const
 {
-    return ((u * m_cosV - v * m_cosU) / m_sinVminusU);
+    return m_transformation.UVtoY(u, v);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 double LArRotationalTransformationPlugin::UVtoZ(const double u, const double v) const
 {
-    return ((u * m_sinV - v * m_sinU) / m_sinVminusU);
+    return m_transformation.UVtoZ(u, v);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 double LArRotationalTransformationPlugin::UWtoY(const double u, const double w) const
 {
-    return ((w * m_cosU - u * m_cosW) / m_sinUminusW);
+    return m_transformation.UWtoY(u, w);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 double LArRotationalTransformationPlugin::UWtoZ(const double u, const double w) const
 {
-    return ((w * m_sinU - u * m_sinW) / m_sinUminusW);
+    return m_transformation.UWtoZ(u, w);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 double LArRotationalTransformationPlugin::VWtoY(const double v, const double w) const
 {
-    return ((v * m_cosW - w * m_cosV) / m_sinWminusV);
+    return m_transformation.VWtoY(v, w);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 double LArRotationalTransformationPlugin::VWtoZ(const double v, const double w) const
 {
-    return ((v * m_sinW - w * m_sinV) / m_sinWminusV);
+    return m_transformation.VWtoZ(v, w);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 double LArRotationalTransformationPlugin::YZtoU(const double y, const double z) const
 {
-    return (z * m_cosU - y * m_sinU);
+    return m_transformation.YZtoU(y, z);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 double LArRotationalTransformationPlugin::YZtoV(const double y, const double z) const
 {
-    return (z * m_cosV - y * m_sinV);
+    return m_transformation.YZtoV(y, z);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 double LArRotationalTransformationPlugin::YZtoW(const double y, const double z) const
 {
-    return (z * m_cosW - y * m_sinW);
+    return m_transformation.YZtoW(y, z);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -135,23 +123,25 @@ void LArRotationalTransformationPlugin::GetMinChiSquaredYZ(const double u, const
     const double sigmaW, double &y, double &z, double &chiSquared) const
 {
     const double sigmaU2(sigmaU * sigmaU), sigmaV2(sigmaV * sigmaV), sigmaW2(sigmaW * sigmaW);
+    const double sinU(m_transformation.GetSinU()), sinV(m_transformation.GetSinV()), sinW(m_transformation.GetSinW());
+    const double cosU(m_transformation.GetCosU()), cosV(m_transformation.GetCosV()), cosW(m_transformation.GetCosW());
 
     // Obtain expression for chi2, differentiate wrt y and z, set both results to zero and solve simultaneously. Here just paste-in result.
-    y = (sigmaW2 * v * m_cosU * m_cosV * m_sinU - sigmaW2 * u * m_cosV * m_cosV * m_sinU + sigmaV2 * w * m_cosU * m_cosW * m_sinU -
-         sigmaV2 * u * m_cosW * m_cosW * m_sinU - sigmaW2 * v * m_cosU * m_cosU * m_sinV + sigmaW2 * u * m_cosU * m_cosV * m_sinV +
-         sigmaU2 * w * m_cosV * m_cosW * m_sinV - sigmaU2 * v * m_cosW * m_cosW * m_sinV - sigmaV2 * w * m_cosU * m_cosU * m_sinW -
-         sigmaU2 * w * m_cosV * m_cosV * m_sinW + sigmaV2 * u * m_cosU * m_cosW * m_sinW + sigmaU2 * v * m_cosV * m_cosW * m_sinW) /
-        (sigmaW2 * m_cosV * m_cosV * m_sinU * m_sinU + sigmaV2 * m_cosW * m_cosW * m_sinU * m_sinU - 2. * sigmaW2 * m_cosU * m_cosV * m_sinU * m_sinV +
-         sigmaW2 * m_cosU * m_cosU * m_sinV * m_sinV + sigmaU2 * m_cosW * m_cosW * m_sinV * m_sinV - 2. * sigmaV2 * m_cosU * m_cosW * m_sinU * m_sinW -
-         2. * sigmaU2 * m_cosV * m_cosW * m_sinV * m_sinW + sigmaV2 * m_cosU * m_cosU * m_sinW * m_sinW + sigmaU2 * m_cosV * m_cosV * m_sinW * m_sinW);
-
-    z = (sigmaW2 * v * m_cosV * m_sinU * m_sinU + sigmaV2 * w * m_cosW * m_sinU * m_sinU - sigmaW2 * v * m_cosU * m_sinU * m_sinV -
-         sigmaW2 * u * m_cosV * m_sinU * m_sinV + sigmaW2 * u * m_cosU * m_sinV * m_sinV + sigmaU2 * w * m_cosW * m_sinV * m_sinV -
-         sigmaV2 * w * m_cosU * m_sinU * m_sinW - sigmaV2 * u * m_cosW * m_sinU * m_sinW - sigmaU2 * w * m_cosV * m_sinV * m_sinW -
-         sigmaU2 * v * m_cosW * m_sinV * m_sinW + sigmaV2 * u * m_cosU * m_sinW * m_sinW + sigmaU2 * v * m_cosV * m_sinW * m_sinW) /
-        (sigmaW2 * m_cosV * m_cosV * m_sinU * m_sinU + sigmaV2 * m_cosW * m_cosW * m_sinU * m_sinU - 2. * sigmaW2 * m_cosU * m_cosV * m_sinU * m_sinV +
-         sigmaW2 * m_cosU * m_cosU * m_sinV * m_sinV + sigmaU2 * m_cosW * m_cosW * m_sinV * m_sinV - 2. * sigmaV2 * m_cosU * m_cosW * m_sinU * m_sinW -
-         2. * sigmaU2 * m_cosV * m_cosW * m_sinV * m_sinW + sigmaV2 * m_cosU * m_cosU * m_sinW * m_sinW + sigmaU2 * m_cosV * m_cosV * m_sinW * m_sinW);
+    y = (sigmaW2 * v * cosU * cosV * sinU - sigmaW2 * u * cosV * cosV * sinU + sigmaV2 * w * cosU * cosW * sinU -
+         sigmaV2 * u * cosW * cosW * sinU - sigmaW2 * v * cosU * cosU * sinV + sigmaW2 * u * cosU * cosV * sinV +
+         sigmaU2 * w * cosV * cosW * sinV - sigmaU2 * v * cosW * cosW * sinV - sigmaV2 * w * cosU * cosU * sinW -
+         sigmaU2 * w * cosV * cosV * sinW + sigmaV2 * u * cosU * cosW * sinW + sigmaU2 * v * cosV * cosW * sinW) /
+        (sigmaW2 * cosV * cosV * sinU * sinU + sigmaV2 * cosW * cosW * sinU * sinU - 2. * sigmaW2 * cosU * cosV * sinU * sinV +
+         sigmaW2 * cosU * cosU * sinV * sinV + sigmaU2 * cosW * cosW * sinV * sinV - 2. * sigmaV2 * cosU * cosW * sinU * sinW -
+         2. * sigmaU2 * cosV * cosW * sinV * sinW + sigmaV2 * cosU * cosU * sinW * sinW + sigmaU2 * cosV * cosV * sinW * sinW);
+
+    z = (sigmaW2 * v * cosV * sinU * sinU + sigmaV2 * w * cosW * sinU * sinU - sigmaW2 * v * cosU * sinU * sinV -
+         sigmaW2 * u * cosV * sinU * sinV + sigmaW2 * u * cosU * sinV * sinV + sigmaU2 * w * cosW * sinV * sinV -
+         sigmaV2 * w * cosU * sinU * sinW - sigmaV2 * u * cosW * sinU * sinW - sigmaU2 * w * cosV * sinV * sinW -
+         sigmaU2 * v * cosW * sinV * sinW + sigmaV2 * u * cosU * sinW * sinW + sigmaU2 * v * cosV * sinW * sinW) /
+        (sigmaW2 * cosV * cosV * sinU * sinU + sigmaV2 * cosW * cosW * sinU * sinU - 2. * sigmaW2 * cosU * cosV * sinU * sinV +
+         sigmaW2 * cosU * cosU * sinV * sinV + sigmaU2 * cosW * cosW * sinV * sinV - 2. * sigmaV2 * cosU * cosW * sinU * sinW -
+         2. * sigmaU2 * cosV * cosW * sinV * sinW + sigmaV2 * cosU * cosU * sinW * sinW + sigmaU2 * cosV * cosV * sinW * sinW);
 
     const double deltaU(u - LArRotationalTransformationPlugin::YZtoU(y, z));
     const double deltaV(v - LArRotationalTransformationPlugin::YZtoV(y, z));
@@ -165,93 +155,95 @@ void LArRotationalTransformationPlugin::GetMinChiSquaredYZ(const double u, const
     const double sigmaW, const double uFit, const double vFit, const double wFit, const double sigmaFit, double &y, double &z, double &chiSquared) const
 {
     const double sigmaU2(sigmaU * sigmaU), sigmaV2(sigmaV * sigmaV), sigmaW2(sigmaW * sigmaW), sigmaFit2(sigmaFit * sigmaFit);
+    const double sinU(m_transformation.GetSinU()), sinV(m_transformation.GetSinV()), sinW(m_transformation.GetSinW());
+    const double cosU(m_transformation.GetCosU()), cosV(m_transformation.GetCosV()), cosW(m_transformation.GetCosW());
 
     // Obtain expression for chi2, differentiate wrt y and z, set both results to zero and solve simultaneously. Here just paste-in result.
-    y = (vFit * sigmaU2 * sigmaV2 * sigmaW2 * m_cosU * m_cosV * m_sinU + vFit * sigmaV2 * sigmaW2 * sigmaFit2 * m_cosU * m_cosV * m_sinU +
-         sigmaU2 * sigmaW2 * sigmaFit2 * v * m_cosU * m_cosV * m_sinU + sigmaW2 * sigmaFit2 * sigmaFit2 * v * m_cosU * m_cosV * m_sinU -
-         uFit * sigmaU2 * sigmaV2 * sigmaW2 * m_cosV * m_cosV * m_sinU - uFit * sigmaU2 * sigmaW2 * sigmaFit2 * m_cosV * m_cosV * m_sinU -
-         sigmaV2 * sigmaW2 * sigmaFit2 * u * m_cosV * m_cosV * m_sinU - sigmaW2 * sigmaFit2 * sigmaFit2 * u * m_cosV * m_cosV * m_sinU +
-         wFit * sigmaU2 * sigmaV2 * sigmaW2 * m_cosU * m_cosW * m_sinU + wFit * sigmaV2 * sigmaW2 * sigmaFit2 * m_cosU * m_cosW * m_sinU +
-         sigmaU2 * sigmaV2 * sigmaFit2 * w * m_cosU * m_cosW * m_sinU + sigmaV2 * sigmaFit2 * sigmaFit2 * w * m_cosU * m_cosW * m_sinU -
-         uFit * sigmaU2 * sigmaV2 * sigmaW2 * m_cosW * m_cosW * m_sinU - uFit * sigmaU2 * sigmaV2 * sigmaFit2 * m_cosW * m_cosW * m_sinU -
-         sigmaV2 * sigmaW2 * sigmaFit2 * u * m_cosW * m_cosW * m_sinU - sigmaV2 * sigmaFit2 * sigmaFit2 * u * m_cosW * m_cosW * m_sinU -
-         vFit * sigmaU2 * sigmaV2 * sigmaW2 * m_cosU * m_cosU * m_sinV - vFit * sigmaV2 * sigmaW2 * sigmaFit2 * m_cosU * m_cosU * m_sinV -
-         sigmaU2 * sigmaW2 * sigmaFit2 * v * m_cosU * m_cosU * m_sinV - sigmaW2 * sigmaFit2 * sigmaFit2 * v * m_cosU * m_cosU * m_sinV +
-         uFit * sigmaU2 * sigmaV2 * sigmaW2 * m_cosU * m_cosV * m_sinV + uFit * sigmaU2 * sigmaW2 * sigmaFit2 * m_cosU * m_cosV * m_sinV +
-         sigmaV2 * sigmaW2 * sigmaFit2 * u * m_cosU * m_cosV * m_sinV + sigmaW2 * sigmaFit2 * sigmaFit2 * u * m_cosU * m_cosV * m_sinV +
-         wFit * sigmaU2 * sigmaV2 * sigmaW2 * m_cosV * m_cosW * m_sinV + wFit * sigmaU2 * sigmaW2 * sigmaFit2 * m_cosV * m_cosW * m_sinV +
-         sigmaU2 * sigmaV2 * sigmaFit2 * w * m_cosV * m_cosW * m_sinV + sigmaU2 * sigmaFit2 * sigmaFit2 * w * m_cosV * m_cosW * m_sinV -
-         vFit * sigmaU2 * sigmaV2 * sigmaW2 * m_cosW * m_cosW * m_sinV - vFit * sigmaU2 * sigmaV2 * sigmaFit2 * m_cosW * m_cosW * m_sinV -
-         sigmaU2 * sigmaW2 * sigmaFit2 * v * m_cosW * m_cosW * m_sinV - sigmaU2 * sigmaFit2 * sigmaFit2 * v * m_cosW * m_cosW * m_sinV -
-         wFit * sigmaU2 * sigmaV2 * sigmaW2 * m_cosU * m_cosU * m_sinW - wFit * sigmaV2 * sigmaW2 * sigmaFit2 * m_cosU * m_cosU * m_sinW -
-         sigmaU2 * sigmaV2 * sigmaFit2 * w * m_cosU * m_cosU * m_sinW - sigmaV2 * sigmaFit2 * sigmaFit2 * w * m_cosU * m_cosU * m_sinW -
-         wFit * sigmaU2 * sigmaV2 * sigmaW2 * m_cosV * m_cosV * m_sinW - wFit * sigmaU2 * sigmaW2 * sigmaFit2 * m_cosV * m_cosV * m_sinW -
-         sigmaU2 * sigmaV2 * sigmaFit2 * w * m_cosV * m_cosV * m_sinW - sigmaU2 * sigmaFit2 * sigmaFit2 * w * m_cosV * m_cosV * m_sinW +
-         uFit * sigmaU2 * sigmaV2 * sigmaW2 * m_cosU * m_cosW * m_sinW + uFit * sigmaU2 * sigmaV2 * sigmaFit2 * m_cosU * m_cosW * m_sinW +
-         sigmaV2 * sigmaW2 * sigmaFit2 * u * m_cosU * m_cosW * m_sinW + sigmaV2 * sigmaFit2 * sigmaFit2 * u * m_cosU * m_cosW * m_sinW +
-         vFit * sigmaU2 * sigmaV2 * sigmaW2 * m_cosV * m_cosW * m_sinW + vFit * sigmaU2 * sigmaV2 * sigmaFit2 * m_cosV * m_cosW * m_sinW +
-         sigmaU2 * sigmaW2 * sigmaFit2 * v * m_cosV * m_cosW * m_sinW + sigmaU2 * sigmaFit2 * sigmaFit2 * v * m_cosV * m_cosW * m_sinW) /
-        (sigmaU2 * sigmaV2 * sigmaW2 * m_cosV * m_cosV * m_sinU * m_sinU + sigmaU2 * sigmaW2 * sigmaFit2 * m_cosV * m_cosV * m_sinU * m_sinU +
-         sigmaV2 * sigmaW2 * sigmaFit2 * m_cosV * m_cosV * m_sinU * m_sinU + sigmaW2 * sigmaFit2 * sigmaFit2 * m_cosV * m_cosV * m_sinU * m_sinU +
-         sigmaU2 * sigmaV2 * sigmaW2 * m_cosW * m_cosW * m_sinU * m_sinU + sigmaU2 * sigmaV2 * sigmaFit2 * m_cosW * m_cosW * m_sinU * m_sinU +
-         sigmaV2 * sigmaW2 * sigmaFit2 * m_cosW * m_cosW * m_sinU * m_sinU + sigmaV2 * sigmaFit2 * sigmaFit2 * m_cosW * m_cosW * m_sinU * m_sinU -
-         2. * sigmaU2 * sigmaV2 * sigmaW2 * m_cosU * m_cosV * m_sinU * m_sinV - 2. * sigmaU2 * sigmaW2 * sigmaFit2 * m_cosU * m_cosV * m_sinU * m_sinV -
-         2. * sigmaV2 * sigmaW2 * sigmaFit2 * m_cosU * m_cosV * m_sinU * m_sinV - 2. * sigmaW2 * sigmaFit2 * sigmaFit2 * m_cosU * m_cosV * m_sinU * m_sinV +
-         sigmaU2 * sigmaV2 * sigmaW2 * m_cosU * m_cosU * m_sinV * m_sinV + sigmaU2 * sigmaW2 * sigmaFit2 * m_cosU * m_cosU * m_sinV * m_sinV +
-         sigmaV2 * sigmaW2 * sigmaFit2 * m_cosU * m_cosU * m_sinV * m_sinV + sigmaW2 * sigmaFit2 * sigmaFit2 * m_cosU * m_cosU * m_sinV * m_sinV +
-         sigmaU2 * sigmaV2 * sigmaW2 * m_cosW * m_cosW * m_sinV * m_sinV + sigmaU2 * sigmaV2 * sigmaFit2 * m_cosW * m_cosW * m_sinV * m_sinV +
-         sigmaU2 * sigmaW2 * sigmaFit2 * m_cosW * m_cosW * m_sinV * m_sinV + sigmaU2 * sigmaFit2 * sigmaFit2 * m_cosW * m_cosW * m_sinV * m_sinV -
-         2. * sigmaU2 * sigmaV2 * sigmaW2 * m_cosU * m_cosW * m_sinU * m_sinW - 2. * sigmaU2 * sigmaV2 * sigmaFit2 * m_cosU * m_cosW * m_sinU * m_sinW -
-         2. * sigmaV2 * sigmaW2 * sigmaFit2 * m_cosU * m_cosW * m_sinU * m_sinW - 2. * sigmaV2 * sigmaFit2 * sigmaFit2 * m_cosU * m_cosW * m_sinU * m_sinW -
-         2. * sigmaU2 * sigmaV2 * sigmaW2 * m_cosV * m_cosW * m_sinV * m_sinW - 2. * sigmaU2 * sigmaV2 * sigmaFit2 * m_cosV * m_cosW * m_sinV * m_sinW -
-         2. * sigmaU2 * sigmaW2 * sigmaFit2 * m_cosV * m_cosW * m_sinV * m_sinW - 2. * sigmaU2 * sigmaFit2 * sigmaFit2 * m_cosV * m_cosW * m_sinV * m_sinW +
-         sigmaU2 * sigmaV2 * sigmaW2 * m_cosU * m_cosU * m_sinW * m_sinW + sigmaU2 * sigmaV2 * sigmaFit2 * m_cosU * m_cosU * m_sinW * m_sinW +
-         sigmaV2 * sigmaW2 * sigmaFit2 * m_cosU * m_cosU * m_sinW * m_sinW + sigmaV2 * sigmaFit2 * sigmaFit2 * m_cosU * m_cosU * m_sinW * m_sinW +
-         sigmaU2 * sigmaV2 * sigmaW2 * m_cosV * m_cosV * m_sinW * m_sinW + sigmaU2 * sigmaV2 * sigmaFit2 * m_cosV * m_cosV * m_sinW * m_sinW +
-         sigmaU2 * sigmaW2 * sigmaFit2 * m_cosV * m_cosV * m_sinW * m_sinW+sigmaU2 * sigmaFit2 * sigmaFit2 * m_cosV * m_cosV * m_sinW * m_sinW);
-
-    z = (vFit * sigmaU2 * sigmaV2 * sigmaW2 * m_cosV * m_sinU * m_sinU + vFit * sigmaV2 * sigmaW2 * sigmaFit2 * m_cosV * m_sinU * m_sinU +
-         sigmaU2 * sigmaW2 * sigmaFit2 * v * m_cosV * m_sinU * m_sinU + sigmaW2 * sigmaFit2 * sigmaFit2 * v * m_cosV * m_sinU * m_sinU +
-         wFit * sigmaU2 * sigmaV2 * sigmaW2 * m_cosW * m_sinU * m_sinU + wFit * sigmaV2 * sigmaW2 * sigmaFit2 * m_cosW * m_sinU * m_sinU +
-         sigmaU2 * sigmaV2 * sigmaFit2 * w * m_cosW * m_sinU * m_sinU + sigmaV2 * sigmaFit2 * sigmaFit2 * w * m_cosW * m_sinU * m_sinU -
-         vFit * sigmaU2 * sigmaV2 * sigmaW2 * m_cosU * m_sinU * m_sinV - vFit * sigmaV2 * sigmaW2 * sigmaFit2 * m_cosU * m_sinU * m_sinV -
-         sigmaU2 * sigmaW2 * sigmaFit2 * v * m_cosU * m_sinU * m_sinV - sigmaW2 * sigmaFit2 * sigmaFit2 * v * m_cosU * m_sinU * m_sinV -
-         uFit * sigmaU2 * sigmaV2 * sigmaW2 * m_cosV * m_sinU * m_sinV - uFit * sigmaU2 * sigmaW2 * sigmaFit2 * m_cosV * m_sinU * m_sinV -
-         sigmaV2 * sigmaW2 * sigmaFit2 * u * m_cosV * m_sinU * m_sinV - sigmaW2 * sigmaFit2 * sigmaFit2 * u * m_cosV * m_sinU * m_sinV +
-         uFit * sigmaU2 * sigmaV2 * sigmaW2 * m_cosU * m_sinV * m_sinV + uFit * sigmaU2 * sigmaW2 * sigmaFit2 * m_cosU * m_sinV * m_sinV +
-         sigmaV2 * sigmaW2 * sigmaFit2 * u * m_cosU * m_sinV * m_sinV + sigmaW2 * sigmaFit2 * sigmaFit2 * u * m_cosU * m_sinV * m_sinV +
-         wFit * sigmaU2 * sigmaV2 * sigmaW2 * m_cosW * m_sinV * m_sinV + wFit * sigmaU2 * sigmaW2 * sigmaFit2 * m_cosW * m_sinV * m_sinV +
-         sigmaU2 * sigmaV2 * sigmaFit2 * w * m_cosW * m_sinV * m_sinV + sigmaU2 * sigmaFit2 * sigmaFit2 * w * m_cosW * m_sinV * m_sinV -
-         wFit * sigmaU2 * sigmaV2 * sigmaW2 * m_cosU * m_sinU * m_sinW - wFit * sigmaV2 * sigmaW2 * sigmaFit2 * m_cosU * m_sinU * m_sinW -
-         sigmaU2 * sigmaV2 * sigmaFit2 * w * m_cosU * m_sinU * m_sinW - sigmaV2 * sigmaFit2 * sigmaFit2 * w * m_cosU * m_sinU * m_sinW -
-         uFit * sigmaU2 * sigmaV2 * sigmaW2 * m_cosW * m_sinU * m_sinW - uFit * sigmaU2 * sigmaV2 * sigmaFit2 * m_cosW * m_sinU * m_sinW -
-         sigmaV2 * sigmaW2 * sigmaFit2 * u * m_cosW * m_sinU * m_sinW - sigmaV2 * sigmaFit2 * sigmaFit2 * u * m_cosW * m_sinU * m_sinW -
-         wFit * sigmaU2 * sigmaV2 * sigmaW2 * m_cosV * m_sinV * m_sinW - wFit * sigmaU2 * sigmaW2 * sigmaFit2 * m_cosV * m_sinV * m_sinW -
-         sigmaU2 * sigmaV2 * sigmaFit2 * w * m_cosV * m_sinV * m_sinW - sigmaU2 * sigmaFit2 * sigmaFit2 * w * m_cosV * m_sinV * m_sinW -
-         vFit * sigmaU2 * sigmaV2 * sigmaW2 * m_cosW * m_sinV * m_sinW - vFit * sigmaU2 * sigmaV2 * sigmaFit2 * m_cosW * m_sinV * m_sinW -
-         sigmaU2 * sigmaW2 * sigmaFit2 * v * m_cosW * m_sinV * m_sinW - sigmaU2 * sigmaFit2 * sigmaFit2 * v * m_cosW * m_sinV * m_sinW +
-         uFit * sigmaU2 * sigmaV2 * sigmaW2 * m_cosU * m_sinW * m_sinW + uFit * sigmaU2 * sigmaV2 * sigmaFit2 * m_cosU * m_sinW * m_sinW +
-         sigmaV2 * sigmaW2 * sigmaFit2 * u * m_cosU * m_sinW * m_sinW + sigmaV2 * sigmaFit2 * sigmaFit2 * u * m_cosU * m_sinW * m_sinW +
-         vFit * sigmaU2 * sigmaV2 * sigmaW2 * m_cosV * m_sinW * m_sinW + vFit * sigmaU2 * sigmaV2 * sigmaFit2 * m_cosV * m_sinW * m_sinW +
-         sigmaU2 * sigmaW2 * sigmaFit2 * v * m_cosV * m_sinW * m_sinW + sigmaU2 * sigmaFit2 * sigmaFit2 * v * m_cosV * m_sinW * m_sinW) /
-        (sigmaU2 * sigmaV2 * sigmaW2 * m_cosV * m_cosV * m_sinU * m_sinU + sigmaU2 * sigmaW2 * sigmaFit2 * m_cosV * m_cosV * m_sinU * m_sinU +
-         sigmaV2 * sigmaW2 * sigmaFit2 * m_cosV * m_cosV * m_sinU * m_sinU + sigmaW2 * sigmaFit2 * sigmaFit2 * m_cosV * m_cosV * m_sinU * m_sinU +
-         sigmaU2 * sigmaV2 * sigmaW2 * m_cosW * m_cosW * m_sinU * m_sinU + sigmaU2 * sigmaV2 * sigmaFit2 * m_cosW * m_cosW * m_sinU * m_sinU +
-         sigmaV2 * sigmaW2 * sigmaFit2 * m_cosW * m_cosW * m_sinU * m_sinU + sigmaV2 * sigmaFit2 * sigmaFit2 * m_cosW * m_cosW * m_sinU * m_sinU -
-         2. * sigmaU2 * sigmaV2 * sigmaW2 * m_cosU * m_cosV * m_sinU * m_sinV-2. * sigmaU2 * sigmaW2 * sigmaFit2 * m_cosU * m_cosV * m_sinU * m_sinV -
-         2. * sigmaV2 * sigmaW2 * sigmaFit2 * m_cosU * m_cosV * m_sinU * m_sinV-2. * sigmaW2 * sigmaFit2 * sigmaFit2 * m_cosU * m_cosV * m_sinU * m_sinV +
-         sigmaU2 * sigmaV2 * sigmaW2 * m_cosU * m_cosU * m_sinV * m_sinV + sigmaU2 * sigmaW2 * sigmaFit2 * m_cosU * m_cosU * m_sinV * m_sinV +
-         sigmaV2 * sigmaW2 * sigmaFit2 * m_cosU * m_cosU * m_sinV * m_sinV + sigmaW2 * sigmaFit2 * sigmaFit2 * m_cosU * m_cosU * m_sinV * m_sinV +
-         sigmaU2 * sigmaV2 * sigmaW2 * m_cosW * m_cosW * m_sinV * m_sinV + sigmaU2 * sigmaV2 * sigmaFit2 * m_cosW * m_cosW * m_sinV * m_sinV +
-         sigmaU2 * sigmaW2 * sigmaFit2 * m_cosW * m_cosW * m_sinV * m_sinV + sigmaU2 * sigmaFit2 * sigmaFit2 * m_cosW * m_cosW * m_sinV * m_sinV -
-         2. * sigmaU2 * sigmaV2 * sigmaW2 * m_cosU * m_cosW * m_sinU * m_sinW - 2. * sigmaU2 * sigmaV2 * sigmaFit2 * m_cosU * m_cosW * m_sinU * m_sinW -
-         2. * sigmaV2 * sigmaW2 * sigmaFit2 * m_cosU * m_cosW * m_sinU * m_sinW - 2. * sigmaV2 * sigmaFit2 * sigmaFit2 * m_cosU * m_cosW * m_sinU * m_sinW -
-         2. * sigmaU2 * sigmaV2 * sigmaW2 * m_cosV * m_cosW * m_sinV * m_sinW - 2. * sigmaU2 * sigmaV2 * sigmaFit2 * m_cosV * m_cosW * m_sinV * m_sinW -
-         2. * sigmaU2 * sigmaW2 * sigmaFit2 * m_cosV * m_cosW * m_sinV * m_sinW - 2. * sigmaU2 * sigmaFit2 * sigmaFit2 * m_cosV * m_cosW * m_sinV * m_sinW +
-         sigmaU2 * sigmaV2 * sigmaW2 * m_cosU * m_cosU * m_sinW * m_sinW + sigmaU2 * sigmaV2 * sigmaFit2 * m_cosU * m_cosU * m_sinW * m_sinW +
-         sigmaV2 * sigmaW2 * sigmaFit2 * m_cosU * m_cosU * m_sinW * m_sinW + sigmaV2 * sigmaFit2 * sigmaFit2 * m_cosU * m_cosU * m_sinW * m_sinW +
-         sigmaU2 * sigmaV2 * sigmaW2 * m_cosV * m_cosV * m_sinW * m_sinW + sigmaU2 * sigmaV2 * sigmaFit2 * m_cosV * m_cosV * m_sinW * m_sinW +
-         sigmaU2 * sigmaW2 * sigmaFit2 * m_cosV * m_cosV * m_sinW * m_sinW + sigmaU2 * sigmaFit2 * sigmaFit2 * m_cosV * m_cosV * m_sinW * m_sinW);
+    y = (vFit * sigmaU2 * sigmaV2 * sigmaW2 * cosU * cosV * sinU + vFit * sigmaV2 * sigmaW2 * sigmaFit2 * cosU * cosV * sinU +
+         sigmaU2 * sigmaW2 * sigmaFit2 * v * cosU * cosV * sinU + sigmaW2 * sigmaFit2 * sigmaFit2 * v * cosU * cosV * sinU -
+         uFit * sigmaU2 * sigmaV2 * sigmaW2 * cosV * cosV * sinU - uFit * sigmaU2 * sigmaW2 * sigmaFit2 * cosV * cosV * sinU -
+         sigmaV2 * sigmaW2 * sigmaFit2 * u * cosV * cosV * sinU - sigmaW2 * sigmaFit2 * sigmaFit2 * u * cosV * cosV * sinU +
+         wFit * sigmaU2 * sigmaV2 * sigmaW2 * cosU * cosW * sinU + wFit * sigmaV2 * sigmaW2 * sigmaFit2 * cosU * cosW * sinU +
+         sigmaU2 * sigmaV2 * sigmaFit2 * w * cosU * cosW * sinU + sigmaV2 * sigmaFit2 * sigmaFit2 * w * cosU * cosW * sinU -
+         uFit * sigmaU2 * sigmaV2 * sigmaW2 * cosW * cosW * sinU - uFit * sigmaU2 * sigmaV2 * sigmaFit2 * cosW * cosW * sinU -
+         sigmaV2 * sigmaW2 * sigmaFit2 * u * cosW * cosW * sinU - sigmaV2 * sigmaFit2 * sigmaFit2 * u * cosW * cosW * sinU -
+         vFit * sigmaU2 * sigmaV2 * sigmaW2 * cosU * cosU * sinV - vFit * sigmaV2 * sigmaW2 * sigmaFit2 * cosU * cosU * sinV -
+         sigmaU2 * sigmaW2 * sigmaFit2 * v * cosU * cosU * sinV - sigmaW2 * sigmaFit2 * sigmaFit2 * v * cosU * cosU * sinV +
+         uFit * sigmaU2 * sigmaV2 * sigmaW2 * cosU * cosV * sinV + uFit * sigmaU2 * sigmaW2 * sigmaFit2 * cosU * cosV * sinV +
+         sigmaV2 * sigmaW2 * sigmaFit2 * u * cosU * cosV * sinV + sigmaW2 * sigmaFit2 * sigmaFit2 * u * cosU * cosV * sinV +
+         wFit * sigmaU2 * sigmaV2 * sigmaW2 * cosV * cosW * sinV + wFit * sigmaU2 * sigmaW2 * sigmaFit2 * cosV * cosW * sinV +
+         sigmaU2 * sigmaV2 * sigmaFit2 * w * cosV * cosW * sinV + sigmaU2 * sigmaFit2 * sigmaFit2 * w * cosV * cosW * sinV -
+         vFit * sigmaU2 * sigmaV2 * sigmaW2 * cosW * cosW * sinV - vFit * sigmaU2 * sigmaV2 * sigmaFit2 * cosW * cosW * sinV -
+         sigmaU2 * sigmaW2 * sigmaFit2 * v * cosW * cosW * sinV - sigmaU2 * sigmaFit2 * sigmaFit2 * v * cosW * cosW * sinV -
+         wFit * sigmaU2 * sigmaV2 * sigmaW2 * cosU * cosU * sinW - wFit * sigmaV2 * sigmaW2 * sigmaFit2 * cosU * cosU * sinW -
+         sigmaU2 * sigmaV2 * sigmaFit2 * w * cosU * cosU * sinW - sigmaV2 * sigmaFit2 * sigmaFit2 * w * cosU * cosU * sinW -
+         wFit * sigmaU2 * sigmaV2 * sigmaW2 * cosV * cosV * sinW - wFit * sigmaU2 * sigmaW2 * sigmaFit2 * cosV * cosV * sinW -
+         sigmaU2 * sigmaV2 * sigmaFit2 * w * cosV * cosV * sinW - sigmaU2 * sigmaFit2 * sigmaFit2 * w * cosV * cosV * sinW +
+         uFit * sigmaU2 * sigmaV2 * sigmaW2 * cosU * cosW * sinW + uFit * sigmaU2 * sigmaV2 * sigmaFit2 * cosU * cosW * sinW +
+         sigmaV2 * sigmaW2 * sigmaFit2 * u * cosU * cosW * sinW + sigmaV2 * sigmaFit2 * sigmaFit2 * u * cosU * cosW * sinW +
+         vFit * sigmaU2 * sigmaV2 * sigmaW2 * cosV * cosW * sinW + vFit * sigmaU2 * sigmaV2 * sigmaFit2 * cosV * cosW * sinW +
+         sigmaU2 * sigmaW2 * sigmaFit2 * v * cosV * cosW * sinW + sigmaU2 * sigmaFit2 * sigmaFit2 * v * cosV * cosW * sinW) /
+        (sigmaU2 * sigmaV2 * sigmaW2 * cosV * cosV * sinU * sinU + sigmaU2 * sigmaW2 * sigmaFit2 * cosV * cosV * sinU * sinU +
+         sigmaV2 * sigmaW2 * sigmaFit2 * cosV * cosV * sinU * sinU + sigmaW2 * sigmaFit2 * sigmaFit2 * cosV * cosV * sinU * sinU +
+         sigmaU2 * sigmaV2 * sigmaW2 * cosW * cosW * sinU * sinU + sigmaU2 * sigmaV2 * sigmaFit2 * cosW * cosW * sinU * sinU +
+         sigmaV2 * sigmaW2 * sigmaFit2 * cosW * cosW * sinU * sinU + sigmaV2 * sigmaFit2 * sigmaFit2 * cosW * cosW * sinU * sinU -
+         2. * sigmaU2 * sigmaV2 * sigmaW2 * cosU * cosV * sinU * sinV - 2. * sigmaU2 * sigmaW2 * sigmaFit2 * cosU * cosV * sinU * sinV -
+         2. * sigmaV2 * sigmaW2 * sigmaFit2 * cosU * cosV * sinU * sinV - 2. * sigmaW2 * sigmaFit2 * sigmaFit2 * cosU * cosV * sinU * sinV +
+         sigmaU2 * sigmaV2 * sigmaW2 * cosU * cosU * sinV * sinV + sigmaU2 * sigmaW2 * sigmaFit2 * cosU * cosU * sinV * sinV +
+         sigmaV2 * sigmaW2 * sigmaFit2 * cosU * cosU * sinV * sinV + sigmaW2 * sigmaFit2 * sigmaFit2 * cosU * cosU * sinV * sinV +
+         sigmaU2 * sigmaV2 * sigmaW2 * cosW * cosW * sinV * sinV + sigmaU2 * sigmaV2 * sigmaFit2 * cosW * cosW * sinV * sinV +
+         sigmaU2 * sigmaW2 * sigmaFit2 * cosW * cosW * sinV * sinV + sigmaU2 * sigmaFit2 * sigmaFit2 * cosW * cosW * sinV * sinV -
+         2. * sigmaU2 * sigmaV2 * sigmaW2 * cosU * cosW * sinU * sinW - 2. * sigmaU2 * sigmaV2 * sigmaFit2 * cosU * cosW * sinU * sinW -
+         2. * sigmaV2 * sigmaW2 * sigmaFit2 * cosU * cosW * sinU * sinW - 2. * sigmaV2 * sigmaFit2 * sigmaFit2 * cosU * cosW * sinU * sinW -
+         2. * sigmaU2 * sigmaV2 * sigmaW2 * cosV * cosW * sinV * sinW - 2. * sigmaU2 * sigmaV2 * sigmaFit2 * cosV * cosW * sinV * sinW -
+         2. * sigmaU2 * sigmaW2 * sigmaFit2 * cosV * cosW * sinV * sinW - 2. * sigmaU2 * sigmaFit2 * sigmaFit2 * cosV * cosW * sinV * sinW +
+         sigmaU2 * sigmaV2 * sigmaW2 * cosU * cosU * sinW * sinW + sigmaU2 * sigmaV2 * sigmaFit2 * cosU * cosU * sinW * sinW +
+         sigmaV2 * sigmaW2 * sigmaFit2 * cosU * cosU * sinW * sinW + sigmaV2 * sigmaFit2 * sigmaFit2 * cosU * cosU * sinW * sinW +
+         sigmaU2 * sigmaV2 * sigmaW2 * cosV * cosV * sinW * sinW + sigmaU2 * sigmaV2 * sigmaFit2 * cosV * cosV * sinW * sinW +
+         sigmaU2 * sigmaW2 * sigmaFit2 * cosV * cosV * sinW * sinW+sigmaU2 * sigmaFit2 * sigmaFit2 * cosV * cosV * sinW * sinW);
+
+    z = (vFit * sigmaU2 * sigmaV2 * sigmaW2 * cosV * sinU * sinU + vFit * sigmaV2 * sigmaW2 * sigmaFit2 * cosV * sinU * sinU +
+         sigmaU2 * sigmaW2 * sigmaFit2 * v * cosV * sinU * sinU + sigmaW2 * sigmaFit2 * sigmaFit2 * v * cosV * sinU * sinU +
+         wFit * sigmaU2 * sigmaV2 * sigmaW2 * cosW * sinU * sinU + wFit * sigmaV2 * sigmaW2 * sigmaFit2 * cosW * sinU * sinU +
+         sigmaU2 * sigmaV2 * sigmaFit2 * w * cosW * sinU * sinU + sigmaV2 * sigmaFit2 * sigmaFit2 * w * cosW * sinU * sinU -
+         vFit * sigmaU2 * sigmaV2 * sigmaW2 * cosU * sinU * sinV - vFit * sigmaV2 * sigmaW2 * sigmaFit2 * cosU * sinU * sinV -
+         sigmaU2 * sigmaW2 * sigmaFit2 * v * cosU * sinU * sinV - sigmaW2 * sigmaFit2 * sigmaFit2 * v * cosU * sinU * sinV -
+         uFit * sigmaU2 * sigmaV2 * sigmaW2 * cosV * sinU * sinV - uFit * sigmaU2 * sigmaW2 * sigmaFit2 * cosV * sinU * sinV -
+         sigmaV2 * sigmaW2 * sigmaFit2 * u * cosV * sinU * sinV - sigmaW2 * sigmaFit2 * sigmaFit2 * u * cosV * sinU * sinV +
+         uFit * sigmaU2 * sigmaV2 * sigmaW2 * cosU * sinV * sinV + uFit * sigmaU2 * sigmaW2 * sigmaFit2 * cosU * sinV * sinV +
+         sigmaV2 * sigmaW2 * sigmaFit2 * u * cosU * sinV * sinV + sigmaW2 * sigmaFit2 * sigmaFit2 * u * cosU * sinV * sinV +
+         wFit * sigmaU2 * sigmaV2 * sigmaW2 * cosW * sinV * sinV + wFit * sigmaU2 * sigmaW2 * sigmaFit2 * cosW * sinV * sinV +
+         sigmaU2 * sigmaV2 * sigmaFit2 * w * cosW * sinV * sinV + sigmaU2 * sigmaFit2 * sigmaFit2 * w * cosW * sinV * sinV -
+         wFit * sigmaU2 * sigmaV2 * sigmaW2 * cosU * sinU * sinW - wFit * sigmaV2 * sigmaW2 * sigmaFit2 * cosU * sinU * sinW -
+         sigmaU2 * sigmaV2 * sigmaFit2 * w * cosU * sinU * sinW - sigmaV2 * sigmaFit2 * sigmaFit2 * w * cosU * sinU * sinW -
+         uFit * sigmaU2 * sigmaV2 * sigmaW2 * cosW * sinU * sinW - uFit * sigmaU2 * sigmaV2 * sigmaFit2 * cosW * sinU * sinW -
+         sigmaV2 * sigmaW2 * sigmaFit2 * u * cosW * sinU * sinW - sigmaV2 * sigmaFit2 * sigmaFit2 * u * cosW * sinU * sinW -
+         wFit * sigmaU2 * sigmaV2 * sigmaW2 * cosV * sinV * sinW - wFit * sigmaU2 * sigmaW2 * sigmaFit2 * cosV * sinV * sinW -
+         sigmaU2 * sigmaV2 * sigmaFit2 * w * cosV * sinV * sinW - sigmaU2 * sigmaFit2 * sigmaFit2 * w * cosV * sinV * sinW -
+         vFit * sigmaU2 * sigmaV2 * sigmaW2 * cosW * sinV * sinW - vFit * sigmaU2 * sigmaV2 * sigmaFit2 * cosW * sinV * sinW -
+         sigmaU2 * sigmaW2 * sigmaFit2 * v * cosW * sinV * sinW - sigmaU2 * sigmaFit2 * sigmaFit2 * v * cosW * sinV * sinW +
+         uFit * sigmaU2 * sigmaV2 * sigmaW2 * cosU * sinW * sinW + uFit * sigmaU2 * sigmaV2 * sigmaFit2 * cosU * sinW * sinW +
+         sigmaV2 * sigmaW2 * sigmaFit2 * u * cosU * sinW * sinW + sigmaV2 * sigmaFit2 * sigmaFit2 * u * cosU * sinW * sinW +
+         vFit * sigmaU2 * sigmaV2 * sigmaW2 * cosV * sinW * sinW + vFit * sigmaU2 * sigmaV2 * sigmaFit2 * cosV * sinW * sinW +
+         sigmaU2 * sigmaW2 * sigmaFit2 * v * cosV * sinW * sinW + sigmaU2 * sigmaFit2 * sigmaFit2 * v * cosV * sinW * sinW) /
+        (sigmaU2 * sigmaV2 * sigmaW2 * cosV * cosV * sinU * sinU + sigmaU2 * sigmaW2 * sigmaFit2 * cosV * cosV * sinU * sinU +
+         sigmaV2 * sigmaW2 * sigmaFit2 * cosV * cosV * sinU * sinU + sigmaW2 * sigmaFit2 * sigmaFit2 * cosV * cosV * sinU * sinU +
+         sigmaU2 * sigmaV2 * sigmaW2 * cosW * cosW * sinU * sinU + sigmaU2 * sigmaV2 * sigmaFit2 * cosW * cosW * sinU * sinU +
+         sigmaV2 * sigmaW2 * sigmaFit2 * cosW * cosW * sinU * sinU + sigmaV2 * sigmaFit2 * sigmaFit2 * cosW * cosW * sinU * sinU -
+         2. * sigmaU2 * sigmaV2 * sigmaW2 * cosU * cosV * sinU * sinV-2. * sigmaU2 * sigmaW2 * sigmaFit2 * cosU * cosV * sinU * sinV -
+         2. * sigmaV2 * sigmaW2 * sigmaFit2 * cosU * cosV * sinU * sinV-2. * sigmaW2 * sigmaFit2 * sigmaFit2 * cosU * cosV * sinU * sinV +
+         sigmaU2 * sigmaV2 * sigmaW2 * cosU * cosU * sinV * sinV + sigmaU2 * sigmaW2 * sigmaFit2 * cosU * cosU * sinV * sinV +
+         sigmaV2 * sigmaW2 * sigmaFit2 * cosU * cosU * sinV * sinV + sigmaW2 * sigmaFit2 * sigmaFit2 * cosU * cosU * sinV * sinV +
+         sigmaU2 * sigmaV2 * sigmaW2 * cosW * cosW * sinV * sinV + sigmaU2 * sigmaV2 * sigmaFit2 * cosW * cosW * sinV * sinV +
+         sigmaU2 * sigmaW2 * sigmaFit2 * cosW * cosW * sinV * sinV + sigmaU2 * sigmaFit2 * sigmaFit2 * cosW * cosW * sinV * sinV -
+         2. * sigmaU2 * sigmaV2 * sigmaW2 * cosU * cosW * sinU * sinW - 2. * sigmaU2 * sigmaV2 * sigmaFit2 * cosU * cosW * sinU * sinW -
+         2. * sigmaV2 * sigmaW2 * sigmaFit2 * cosU * cosW * sinU * sinW - 2. * sigmaV2 * sigmaFit2 * sigmaFit2 * cosU * cosW * sinU * sinW -
+         2. * sigmaU2 * sigmaV2 * sigmaW2 * cosV * cosW * sinV * sinW - 2. * sigmaU2 * sigmaV2 * sigmaFit2 * cosV * cosW * sinV * sinW -
+         2. * sigmaU2 * sigmaW2 * sigmaFit2 * cosV * cosW * sinV * sinW - 2. * sigmaU2 * sigmaFit2 * sigmaFit2 * cosV * cosW * sinV * sinW +
+         sigmaU2 * sigmaV2 * sigmaW2 * cosU * cosU * sinW * sinW + sigmaU2 * sigmaV2 * sigmaFit2 * cosU * cosU * sinW * sinW +
+         sigmaV2 * sigmaW2 * sigmaFit2 * cosU * cosU * sinW * sinW + sigmaV2 * sigmaFit2 * sigmaFit2 * cosU * cosU * sinW * sinW +
+         sigmaU2 * sigmaV2 * sigmaW2 * cosV * cosV * sinW * sinW + sigmaU2 * sigmaV2 * sigmaFit2 * cosV * cosV * sinW * sinW +
+         sigmaU2 * sigmaW2 * sigmaFit2 * cosV * cosV * sinW * sinW + sigmaU2 * sigmaFit2 * sigmaFit2 * cosV * cosV * sinW * sinW);
 
     const double outputU(LArRotationalTransformationPlugin::YZtoU(y, z));
     const double outputV(LArRotationalTransformationPlugin::YZtoV(y, z));
@@ -264,6 +256,24 @@ void LArRotationalTransformationPlugin::GetMinChiSquaredYZ(const double u, const
         ((deltaUFit * deltaUFit) / sigmaFit2) + ((deltaVFit * deltaVFit) / sigmaFit2) + ((deltaWFit * deltaWFit) / sigmaFit2);
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArRotationalTransformationPlugin::GetMinChiSquaredYZ(const std::size_t n, const double *const pU, const double *const pV, const double *const pW,
+    const double sigmaU, const double sigmaV, const double sigmaW, double *const pY, double *const pZ, double *const pChiSquared) const
+{
+    const LArMinChiSquaredYZSolver solver(m_transformation, sigmaU, sigmaV, sigmaW);
+    solver.Solve(n, pU, pV, pW, pY, pZ, pChiSquared);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void LArRotationalTransformationPlugin::GetMinChiSquaredYZ(const std::size_t n, const double *const pU, const double *const pV, const double *const pW,
+    const double *const pUFit, const double *const pVFit, const double *const pWFit, const double sigmaU, const double sigmaV, const double sigmaW,
+    const double sigmaFit, double *const pY, double *const pZ, double *const pChiSquared) const
+{
+    const LArMinChiSquaredYZSolver solver(m_transformation, sigmaU, sigmaV, sigmaW, sigmaFit);
+    solver.Solve(n, pU, pV, pW, pUFit, pVFit, pWFit, pY, pZ, pChiSquared);
+}
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -278,24 +288,16 @@ StatusCode LArRotationalTransformationPlugin::Initialize()
     }
 
     const LArTPC *const pFirstLArTPC(larTPCMap.begin()->second);
-    m_thetaU = pFirstLArTPC->GetWireAngleU();
-    m_thetaV = pFirstLArTPC->GetWireAngleV();
-    m_thetaW = pFirstLArTPC->GetWireAngleW();
+    const double thetaU(pFirstLArTPC->GetWireAngleU());
+    const double thetaV(pFirstLArTPC->GetWireAngleV());
+    const double thetaW(pFirstLArTPC->GetWireAngleW());
     const double sigmaUVW(pFirstLArTPC->GetSigmaUVW());
 
-    m_sinU = std::sin(m_thetaU);
-    m_sinV = std::sin(m_thetaV);
-    m_sinW = std::sin(m_thetaW);
-    m_cosU = std::cos(m_thetaU);
-    m_cosV = std::cos(m_thetaV);
-    m_cosW = std::cos(m_thetaW);
-
-    m_sinVminusU = std::sin(m_thetaV - m_thetaU);
-    m_sinWminusV = std::sin(m_thetaW - m_thetaV);
-    m_sinUminusW = std::sin(m_thetaU - m_thetaW);
+    m_transformation = LArRotationalTransformation(thetaU, thetaV, thetaW);
 
-    if ((std::fabs(m_sinVminusU) < std::numeric_limits<double>::epsilon()) || (std::fabs(m_sinWminusV) < std::numeric_limits<double>::epsilon()) ||
-        (std::fabs(m_sinUminusW) < std::numeric_limits<double>::epsilon()))
+    if ((std::fabs(m_transformation.GetSinVminusU()) < std::numeric_limits<double>::epsilon()) ||
+        (std::fabs(m_transformation.GetSinWminusV()) < std::numeric_limits<double>::epsilon()) ||
+        (std::fabs(m_transformation.GetSinUminusW()) < std::numeric_limits<double>::epsilon()))
     {
         std::cout << "LArRotationalTransformationPlugin::Initialize - Equal wire angles; Plugin does not support provided LArTPC configurations. " << std::endl;
         return STATUS_CODE_INVALID_PARAMETER;
@@ -305,9 +307,9 @@ StatusCode LArRotationalTransformationPlugin::Initialize()
     {
         const LArTPC *const pLArTPC(mapEntry.second);
 
-        if ((std::fabs(m_thetaU - pLArTPC->GetWireAngleU()) > m_maxAngularDiscrepancyU) ||
-            (std::fabs(m_thetaV - pLArTPC->GetWireAngleV()) > m_maxAngularDiscrepancyV) ||
-            (std::fabs(m_thetaW - pLArTPC->GetWireAngleW()) > m_maxAngularDiscrepancyW) ||
+        if ((std::fabs(thetaU - pLArTPC->GetWireAngleU()) > m_maxAngularDiscrepancyU) ||
+            (std::fabs(thetaV - pLArTPC->GetWireAngleV()) > m_maxAngularDiscrepancyV) ||
+            (std::fabs(thetaW - pLArTPC->GetWireAngleW()) > m_maxAngularDiscrepancyW) ||
             (std::fabs(sigmaUVW - pLArTPC->GetSigmaUVW()) > m_maxSigmaDiscrepancy))
         {
             std::cout << "LArRotationalTransformationPlugin::Initialize - Dissimilar drift volumes; Plugin does not support provided LArTPC configurations. " << std::endl;
@@ -10,9 +10,365 @@
 
 #include "Plugins/LArTransformationPlugin.h"
 
+#include "Pandora/StatusCodes.h"
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
 namespace lar_content
 {
 
+/**
+ *  @brief  LArRotationalTransformation class, an inlinable value-type snapshot of the wire angles, providing the transformations used by the
+ *          rotational transformation plugin without virtual function calls
+ */
+class LArRotationalTransformation
+{
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    LArRotationalTransformation();
+
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  thetaU inclination of U wires (radians)
+     *  @param  thetaV inclination of V wires (radians)
+     *  @param  thetaW inclination of W wires (radians)
+     */
+    LArRotationalTransformation(const double thetaU, const double thetaV, const double thetaW);
+
+    /**
+     *  @brief  Transform (u, v) to w coordinate
+     *
+     *  @param  u the u coordinate
+     *  @param  v the v coordinate
+     *
+     *  @return the w coordinate
+     */
+    double UVtoW(const double u, const double v) const;
+
+    /**
+     *  @brief  Transform (v, w) to u coordinate
+     *
+     *  @param  v the v coordinate
+     *  @param  w the w coordinate
+     *
+     *  @return the u coordinate
+     */
+    double VWtoU(const double v, const double w) const;
+
+    /**
+     *  @brief  Transform (w, u) to v coordinate
+     *
+     *  @param  w the w coordinate
+     *  @param  u the u coordinate
+     *
+     *  @return the v coordinate
+     */
+    double WUtoV(const double w, const double u) const;
+
+    /**
+     *  @brief  Transform (u, v) to y coordinate
+     *
+     *  @param  u the u coordinate
+     *  @param  v the v coordinate
+     *
+     *  @return the y coordinate
+     */
+    double UVtoY(const double u, const double v) const;
+
+    /**
+     *  @brief  Transform (u, v) to z coordinate
+     *
+     *  @param  u the u coordinate
+     *  @param  v the v coordinate
+     *
+     *  @return the z coordinate
+     */
+    double UVtoZ(const double u, const double v) const;
+
+    /**
+     *  @brief  Transform (u, w) to y coordinate
+     *
+     *  @param  u the u coordinate
+     *  @param  w the w coordinate
+     *
+     *  @return the y coordinate
+     */
+    double UWtoY(const double u, const double w) const;
+
+    /**
+     *  @brief  Transform (u, w) to z coordinate
+     *
+     *  @param  u the u coordinate
+     *  @param  w the w coordinate
+     *
+     *  @return the z coordinate
+     */
+    double UWtoZ(const double u, const double w) const;
+
+    /**
+     *  @brief  Transform (v, w) to y coordinate
+     *
+     *  @param  v the v coordinate
+     *  @param  w the w coordinate
+     *
+     *  @return the y coordinate
+     */
+    double VWtoY(const double v, const double w) const;
+
+    /**
+     *  @brief  Transform (v, w) to z coordinate
+     *
+     *  @param  v the v coordinate
+     *  @param  w the w coordinate
+     *
+     *  @return the z coordinate
+     */
+    double VWtoZ(const double v, const double w) const;
+
+    /**
+     *  @brief  Transform (y, z) to u coordinate
+     *
+     *  @param  y the y coordinate
+     *  @param  z the z coordinate
+     *
+     *  @return the u coordinate
+     */
+    double YZtoU(const double y, const double z) const;
+
+    /**
+     *  @brief  Transform (y, z) to v coordinate
+     *
+     *  @param  y the y coordinate
+     *  @param  z the z coordinate
+     *
+     *  @return the v coordinate
+     */
+    double YZtoV(const double y, const double z) const;
+
+    /**
+     *  @brief  Transform (y, z) to w coordinate
+     *
+     *  @param  y the y coordinate
+     *  @param  z the z coordinate
+     *
+     *  @return the w coordinate
+     */
+    double YZtoW(const double y, const double z) const;
+
+    /**
+     *  @brief  Get sin(thetaU)
+     *
+     *  @return sin(thetaU)
+     */
+    double GetSinU() const;
+
+    /**
+     *  @brief  Get sin(thetaV)
+     *
+     *  @return sin(thetaV)
+     */
+    double GetSinV() const;
+
+    /**
+     *  @brief  Get sin(thetaW)
+     *
+     *  @return sin(thetaW)
+     */
+    double GetSinW() const;
+
+    /**
+     *  @brief  Get cos(thetaU)
+     *
+     *  @return cos(thetaU)
+     */
+    double GetCosU() const;
+
+    /**
+     *  @brief  Get cos(thetaV)
+     *
+     *  @return cos(thetaV)
+     */
+    double GetCosV() const;
+
+    /**
+     *  @brief  Get cos(thetaW)
+     *
+     *  @return cos(thetaW)
+     */
+    double GetCosW() const;
+
+    /**
+     *  @brief  Get sin(thetaV - thetaU)
+     *
+     *  @return sin(thetaV - thetaU)
+     */
+    double GetSinVminusU() const;
+
+    /**
+     *  @brief  Get sin(thetaW - thetaV)
+     *
+     *  @return sin(thetaW - thetaV)
+     */
+    double GetSinWminusV() const;
+
+    /**
+     *  @brief  Get sin(thetaU - thetaW)
+     *
+     *  @return sin(thetaU - thetaW)
+     */
+    double GetSinUminusW() const;
+
+private:
+    double    m_sinU;                   ///< sin(thetaU)
+    double    m_sinV;                   ///< sin(thetaV)
+    double    m_sinW;                   ///< sin(thetaW)
+    double    m_cosU;                   ///< cos(thetaU)
+    double    m_cosV;                   ///< cos(thetaV)
+    double    m_cosW;                   ///< cos(thetaW)
+    double    m_sinVminusU;             ///< sin(thetaV - thetaU)
+    double    m_sinWminusV;             ///< sin(thetaW - thetaV)
+    double    m_sinUminusW;             ///< sin(thetaU - thetaW)
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+/**
+ *  @brief  LArMinChiSquaredYZSolver class, a closed-form solver for the (y, z) position that minimises the chi squared with respect to u, v and
+ *          w coordinates, and optionally to fitted u, v and w coordinates, with fixed uncertainties. The inverse of the normal equations is
+ *          calculated once, on construction, so that each solution is a pair of three-term dot products. Results agree with the rotational
+ *          transformation plugin GetMinChiSquaredYZ functions to within floating point rounding.
+ */
+class LArMinChiSquaredYZSolver
+{
+public:
+    /**
+     *  @brief  Constructor, for solutions with respect to u, v and w coordinates
+     *
+     *  @param  transformation the rotational transformation
+     *  @param  sigmaU the uncertainty in u coordinates
+     *  @param  sigmaV the uncertainty in v coordinates
+     *  @param  sigmaW the uncertainty in w coordinates
+     */
+    LArMinChiSquaredYZSolver(const LArRotationalTransformation &transformation, const double sigmaU, const double sigmaV, const double sigmaW);
+
+    /**
+     *  @brief  Constructor, for solutions with respect to u, v and w coordinates and fitted u, v and w coordinates
+     *
+     *  @param  transformation the rotational transformation
+     *  @param  sigmaU the uncertainty in u coordinates
+     *  @param  sigmaV the uncertainty in v coordinates
+     *  @param  sigmaW the uncertainty in w coordinates
+     *  @param  sigmaFit the uncertainty in fitted coordinates
+     */
+    LArMinChiSquaredYZSolver(const LArRotationalTransformation &transformation, const double sigmaU, const double sigmaV, const double sigmaW,
+        const double sigmaFit);
+
+    /**
+     *  @brief  Get the (y, z) position that minimises the chi squared with respect to u, v and w coordinates
+     *
+     *  @param  u the u coordinate
+     *  @param  v the v coordinate
+     *  @param  w the w coordinate
+     *  @param  y to receive the y coordinate
+     *  @param  z to receive the z coordinate
+     *  @param  chiSquared to receive the chi squared value
+     *
+     *  @throws StatusCodeException, if the solver was constructed with a fit uncertainty
+     */
+    void Solve(const double u, const double v, const double w, double &y, double &z, double &chiSquared) const;
+
+    /**
+     *  @brief  Get the (y, z) position that minimises the chi squared with respect to u, v and w coordinates and fitted u, v and w coordinates
+     *
+     *  @param  u the u coordinate
+     *  @param  v the v coordinate
+     *  @param  w the w coordinate
+     *  @param  uFit the fitted u coordinate
+     *  @param  vFit the fitted v coordinate
+     *  @param  wFit the fitted w coordinate
+     *  @param  y to receive the y coordinate
+     *  @param  z to receive the z coordinate
+     *  @param  chiSquared to receive the chi squared value
+     *
+     *  @throws StatusCodeException, if the solver was constructed without a fit uncertainty
+     */
+    void Solve(const double u, const double v, const double w, const double uFit, const double vFit, const double wFit, double &y, double &z,
+        double &chiSquared) const;
+
+    /**
+     *  @brief  Solve for n sets of u, v and w coordinates, in a single loop without indirect calls
+     *
+     *  @param  n the number of sets of coordinates
+     *  @param  pU the address of the first of n contiguous u coordinates
+     *  @param  pV the address of the first of n contiguous v coordinates
+     *  @param  pW the address of the first of n contiguous w coordinates
+     *  @param  pY the address of the first of n contiguous elements to receive the y coordinates
+     *  @param  pZ the address of the first of n contiguous elements to receive the z coordinates
+     *  @param  pChiSquared the address of the first of n contiguous elements to receive the chi squared values
+     *
+     *  @throws StatusCodeException, if the solver was constructed with a fit uncertainty
+     */
+    template <typename T>
+    void Solve(const std::size_t n, const T *const pU, const T *const pV, const T *const pW, T *const pY, T *const pZ, T *const pChiSquared) const;
+
+    /**
+     *  @brief  Solve for n sets of u, v and w coordinates and fitted u, v and w coordinates, in a single loop without indirect calls
+     *
+     *  @param  n the number of sets of coordinates
+     *  @param  pU the address of the first of n contiguous u coordinates
+     *  @param  pV the address of the first of n contiguous v coordinates
+     *  @param  pW the address of the first of n contiguous w coordinates
+     *  @param  pUFit the address of the first of n contiguous fitted u coordinates
+     *  @param  pVFit the address of the first of n contiguous fitted v coordinates
+     *  @param  pWFit the address of the first of n contiguous fitted w coordinates
+     *  @param  pY the address of the first of n contiguous elements to receive the y coordinates
+     *  @param  pZ the address of the first of n contiguous elements to receive the z coordinates
+     *  @param  pChiSquared the address of the first of n contiguous elements to receive the chi squared values
+     *
+     *  @throws StatusCodeException, if the solver was constructed without a fit uncertainty
+     */
+    template <typename T>
+    void Solve(const std::size_t n, const T *const pU, const T *const pV, const T *const pW, const T *const pUFit, const T *const pVFit,
+        const T *const pWFit, T *const pY, T *const pZ, T *const pChiSquared) const;
+
+private:
+    /**
+     *  @brief  Calculate the coefficients of the weighted coordinates in the (y, z) solution, by inverting the normal equations
+     */
+    void CalculateCoefficients();
+
+    /**
+     *  @brief  Get the (y, z) position that minimises the chi squared, given the weighted sums of measured and fitted coordinates in each view
+     *
+     *  @param  sumU the weighted sum of u coordinates
+     *  @param  sumV the weighted sum of v coordinates
+     *  @param  sumW the weighted sum of w coordinates
+     *  @param  y to receive the y coordinate
+     *  @param  z to receive the z coordinate
+     */
+    void GetPosition(const double sumU, const double sumV, const double sumW, double &y, double &z) const;
+
+    LArRotationalTransformation m_transformation;   ///< The rotational transformation
+    bool      m_hasFit;                 ///< Whether the solver includes fitted coordinates
+    double    m_sigmaU2;                ///< The u coordinate uncertainty squared
+    double    m_sigmaV2;                ///< The v coordinate uncertainty squared
+    double    m_sigmaW2;                ///< The w coordinate uncertainty squared
+    double    m_sigmaFit2;              ///< The fitted coordinate uncertainty squared (zero if no fitted coordinates)
+    double    m_yU;                     ///< The coefficient of the weighted u coordinate sum in the y solution
+    double    m_yV;                     ///< The coefficient of the weighted v coordinate sum in the y solution
+    double    m_yW;                     ///< The coefficient of the weighted w coordinate sum in the y solution
+    double    m_zU;                     ///< The coefficient of the weighted u coordinate sum in the z solution
+    double    m_zV;                     ///< The coefficient of the weighted v coordinate sum in the z solution
+    double    m_zW;                     ///< The coefficient of the weighted w coordinate sum in the z solution
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 /**
  *  @brief  LArRotationalTransformationPlugin class
  */
@@ -44,30 +400,398 @@ public:
     virtual void GetMinChiSquaredYZ(const double u, const double v, const double w, const double sigmaU, const double sigmaV, const double sigmaW,
         const double uFit, const double vFit, const double wFit, const double sigmaFit, double &y, double &z, double &chiSquared) const;
 
+    /**
+     *  @brief  Get the (y, z) positions that minimise the chi squared for n sets of u, v and w coordinates with common uncertainties, using a
+     *          closed-form solver constructed once for the batch
+     *
+     *  @param  n the number of sets of coordinates
+     *  @param  pU the address of the first of n contiguous u coordinates
+     *  @param  pV the address of the first of n contiguous v coordinates
+     *  @param  pW the address of the first of n contiguous w coordinates
+     *  @param  sigmaU the uncertainty in u coordinates
+     *  @param  sigmaV the uncertainty in v coordinates
+     *  @param  sigmaW the uncertainty in w coordinates
+     *  @param  pY the address of the first of n contiguous elements to receive the y coordinates
+     *  @param  pZ the address of the first of n contiguous elements to receive the z coordinates
+     *  @param  pChiSquared the address of the first of n contiguous elements to receive the chi squared values
+     */
+    void GetMinChiSquaredYZ(const std::size_t n, const double *const pU, const double *const pV, const double *const pW, const double sigmaU,
+        const double sigmaV, const double sigmaW, double *const pY, double *const pZ, double *const pChiSquared) const;
+
+    /**
+     *  @brief  Get the (y, z) positions that minimise the chi squared for n sets of u, v and w coordinates and fitted u, v and w coordinates
+     *          with common uncertainties, using a closed-form solver constructed once for the batch
+     *
+     *  @param  n the number of sets of coordinates
+     *  @param  pU the address of the first of n contiguous u coordinates
+     *  @param  pV the address of the first of n contiguous v coordinates
+     *  @param  pW the address of the first of n contiguous w coordinates
+     *  @param  pUFit the address of the first of n contiguous fitted u coordinates
+     *  @param  pVFit the address of the first of n contiguous fitted v coordinates
+     *  @param  pWFit the address of the first of n contiguous fitted w coordinates
+     *  @param  sigmaU the uncertainty in u coordinates
+     *  @param  sigmaV the uncertainty in v coordinates
+     *  @param  sigmaW the uncertainty in w coordinates
+     *  @param  sigmaFit the uncertainty in fitted coordinates
+     *  @param  pY the address of the first of n contiguous elements to receive the y coordinates
+     *  @param  pZ the address of the first of n contiguous elements to receive the z coordinates
+     *  @param  pChiSquared the address of the first of n contiguous elements to receive the chi squared values
+     */
+    void GetMinChiSquaredYZ(const std::size_t n, const double *const pU, const double *const pV, const double *const pW, const double *const pUFit,
+        const double *const pVFit, const double *const pWFit, const double sigmaU, const double sigmaV, const double sigmaW, const double sigmaFit,
+        double *const pY, double *const pZ, double *const pChiSquared) const;
+
+    /**
+     *  @brief  Get the value-type snapshot of the transformation, allowing clients to inline the transformations in tight loops
+     *
+     *  @return the rotational transformation
+     */
+    const LArRotationalTransformation &GetTransformation() const;
+
 private:
     pandora::StatusCode Initialize();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
-    double    m_thetaU;                 ///< inclination of U wires (radians)
-    double    m_thetaV;                 ///< inclination of V wires (radians)
-    double    m_thetaW;                 ///< inclination of W wires (radians)
-
-    double    m_sinU;                   ///< sin(thetaU)
-    double    m_sinV;                   ///< sin(thetaV)
-    double    m_sinW;                   ///< sin(thetaW)
-    double    m_cosU;                   ///< cos(thetaU)
-    double    m_cosV;                   ///< cos(thetaV)
-    double    m_cosW;                   ///< cos(thetaW)
-    double    m_sinVminusU;             ///< sin(thetaV - thetaU)
-    double    m_sinWminusV;             ///< sin(thetaW - thetaV)
-    double    m_sinUminusW;             ///< sin(thetaU - thetaW)
-
     double    m_maxAngularDiscrepancyU; ///< Maximum allowed difference between u wire angles between LArTPCs
     double    m_maxAngularDiscrepancyV; ///< Maximum allowed difference between v wire angles between LArTPCs
     double    m_maxAngularDiscrepancyW; ///< Maximum allowed difference between w wire angles between LArTPCs
     double    m_maxSigmaDiscrepancy;    ///< Maximum allowed difference between like wire sigma values between LArTPCs
+
+    LArRotationalTransformation m_transformation;   ///< The transformation, holding the wire angle sines and cosines used by all transforms
 };
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline LArRotationalTransformation::LArRotationalTransformation() :
+    m_sinU(0.),
+    m_sinV(0.),
+    m_sinW(0.),
+    m_cosU(0.),
+    m_cosV(0.),
+    m_cosW(0.),
+    m_sinVminusU(0.),
+    m_sinWminusV(0.),
+    m_sinUminusW(0.)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline LArRotationalTransformation::LArRotationalTransformation(const double thetaU, const double thetaV, const double thetaW) :
+    m_sinU(std::sin(thetaU)),
+    m_sinV(std::sin(thetaV)),
+    m_sinW(std::sin(thetaW)),
+    m_cosU(std::cos(thetaU)),
+    m_cosV(std::cos(thetaV)),
+    m_cosW(std::cos(thetaW)),
+    m_sinVminusU(std::sin(thetaV - thetaU)),
+    m_sinWminusV(std::sin(thetaW - thetaV)),
+    m_sinUminusW(std::sin(thetaU - thetaW))
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline double LArRotationalTransformation::UVtoW(const double u, const double v) const
+{
+    return (-1. * (u * m_sinWminusV + v * m_sinUminusW) / m_sinVminusU);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline double LArRotationalTransformation::VWtoU(const double v, const double w) const
+{
+    return (-1. * (v * m_sinUminusW + w * m_sinVminusU) / m_sinWminusV);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline double LArRotationalTransformation::WUtoV(const double w, const double u) const
+{
+    return (-1. * (u * m_sinWminusV + w * m_sinVminusU) / m_sinUminusW);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline double LArRotationalTransformation::UVtoY(const double u, const double v) const
+{
+    return ((u * m_cosV - v * m_cosU) / m_sinVminusU);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline double LArRotationalTransformation::UVtoZ(const double u, const double v) const
+{
+    return ((u * m_sinV - v * m_sinU) / m_sinVminusU);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline double LArRotationalTransformation::UWtoY(const double u, const double w) const
+{
+    return ((w * m_cosU - u * m_cosW) / m_sinUminusW);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline double LArRotationalTransformation::UWtoZ(const double u, const double w) const
+{
+    return ((w * m_sinU - u * m_sinW) / m_sinUminusW);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline double LArRotationalTransformation::VWtoY(const double v, const double w) const
+{
+    return ((v * m_cosW - w * m_cosV) / m_sinWminusV);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline double LArRotationalTransformation::VWtoZ(const double v, const double w) const
+{
+    return ((v * m_sinW - w * m_sinV) / m_sinWminusV);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline double LArRotationalTransformation::YZtoU(const double y, const double z) const
+{
+    return (z * m_cosU - y * m_sinU);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline double LArRotationalTransformation::YZtoV(const double y, const double z) const
+{
+    return (z * m_cosV - y * m_sinV);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline double LArRotationalTransformation::YZtoW(const double y, const double z) const
+{
+    return (z * m_cosW - y * m_sinW);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline double LArRotationalTransformation::GetSinU() const
+{
+    return m_sinU;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline double LArRotationalTransformation::GetSinV() const
+{
+    return m_sinV;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline double LArRotationalTransformation::GetSinW() const
+{
+    return m_sinW;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline double LArRotationalTransformation::GetCosU() const
+{
+    return m_cosU;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline double LArRotationalTransformation::GetCosV() const
+{
+    return m_cosV;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline double LArRotationalTransformation::GetCosW() const
+{
+    return m_cosW;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline double LArRotationalTransformation::GetSinVminusU() const
+{
+    return m_sinVminusU;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline double LArRotationalTransformation::GetSinWminusV() const
+{
+    return m_sinWminusV;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline double LArRotationalTransformation::GetSinUminusW() const
+{
+    return m_sinUminusW;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline LArMinChiSquaredYZSolver::LArMinChiSquaredYZSolver(const LArRotationalTransformation &transformation, const double sigmaU,
+        const double sigmaV, const double sigmaW) :
+    m_transformation(transformation),
+    m_hasFit(false),
+    m_sigmaU2(sigmaU * sigmaU),
+    m_sigmaV2(sigmaV * sigmaV),
+    m_sigmaW2(sigmaW * sigmaW),
+    m_sigmaFit2(0.),
+    m_yU(0.),
+    m_yV(0.),
+    m_yW(0.),
+    m_zU(0.),
+    m_zV(0.),
+    m_zW(0.)
+{
+    this->CalculateCoefficients();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline LArMinChiSquaredYZSolver::LArMinChiSquaredYZSolver(const LArRotationalTransformation &transformation, const double sigmaU,
+        const double sigmaV, const double sigmaW, const double sigmaFit) :
+    m_transformation(transformation),
+    m_hasFit(true),
+    m_sigmaU2(sigmaU * sigmaU),
+    m_sigmaV2(sigmaV * sigmaV),
+    m_sigmaW2(sigmaW * sigmaW),
+    m_sigmaFit2(sigmaFit * sigmaFit),
+    m_yU(0.),
+    m_yV(0.),
+    m_yW(0.),
+    m_zU(0.),
+    m_zV(0.),
+    m_zW(0.)
+{
+    this->CalculateCoefficients();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void LArMinChiSquaredYZSolver::Solve(const double u, const double v, const double w, double &y, double &z, double &chiSquared) const
+{
+    if (m_hasFit)
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_ALLOWED);
+
+    this->GetPosition(u / m_sigmaU2, v / m_sigmaV2, w / m_sigmaW2, y, z);
+
+    const double deltaU(u - m_transformation.YZtoU(y, z));
+    const double deltaV(v - m_transformation.YZtoV(y, z));
+    const double deltaW(w - m_transformation.YZtoW(y, z));
+    chiSquared = ((deltaU * deltaU) / m_sigmaU2) + ((deltaV * deltaV) / m_sigmaV2) + ((deltaW * deltaW) / m_sigmaW2);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void LArMinChiSquaredYZSolver::Solve(const double u, const double v, const double w, const double uFit, const double vFit, const double wFit,
+    double &y, double &z, double &chiSquared) const
+{
+    if (!m_hasFit)
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_NOT_ALLOWED);
+
+    this->GetPosition(u / m_sigmaU2 + uFit / m_sigmaFit2, v / m_sigmaV2 + vFit / m_sigmaFit2, w / m_sigmaW2 + wFit / m_sigmaFit2, y, z);
+
+    const double outputU(m_transformation.YZtoU(y, z));
+    const double outputV(m_transformation.YZtoV(y, z));
+    const double outputW(m_transformation.YZtoW(y, z));
+
+    const double deltaU(u - outputU), deltaV(v - outputV), deltaW(w - outputW);
+    const double deltaUFit(uFit - outputU), deltaVFit(vFit - outputV), deltaWFit(wFit - outputW);
+
+    chiSquared = ((deltaU * deltaU) / m_sigmaU2) + ((deltaV * deltaV) / m_sigmaV2) + ((deltaW * deltaW) / m_sigmaW2) +
+        ((deltaUFit * deltaUFit) / m_sigmaFit2) + ((deltaVFit * deltaVFit) / m_sigmaFit2) + ((deltaWFit * deltaWFit) / m_sigmaFit2);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void LArMinChiSquaredYZSolver::Solve(const std::size_t n, const T *const pU, const T *const pV, const T *const pW, T *const pY, T *const pZ,
+    T *const pChiSquared) const
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        double y(0.), z(0.), chiSquared(0.);
+        this->Solve(static_cast<double>(pU[i]), static_cast<double>(pV[i]), static_cast<double>(pW[i]), y, z, chiSquared);
+        pY[i] = static_cast<T>(y);
+        pZ[i] = static_cast<T>(z);
+        pChiSquared[i] = static_cast<T>(chiSquared);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+inline void LArMinChiSquaredYZSolver::Solve(const std::size_t n, const T *const pU, const T *const pV, const T *const pW, const T *const pUFit,
+    const T *const pVFit, const T *const pWFit, T *const pY, T *const pZ, T *const pChiSquared) const
+{
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        double y(0.), z(0.), chiSquared(0.);
+        this->Solve(static_cast<double>(pU[i]), static_cast<double>(pV[i]), static_cast<double>(pW[i]), static_cast<double>(pUFit[i]),
+            static_cast<double>(pVFit[i]), static_cast<double>(pWFit[i]), y, z, chiSquared);
+        pY[i] = static_cast<T>(y);
+        pZ[i] = static_cast<T>(z);
+        pChiSquared[i] = static_cast<T>(chiSquared);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void LArMinChiSquaredYZSolver::CalculateCoefficients()
+{
+    // Each view contributes a row (-sin(theta), cos(theta)) to the design matrix, weighted by the measured and any fitted coordinate uncertainties
+    const double weightU(1. / m_sigmaU2 + (m_hasFit ? 1. / m_sigmaFit2 : 0.));
+    const double weightV(1. / m_sigmaV2 + (m_hasFit ? 1. / m_sigmaFit2 : 0.));
+    const double weightW(1. / m_sigmaW2 + (m_hasFit ? 1. / m_sigmaFit2 : 0.));
+
+    const double sinU(m_transformation.GetSinU()), sinV(m_transformation.GetSinV()), sinW(m_transformation.GetSinW());
+    const double cosU(m_transformation.GetCosU()), cosV(m_transformation.GetCosV()), cosW(m_transformation.GetCosW());
+
+    const double nYY(weightU * sinU * sinU + weightV * sinV * sinV + weightW * sinW * sinW);
+    const double nYZ(-(weightU * sinU * cosU + weightV * sinV * cosV + weightW * sinW * cosW));
+    const double nZZ(weightU * cosU * cosU + weightV * cosV * cosV + weightW * cosW * cosW);
+    const double determinant(nYY * nZZ - nYZ * nYZ);
+
+    if (std::fabs(determinant) < std::numeric_limits<double>::epsilon())
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+
+    m_yU = (-nZZ * sinU - nYZ * cosU) / determinant;
+    m_yV = (-nZZ * sinV - nYZ * cosV) / determinant;
+    m_yW = (-nZZ * sinW - nYZ * cosW) / determinant;
+    m_zU = (nYZ * sinU + nYY * cosU) / determinant;
+    m_zV = (nYZ * sinV + nYY * cosV) / determinant;
+    m_zW = (nYZ * sinW + nYY * cosW) / determinant;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline void LArMinChiSquaredYZSolver::GetPosition(const double sumU, const double sumV, const double sumW, double &y, double &z) const
+{
+    y = m_yU * sumU + m_yV * sumV + m_yW * sumW;
+    z = m_zU * sumU + m_zV * sumV + m_zW * sumW;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const LArRotationalTransformation &LArRotationalTransformationPlugin::GetTransformation() const
+{
+    return m_transformation;
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_ROTATIONAL_TRANSFORMATION_PLUGIN_H
@@ -29,6 +29,19 @@ CosmicRayTrackMatchingAlgorithm::CosmicRayTrackMatchingAlgorithm() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode CosmicRayTrackMatchingAlgorithm::Run()
+{
+    // ATTN No clusters are modified by this algorithm, so cluster hit index entries remain valid throughout each call. The index is also
+    // cleared beforehand, in case a previous call was interrupted by an exception.
+    m_clusterHitIndex.Clear();
+    const StatusCode statusCode(CosmicRayBaseMatchingAlgorithm::Run());
+    m_clusterHitIndex.Clear();
+
+    return statusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void CosmicRayTrackMatchingAlgorithm::SelectCleanClusters(const ClusterVector &inputVector, ClusterVector &outputVector) const
 {
     ClusterVector clusterVector;
@@ -57,8 +70,8 @@ void CosmicRayTrackMatchingAlgorithm::SelectCleanClusters(const ClusterVector &i
                 continue;
 
             if ((LArClusterHelper::GetLengthSquared(pClusterCheck) > 10.f * lengthSquared) &&
-                (LArClusterHelper::GetClosestDistance(innerVertex, pClusterCheck) < m_vtxXOverlap ||
-                 LArClusterHelper::GetClosestDistance(outerVertex, pClusterCheck) < m_vtxXOverlap))
+                (LArClusterHelper::GetClosestDistance(innerVertex, pClusterCheck, m_clusterHitIndex) < m_vtxXOverlap ||
+                 LArClusterHelper::GetClosestDistance(outerVertex, pClusterCheck, m_clusterHitIndex) < m_vtxXOverlap))
             {
                 isDeltaRay = true;
                 break;
@@ -160,13 +173,13 @@ bool CosmicRayTrackMatchingAlgorithm::CheckMatchedClusters3D(const Cluster *cons
             LArGeometryHelper::MergeTwoPositions(this->GetPandora(), hitType3, hitType1, vtx3, vtx1, projVtx2, chi2);
             LArGeometryHelper::MergeTwoPositions(this->GetPandora(), hitType3, hitType1, end3, end1, projEnd2, chi2);
 
-            const bool matchedVtx1(LArClusterHelper::GetClosestDistance(projVtx1, pCluster1) < m_maxDisplacement);
-            const bool matchedVtx2(LArClusterHelper::GetClosestDistance(projVtx2, pCluster2) < m_maxDisplacement);
-            const bool matchedVtx3(LArClusterHelper::GetClosestDistance(projVtx3, pCluster3) < m_maxDisplacement);
+            const bool matchedVtx1(LArClusterHelper::GetClosestDistance(projVtx1, pCluster1, m_clusterHitIndex) < m_maxDisplacement);
+            const bool matchedVtx2(LArClusterHelper::GetClosestDistance(projVtx2, pCluster2, m_clusterHitIndex) < m_maxDisplacement);
+            const bool matchedVtx3(LArClusterHelper::GetClosestDistance(projVtx3, pCluster3, m_clusterHitIndex) < m_maxDisplacement);
 
-            const bool matchedEnd1(LArClusterHelper::GetClosestDistance(projEnd1, pCluster1) < m_maxDisplacement);
-            const bool matchedEnd2(LArClusterHelper::GetClosestDistance(projEnd2, pCluster2) < m_maxDisplacement);
-            const bool matchedEnd3(LArClusterHelper::GetClosestDistance(projEnd3, pCluster3) < m_maxDisplacement);
+            const bool matchedEnd1(LArClusterHelper::GetClosestDistance(projEnd1, pCluster1, m_clusterHitIndex) < m_maxDisplacement);
+            const bool matchedEnd2(LArClusterHelper::GetClosestDistance(projEnd2, pCluster2, m_clusterHitIndex) < m_maxDisplacement);
+            const bool matchedEnd3(LArClusterHelper::GetClosestDistance(projEnd3, pCluster3, m_clusterHitIndex) < m_maxDisplacement);
 
             const bool matchedCluster1(matchedVtx1 || matchedEnd1);
             const bool matchedCluster2(matchedVtx2 || matchedEnd2);
@@ -8,6 +8,8 @@
 #ifndef LAR_COSMIC_RAY_TRACK_MATCHING_ALGORITHM_H
 #define LAR_COSMIC_RAY_TRACK_MATCHING_ALGORITHM_H 1
 
+#include "larpandoracontent/LArObjects/LArClusterHitIndex.h"
+
 #include "larpandoracontent/LArThreeDReco/LArCosmicRay/CosmicRayBaseMatchingAlgorithm.h"
 
 namespace lar_content
@@ -25,6 +27,7 @@ public:
     CosmicRayTrackMatchingAlgorithm();
 
 private:
+    pandora::StatusCode Run();
 
     void SelectCleanClusters(const pandora::ClusterVector &inputVector, pandora::ClusterVector &outputVector) const;
     bool MatchClusters(const pandora::Cluster *const pCluster1, const pandora::Cluster *const pCluster2) const;
@@ -39,6 +42,8 @@ private:
     float          m_minXOverlap;                  ///< requirement on minimum X overlap for associated clusters
     float          m_minXOverlapFraction;          ///< requirement on minimum X overlap fraction for associated clusters
     float          m_maxDisplacement;              ///< requirement on 3D consistency checks
+
+    mutable LArClusterHitIndex m_clusterHitIndex;  ///< The cluster hit index for closest approach queries, cleared after each call
 };
 
 } // namespace lar_content
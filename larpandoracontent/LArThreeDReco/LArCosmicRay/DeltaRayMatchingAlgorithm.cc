@@ -47,12 +47,17 @@ StatusCode DeltaRayMatchingAlgorithm::Run()
 
     this->InitializeNearbyClusterMaps();
 
+    // ATTN Cluster hit index entries are invalidated when clusters are merged, and the index is also cleared beforehand, in case a previous
+    // call was interrupted by an exception
+    m_clusterHitIndex.Clear();
+
     ClusterLengthMap clusterLengthMap;
     this->ThreeViewMatching(clusterLengthMap);
     this->TwoViewMatching(clusterLengthMap);
     this->OneViewMatching(clusterLengthMap);
 
     this->ClearNearbyClusterMaps();
+    m_clusterHitIndex.Clear();
 
     return STATUS_CODE_SUCCESS;
 }
@@ -91,11 +96,12 @@ void DeltaRayMatchingAlgorithm::InitializeNearbyClusterMap(const std::string &cl
             (void) hitToClusterMap.insert(HitToClusterMap::value_type(pCaloHit, pCluster));
     }
 
-    HitKDTree2D kdTree;
     HitKDNode2DList hitKDNode2DList;
 
     KDTreeBox hitsBoundingRegion2D(fill_and_bound_2d_kd_tree(allCaloHits, hitKDNode2DList));
-    kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
+    m_kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
+
+    HitKDNode2DList found;
 
     for (const Cluster *const pCluster : *pClusterList)
     {
@@ -106,8 +112,8 @@ void DeltaRayMatchingAlgorithm::InitializeNearbyClusterMap(const std::string &cl
         {
             KDTreeBox searchRegionHits = build_2d_kd_search_region(pCaloHit, m_searchRegion1D, m_searchRegion1D);
 
-            HitKDNode2DList found;
-            kdTree.search(searchRegionHits, found);
+            found.clear();
+            m_kdTree.search(searchRegionHits, found);
 
             for (const auto &hit : found)
             {
@@ -119,6 +125,8 @@ void DeltaRayMatchingAlgorithm::InitializeNearbyClusterMap(const std::string &cl
             }
         }
     }
+
+    m_kdTree.clear();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -663,7 +671,7 @@ float DeltaRayMatchingAlgorithm::GetDistanceSquaredToPfo(const Cluster *const pC
     if (comparisonList.empty())
         return std::numeric_limits<float>::max();
 
-    return LArClusterHelper::GetClosestDistance(pCluster, comparisonList);
+    return LArClusterHelper::GetClosestDistance(pCluster, comparisonList, m_clusterHitIndex);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -712,6 +720,9 @@ void DeltaRayMatchingAlgorithm::AddToDaughterPfo(const ClusterList &clusterList,
 
         PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*this, pParentCluster, pDaughterCluster,
             clusterListName, clusterListName));
+
+        m_clusterHitIndex.Invalidate(pParentCluster);
+        m_clusterHitIndex.Invalidate(pDaughterCluster);
     }
 }
 
@@ -10,14 +10,14 @@
 
 #include "Pandora/Algorithm.h"
 
+#include "larpandoracontent/LArObjects/LArClusterHitIndex.h"
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+
 namespace lar_content
 {
 
-template<typename, unsigned int> class KDTreeLinkerAlgo;
-template<typename, unsigned int> class KDTreeNodeInfoT;
-
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 /**
@@ -307,9 +307,11 @@ private:
     float                   m_pseudoChi2Cut;              ///< Pseudo chi2 cut for three view matching
 
     float                   m_searchRegion1D;             ///< Search region, applied to each dimension, for look-up from kd-trees
+    HitKDTree2D             m_kdTree;                     ///< The kd tree for hit look-up, retaining its node pool between calls
     ClusterToClustersMap    m_nearbyClustersU;            ///< The nearby clusters map for the u view
     ClusterToClustersMap    m_nearbyClustersV;            ///< The nearby clusters map for the v view
     ClusterToClustersMap    m_nearbyClustersW;            ///< The nearby clusters map for the w view
+    mutable LArClusterHitIndex m_clusterHitIndex;         ///< The cluster hit index for pfo cluster closest approach queries
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
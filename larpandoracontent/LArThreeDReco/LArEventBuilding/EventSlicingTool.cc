@@ -509,10 +509,9 @@ void EventSlicingTool::AssignRemainingHitsToSlices(const ClusterList &remainingC
         KDTreeBox boundingRegionV = fill_and_bound_2d_kd_tree(pointsV, kDNode2DListV);
         KDTreeBox boundingRegionW = fill_and_bound_2d_kd_tree(pointsW, kDNode2DListW);
 
-        PointKDTree2D kdTreeU, kdTreeV, kdTreeW;
-        kdTreeU.build(kDNode2DListU, boundingRegionU);
-        kdTreeV.build(kDNode2DListV, boundingRegionV);
-        kdTreeW.build(kDNode2DListW, boundingRegionW);
+        m_kdTreeU.build(kDNode2DListU, boundingRegionU);
+        m_kdTreeV.build(kDNode2DListV, boundingRegionV);
+        m_kdTreeW.build(kDNode2DListW, boundingRegionW);
 
         ClusterVector sortedRemainingClusters(remainingClusters.begin(), remainingClusters.end());
         std::sort(sortedRemainingClusters.begin(), sortedRemainingClusters.end(), LArClusterHelper::SortByNHits);
@@ -524,7 +523,7 @@ void EventSlicingTool::AssignRemainingHitsToSlices(const ClusterList &remainingC
             if ((TPC_VIEW_U != hitType) && (TPC_VIEW_V != hitType) && (TPC_VIEW_W != hitType))
                 throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
 
-            PointKDTree2D &kdTree((TPC_VIEW_U == hitType) ? kdTreeU : (TPC_VIEW_V == hitType) ? kdTreeV : kdTreeW);
+            PointKDTree2D &kdTree((TPC_VIEW_U == hitType) ? m_kdTreeU : (TPC_VIEW_V == hitType) ? m_kdTreeV : m_kdTreeW);
             const PointKDNode2D *pBestResultPoint(this->MatchClusterToSlice(pCluster2D, kdTree));
 
             if (!pBestResultPoint)
@@ -544,6 +543,10 @@ void EventSlicingTool::AssignRemainingHitsToSlices(const ClusterList &remainingC
         throw;
     }
 
+    m_kdTreeU.clear();
+    m_kdTreeV.clear();
+    m_kdTreeW.clear();
+
     for (const auto &pointMap : pointToSliceIndexMap) delete pointMap.first;
 }
 
@@ -633,18 +636,17 @@ const EventSlicingTool::PointKDNode2D *EventSlicingTool::MatchClusterToSlice(con
         clusterPointList.push_back(new CartesianVector((pCluster2D->GetCentroid(pCluster2D->GetInnerPseudoLayer()) + pCluster2D->GetCentroid(pCluster2D->GetOuterPseudoLayer())) * 0.5f));
 
         float bestDistance(std::numeric_limits<float>::max());
+        PointKDTree2D::DistanceNodeInfoVector nearestPoints;
 
         for (const CartesianVector *const pClusterPoint : clusterPointList)
         {
-            const PointKDNode2D *pResultPoint(nullptr);
-            float resultDistance(std::numeric_limits<float>::max());
             const PointKDNode2D targetPoint(pClusterPoint, pClusterPoint->GetX(), pClusterPoint->GetZ());
-            kdTree.findNearestNeighbour(targetPoint, pResultPoint, resultDistance);
+            kdTree.findKNearestNeighbours(targetPoint, 1, nearestPoints);
 
-            if (pResultPoint && (resultDistance < bestDistance))
+            if (!nearestPoints.empty() && (nearestPoints.front().first < bestDistance))
             {
-                pBestResultPoint = pResultPoint;
-                bestDistance = resultDistance;
+                pBestResultPoint = nearestPoints.front().second;
+                bestDistance = nearestPoints.front().first;
             }
         }
     }
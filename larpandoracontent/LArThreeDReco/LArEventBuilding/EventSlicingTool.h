@@ -12,14 +12,13 @@
 
 #include "larpandoracontent/LArObjects/LArThreeDSlidingConeFitResult.h"
 
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+
 #include <unordered_map>
 
 namespace lar_content
 {
 
-template<typename, unsigned int> class KDTreeLinkerAlgo;
-template<typename, unsigned int> class KDTreeNodeInfoT;
-
 class SimpleCone;
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -295,6 +294,10 @@ private:
     float           m_coneBoundedFraction2;             ///< The minimum cluster bounded fraction for association 2
 
     bool            m_use3DProjectionsInHitPickUp;      ///< Whether to include 3D cluster projections when assigning remaining clusters to slices
+
+    mutable PointKDTree2D   m_kdTreeU;                  ///< The u view kd tree for hit pick up, retaining its node pool between calls
+    mutable PointKDTree2D   m_kdTreeV;                  ///< The v view kd tree for hit pick up, retaining its node pool between calls
+    mutable PointKDTree2D   m_kdTreeW;                  ///< The w view kd tree for hit pick up, retaining its node pool between calls
 };
 
 } // namespace lar_content
@@ -10,6 +10,8 @@
 
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 
+#include "larpandoracontent/LArPlugins/LArRotationalTransformationPlugin.h"
+
 #include "larpandoracontent/LArThreeDReco/LArHitCreation/HitCreationBaseTool.h"
 
 using namespace pandora;
@@ -19,7 +21,8 @@ namespace lar_content
 
 HitCreationBaseTool::HitCreationBaseTool() :
     m_sigmaX2(1.),
-    m_chiSquaredCut(1.)
+    m_chiSquaredCut(1.),
+    m_pTransformation(nullptr)
 {
 }
 
@@ -31,6 +34,13 @@ HitCreationBaseTool::~HitCreationBaseTool()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool HitCreationBaseTool::IsThreadSafe() const
+{
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void HitCreationBaseTool::GetBestPosition3D(const HitType hitType1, const HitType hitType2, const CartesianPointVector &fitPositionList1,
     const CartesianPointVector &fitPositionList2, ProtoHit &protoHit) const
 {
@@ -94,7 +104,15 @@ void HitCreationBaseTool::GetBestPosition3D(const HitType hitType1, const HitTyp
     const double sigmaW((TPC_VIEW_W == hitType) ? sigmaHit : sigmaFit);
 
     double bestY(std::numeric_limits<double>::max()), bestZ(std::numeric_limits<double>::max());
-    this->GetPandora().GetPlugins()->GetLArTransformationPlugin()->GetMinChiSquaredYZ(u, v, w, sigmaU, sigmaV, sigmaW, bestY, bestZ, chi2);
+    if (m_pSolver)
+    {
+        m_pSolver->Solve(u, v, w, bestY, bestZ, chi2);
+    }
+    else
+    {
+        this->GetPandora().GetPlugins()->GetLArTransformationPlugin()->GetMinChiSquaredYZ(u, v, w, sigmaU, sigmaV, sigmaW, bestY, bestZ, chi2);
+    }
+
     position3D.SetValues(pCaloHit2D->GetPositionVector().GetX(), static_cast<float>(bestY), static_cast<float>(bestZ));
 
     const double deltaX1(pCaloHit2D->GetPositionVector().GetX() - fitPosition1.GetX());
@@ -132,6 +150,22 @@ void HitCreationBaseTool::GetBestPosition3D(const HitType hitType, const Cartesi
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode HitCreationBaseTool::Initialize()
+{
+    m_pTransformation = LArGeometryHelper::GetRotationalTransformation(this->GetPandora());
+
+    if (!m_pTransformation)
+        return STATUS_CODE_SUCCESS;
+
+    // ATTN Uncertainties must agree with those used for three view positions in GetBestPosition3D, where sigmaHit and sigmaFit are equal
+    const double sigmaUVW(LArGeometryHelper::GetSigmaUVW(this->GetPandora()));
+    m_pSolver.reset(new LArMinChiSquaredYZSolver(*m_pTransformation, sigmaUVW, sigmaUVW, sigmaUVW));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode HitCreationBaseTool::ReadSettings(const pandora::TiXmlHandle xmlHandle)
 {
     double sigmaX(std::sqrt(m_sigmaX2));
@@ -12,9 +12,16 @@
 
 #include "larpandoracontent/LArThreeDReco/LArHitCreation/ThreeDHitCreationAlgorithm.h"
 
+#include <memory>
+
 namespace lar_content
 {
 
+class LArMinChiSquaredYZSolver;
+class LArRotationalTransformation;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 /**
  *  @brief  HitCreationBaseTool class
  */
@@ -46,6 +53,14 @@ public:
     virtual void Run(ThreeDHitCreationAlgorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pPfo,
         const pandora::CaloHitVector &inputTwoDHits, ProtoHitVector &protoHitVector) = 0;
 
+    /**
+     *  @brief  Whether the tool may be run for different pfos concurrently. This requires that running the tool changes no tool or algorithm
+     *          state and reads no 3D hits other than those of parent pfos.
+     *
+     *  @return boolean
+     */
+    virtual bool IsThreadSafe() const;
+
 protected:
     /**
      *  @brief  Get the three dimensional position using a provided two dimensional calo hit and candidate fit positions from the other two views
@@ -80,10 +95,16 @@ protected:
      */
     virtual void GetBestPosition3D(const pandora::HitType hitType, const pandora::CartesianVector &fitPosition, ProtoHit &protoHit) const;
 
+    virtual pandora::StatusCode Initialize();
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     double      m_sigmaX2;              ///< The sigmaX squared value, for calculation of chi2 deltaX term
     double      m_chiSquaredCut;        ///< The chi squared cut (accept only values below the cut value)
+
+    const LArRotationalTransformation *m_pTransformation;  ///< The rotational transformation, or nullptr for other transformation plugins
+
+private:
+    std::unique_ptr<LArMinChiSquaredYZSolver> m_pSolver;    ///< The min chi squared yz solver for three view positions, or nullptr if unavailable
 };
 
 } // namespace lar_content
@@ -27,6 +27,8 @@ public:
     virtual void Run(ThreeDHitCreationAlgorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pPfo,
         const pandora::CaloHitVector &inputTwoDHits, ProtoHitVector &protoHitVector);
 
+    virtual bool IsThreadSafe() const;
+
 protected:
     /**
      *  @brief  Get the three dimensional position for to a two dimensional calo hit, using the hit and a list of candidate matched
@@ -10,10 +10,13 @@
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
+#include "larpandoracontent/LArHelpers/LArMultiThreadingHelper.h"
 #include "larpandoracontent/LArHelpers/LArPfoHelper.h"
 
 #include "larpandoracontent/LArObjects/LArThreeDSlidingFitResult.h"
 
+#include "larpandoracontent/LArPlugins/LArRotationalTransformationPlugin.h"
+
 #include "larpandoracontent/LArThreeDReco/LArHitCreation/HitCreationBaseTool.h"
 #include "larpandoracontent/LArThreeDReco/LArHitCreation/ThreeDHitCreationAlgorithm.h"
 
@@ -30,7 +33,16 @@ ThreeDHitCreationAlgorithm::ThreeDHitCreationAlgorithm() :
     m_slidingFitHalfWindow(10),
     m_nHitRefinementIterations(10),
     m_sigma3DFitMultiplier(0.2),
-    m_iterationMaxChi2Ratio(1.)
+    m_iterationMaxChi2Ratio(1.),
+    m_nPfoThreads(1),
+    m_checkPfoThreads(false),
+    m_pTransformation(nullptr)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+ThreeDHitCreationAlgorithm::~ThreeDHitCreationAlgorithm()
 {
 }
 
@@ -47,6 +59,22 @@ void ThreeDHitCreationAlgorithm::FilterCaloHitsByType(const CaloHitVector &input
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode ThreeDHitCreationAlgorithm::Initialize()
+{
+    m_pTransformation = LArGeometryHelper::GetRotationalTransformation(this->GetPandora());
+
+    if (!m_pTransformation)
+        return STATUS_CODE_SUCCESS;
+
+    // ATTN Uncertainties must agree with those used in RefineHitPositions
+    const double sigmaUVW(LArGeometryHelper::GetSigmaUVW(this->GetPandora()));
+    m_pRefinementSolver.reset(new LArMinChiSquaredYZSolver(*m_pTransformation, sigmaUVW, sigmaUVW, sigmaUVW, sigmaUVW * m_sigma3DFitMultiplier));
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ThreeDHitCreationAlgorithm::Run()
 {
     const PfoList *pPfoList(nullptr);
@@ -65,23 +93,69 @@ StatusCode ThreeDHitCreationAlgorithm::Run()
     PfoVector pfoVector(pPfoList->begin(), pPfoList->end());
     std::sort(pfoVector.begin(), pfoVector.end(), LArPfoHelper::SortByNHits);
 
+    const unsigned int nPfos(pfoVector.size());
+
+    // ATTN Tool output to std::cout, when displaying algorithm info, would interleave across threads
+    const bool displayInfo(PandoraContentApi::GetSettings(*this)->ShouldDisplayAlgorithmInfo());
+    const unsigned int nThreads(displayInfo ? 1 : LArMultiThreadingHelper::GetNThreads(m_nPfoThreads, nPfos));
+
+    // ATTN Tools may use the 3D hits of parent pfos, so proto hits for pfos with a preceding parent are only calculated once the parent is complete
+    PfoSet precedingPfos;
+    std::vector<bool> isPrecalculated;
+
     for (const ParticleFlowObject *const pPfo : pfoVector)
     {
-        ProtoHitVector protoHitVector;
+        bool hasPrecedingParent(false);
 
-        for (HitCreationBaseTool *const pHitCreationTool : m_algorithmToolVector)
+        for (const ParticleFlowObject *const pParentPfo : pPfo->GetParentPfoList())
         {
-            CaloHitVector remainingTwoDHits;
-            this->SeparateTwoDHits(pPfo, protoHitVector, remainingTwoDHits);
+            if (precedingPfos.count(pParentPfo))
+                hasPrecedingParent = true;
+        }
 
-            if (remainingTwoDHits.empty())
-                break;
+        isPrecalculated.push_back((nThreads > 1) && !hasPrecedingParent);
+        precedingPfos.insert(pPfo);
+    }
+
+    std::vector<ProtoHitVector> protoHitVectors(nPfos);
+    std::vector<StatusCode> statusCodes(nPfos, STATUS_CODE_SUCCESS);
+
+    auto calculateProtoHits = [&](const unsigned int pfoIndex) -> StatusCode
+    {
+        if (!isPrecalculated.at(pfoIndex))
+            return STATUS_CODE_SUCCESS;
+
+        try
+        {
+            this->CalculateProtoHits(pfoVector.at(pfoIndex), protoHitVectors.at(pfoIndex));
+        }
+        catch (const StatusCodeException &statusCodeException)
+        {
+            statusCodes.at(pfoIndex) = statusCodeException.GetStatusCode();
+        }
+
+        return STATUS_CODE_SUCCESS;
+    };
+
+    PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArMultiThreadingHelper::RunTasks(nPfos, nThreads, calculateProtoHits));
+
+    // Create the 3D hits serially, in the same order and with the same failure behaviour as the serial calculation
+    for (unsigned int pfoIndex = 0; pfoIndex < nPfos; ++pfoIndex)
+    {
+        const ParticleFlowObject *const pPfo(pfoVector.at(pfoIndex));
+        ProtoHitVector &protoHitVector(protoHitVectors.at(pfoIndex));
 
-            pHitCreationTool->Run(this, pPfo, remainingTwoDHits, protoHitVector);
+        if (!isPrecalculated.at(pfoIndex))
+        {
+            this->CalculateProtoHits(pPfo, protoHitVector);
+        }
+        else if (m_checkPfoThreads)
+        {
+            this->CheckProtoHits(pPfo, protoHitVector, statusCodes.at(pfoIndex));
         }
 
-        if ((m_iterateTrackHits && LArPfoHelper::IsTrack(pPfo)) || (m_iterateShowerHits && LArPfoHelper::IsShower(pPfo)))
-            this->IterativeTreatment(protoHitVector);
+        if (STATUS_CODE_SUCCESS != statusCodes.at(pfoIndex))
+            throw StatusCodeException(statusCodes.at(pfoIndex));
 
         if (protoHitVector.empty())
             continue;
@@ -101,6 +175,58 @@ StatusCode ThreeDHitCreationAlgorithm::Run()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ThreeDHitCreationAlgorithm::CalculateProtoHits(const ParticleFlowObject *const pPfo, ProtoHitVector &protoHitVector)
+{
+    for (HitCreationBaseTool *const pHitCreationTool : m_algorithmToolVector)
+    {
+        CaloHitVector remainingTwoDHits;
+        this->SeparateTwoDHits(pPfo, protoHitVector, remainingTwoDHits);
+
+        if (remainingTwoDHits.empty())
+            break;
+
+        pHitCreationTool->Run(this, pPfo, remainingTwoDHits, protoHitVector);
+    }
+
+    if ((m_iterateTrackHits && LArPfoHelper::IsTrack(pPfo)) || (m_iterateShowerHits && LArPfoHelper::IsShower(pPfo)))
+        this->IterativeTreatment(protoHitVector);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ThreeDHitCreationAlgorithm::CheckProtoHits(const ParticleFlowObject *const pPfo, const ProtoHitVector &protoHitVector, const StatusCode statusCode)
+{
+    ProtoHitVector serialProtoHitVector;
+    StatusCode serialStatusCode(STATUS_CODE_SUCCESS);
+
+    try
+    {
+        this->CalculateProtoHits(pPfo, serialProtoHitVector);
+    }
+    catch (const StatusCodeException &statusCodeException)
+    {
+        serialStatusCode = statusCodeException.GetStatusCode();
+    }
+
+    bool isIdentical(serialStatusCode == statusCode);
+
+    if (isIdentical && (STATUS_CODE_SUCCESS == statusCode))
+    {
+        isIdentical = (serialProtoHitVector.size() == protoHitVector.size());
+
+        for (unsigned int index = 0; isIdentical && (index < protoHitVector.size()); ++index)
+            isIdentical = protoHitVector.at(index).IsIdentical(serialProtoHitVector.at(index));
+    }
+
+    if (!isIdentical)
+    {
+        std::cout << "ThreeDHitCreationAlgorithm: proto hits calculated concurrently differ from the serial calculation" << std::endl;
+        throw StatusCodeException(STATUS_CODE_FAILURE);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ThreeDHitCreationAlgorithm::SeparateTwoDHits(const ParticleFlowObject *const pPfo, const ProtoHitVector &protoHitVector, CaloHitVector &remainingHitVector) const
 {
     ClusterList twoDClusterList;
@@ -249,6 +375,9 @@ void ThreeDHitCreationAlgorithm::RefineHitPositions(const ThreeDSlidingFitResult
     const double sigmaHit(sigmaUVW);
     const double sigma3DFit(sigmaUVW * m_sigma3DFitMultiplier);
 
+    std::vector<ProtoHit*> refinedProtoHits;
+    std::vector<double> uValues, vValues, wValues, uFitValues, vFitValues, wFitValues;
+
     for (ProtoHit &protoHit : protoHitVector)
     {
         CartesianVector pointOnFit(0.f, 0.f, 0.f);
@@ -264,12 +393,6 @@ void ThreeDHitCreationAlgorithm::RefineHitPositions(const ThreeDSlidingFitResult
         const double vFit(PandoraContentApi::GetPlugins(*this)->GetLArTransformationPlugin()->YZtoV(pointOnFit.GetY(), pointOnFit.GetZ()));
         const double wFit(PandoraContentApi::GetPlugins(*this)->GetLArTransformationPlugin()->YZtoW(pointOnFit.GetY(), pointOnFit.GetZ()));
 
-        const double sigmaU((TPC_VIEW_U == hitType) ? sigmaHit : sigmaFit);
-        const double sigmaV((TPC_VIEW_V == hitType) ? sigmaHit : sigmaFit);
-        const double sigmaW((TPC_VIEW_W == hitType) ? sigmaHit : sigmaFit);
-
-        CartesianVector position3D(0.f, 0.f, 0.f);
-        double chi2(std::numeric_limits<double>::max());
         double u(std::numeric_limits<double>::max()), v(std::numeric_limits<double>::max()), w(std::numeric_limits<double>::max());
 
         if (protoHit.GetNTrajectorySamples() == 2)
@@ -290,11 +413,47 @@ void ThreeDHitCreationAlgorithm::RefineHitPositions(const ThreeDSlidingFitResult
             throw StatusCodeException(STATUS_CODE_FAILURE);
         }
 
-        double bestY(std::numeric_limits<double>::max()), bestZ(std::numeric_limits<double>::max());
-        PandoraContentApi::GetPlugins(*this)->GetLArTransformationPlugin()->GetMinChiSquaredYZ(u, v, w, sigmaU, sigmaV, sigmaW, uFit, vFit, wFit, sigma3DFit, bestY, bestZ, chi2);
-        position3D.SetValues(pCaloHit2D->GetPositionVector().GetX(), static_cast<float>(bestY), static_cast<float>(bestZ));
+        refinedProtoHits.push_back(&protoHit);
+        uValues.push_back(u);
+        vValues.push_back(v);
+        wValues.push_back(w);
+        uFitValues.push_back(uFit);
+        vFitValues.push_back(vFit);
+        wFitValues.push_back(wFit);
+    }
+
+    const std::size_t nRefinedProtoHits(refinedProtoHits.size());
+    std::vector<double> bestYValues(nRefinedProtoHits, std::numeric_limits<double>::max());
+    std::vector<double> bestZValues(nRefinedProtoHits, std::numeric_limits<double>::max());
+    std::vector<double> chi2Values(nRefinedProtoHits, std::numeric_limits<double>::max());
+
+    // ATTN The uncertainties are common to all proto hits, so a single closed-form solver can be used for rotational transformations
+    if (m_pRefinementSolver)
+    {
+        m_pRefinementSolver->Solve(nRefinedProtoHits, uValues.data(), vValues.data(), wValues.data(), uFitValues.data(), vFitValues.data(),
+            wFitValues.data(), bestYValues.data(), bestZValues.data(), chi2Values.data());
+    }
+    else
+    {
+        for (std::size_t index = 0; index < nRefinedProtoHits; ++index)
+        {
+            const HitType hitType(refinedProtoHits.at(index)->GetParentCaloHit2D()->GetHitType());
+            const double sigmaU((TPC_VIEW_U == hitType) ? sigmaHit : sigmaFit);
+            const double sigmaV((TPC_VIEW_V == hitType) ? sigmaHit : sigmaFit);
+            const double sigmaW((TPC_VIEW_W == hitType) ? sigmaHit : sigmaFit);
+
+            PandoraContentApi::GetPlugins(*this)->GetLArTransformationPlugin()->GetMinChiSquaredYZ(uValues.at(index), vValues.at(index), wValues.at(index),
+                sigmaU, sigmaV, sigmaW, uFitValues.at(index), vFitValues.at(index), wFitValues.at(index), sigma3DFit, bestYValues.at(index),
+                bestZValues.at(index), chi2Values.at(index));
+        }
+    }
 
-        protoHit.SetPosition3D(position3D, chi2);
+    for (std::size_t index = 0; index < nRefinedProtoHits; ++index)
+    {
+        ProtoHit &protoHit(*refinedProtoHits.at(index));
+        const CartesianVector position3D(protoHit.GetParentCaloHit2D()->GetPositionVector().GetX(), static_cast<float>(bestYValues.at(index)),
+            static_cast<float>(bestZValues.at(index)));
+        protoHit.SetPosition3D(position3D, chi2Values.at(index));
     }
 }
 
@@ -437,6 +596,37 @@ const ThreeDHitCreationAlgorithm::TrajectorySample &ThreeDHitCreationAlgorithm::
     return m_trajectorySampleVector.back();
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ThreeDHitCreationAlgorithm::ProtoHit::IsIdentical(const ProtoHit &rhs) const
+{
+    if ((m_pParentCaloHit2D != rhs.m_pParentCaloHit2D) || (m_isPositionSet != rhs.m_isPositionSet) ||
+        (m_trajectorySampleVector.size() != rhs.m_trajectorySampleVector.size()))
+    {
+        return false;
+    }
+
+    if (m_isPositionSet && ((m_position3D.GetX() != rhs.m_position3D.GetX()) || (m_position3D.GetY() != rhs.m_position3D.GetY()) ||
+        (m_position3D.GetZ() != rhs.m_position3D.GetZ()) || (m_chi2 != rhs.m_chi2)))
+    {
+        return false;
+    }
+
+    for (unsigned int index = 0; index < m_trajectorySampleVector.size(); ++index)
+    {
+        const TrajectorySample &lhsSample(m_trajectorySampleVector.at(index)), &rhsSample(rhs.m_trajectorySampleVector.at(index));
+
+        if ((lhsSample.GetHitType() != rhsSample.GetHitType()) || (lhsSample.GetSigma() != rhsSample.GetSigma()) ||
+            (lhsSample.GetPosition().GetX() != rhsSample.GetPosition().GetX()) || (lhsSample.GetPosition().GetY() != rhsSample.GetPosition().GetY()) ||
+            (lhsSample.GetPosition().GetZ() != rhsSample.GetPosition().GetZ()))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
@@ -478,6 +668,21 @@ StatusCode ThreeDHitCreationAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "IterationMaxChi2Ratio", m_iterationMaxChi2Ratio));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "NPfoThreads", m_nPfoThreads));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "CheckPfoThreads", m_checkPfoThreads));
+
+    for (const HitCreationBaseTool *const pHitCreationTool : m_algorithmToolVector)
+    {
+        if ((1 != m_nPfoThreads) && !pHitCreationTool->IsThreadSafe())
+        {
+            std::cout << "ThreeDHitCreationAlgorithm: tool " << pHitCreationTool->GetInstanceName() << " is not thread safe, NPfoThreads must be 1" << std::endl;
+            return STATUS_CODE_INVALID_PARAMETER;
+        }
+    }
+
     return STATUS_CODE_SUCCESS;
 }
 
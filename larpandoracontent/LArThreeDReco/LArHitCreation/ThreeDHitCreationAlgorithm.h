@@ -11,12 +11,15 @@
 #include "Pandora/Algorithm.h"
 #include "Pandora/AlgorithmTool.h"
 
+#include <memory>
 #include <vector>
 
 namespace lar_content
 {
 
 class HitCreationBaseTool;
+class LArMinChiSquaredYZSolver;
+class LArRotationalTransformation;
 class ThreeDSlidingFitResult;
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -152,6 +155,15 @@ public:
          */
         void AddTrajectorySample(const TrajectorySample &trajectorySample);
 
+        /**
+         *  @brief  Whether the proto hit is identical to another, having the same parent 2D calo hit, output values and trajectory samples
+         *
+         *  @param  rhs the other proto hit
+         *
+         *  @return boolean
+         */
+        bool IsIdentical(const ProtoHit &rhs) const;
+
     private:
         const pandora::CaloHit     *m_pParentCaloHit2D;         ///< The address of the parent 2D calo hit
         bool                        m_isPositionSet;            ///< Whether the output 3D position has been set
@@ -167,6 +179,11 @@ public:
      */
     ThreeDHitCreationAlgorithm();
 
+    /**
+     *  @brief  Destructor
+     */
+    ~ThreeDHitCreationAlgorithm();
+
     /**
      *  @brief  Get the subset of a provided calo hit vector corresponding to a specified hit type
      *
@@ -178,8 +195,28 @@ public:
         pandora::CaloHitVector &outputCaloHitVector) const;
 
 private:
+    pandora::StatusCode Initialize();
     pandora::StatusCode Run();
 
+    /**
+     *  @brief  Calculate the proto hits for a pfo, running each hit creation tool in turn and applying any iterative treatment
+     *
+     *  @param  pPfo the address of the pfo
+     *  @param  protoHitVector to receive the proto hits
+     */
+    void CalculateProtoHits(const pandora::ParticleFlowObject *const pPfo, ProtoHitVector &protoHitVector);
+
+    /**
+     *  @brief  Check that the proto hits calculated for a pfo concurrently with other pfos are identical to those from a serial calculation
+     *
+     *  @param  pPfo the address of the pfo
+     *  @param  protoHitVector the proto hits calculated concurrently
+     *  @param  statusCode the status code of the concurrent calculation
+     *
+     *  @throws StatusCodeException, if the calculations differ
+     */
+    void CheckProtoHits(const pandora::ParticleFlowObject *const pPfo, const ProtoHitVector &protoHitVector, const pandora::StatusCode statusCode);
+
     /**
      *  @brief  Get the list of 2D calo hits in a pfo for which 3D hits have and have not been created
      *
@@ -281,6 +318,12 @@ private:
     unsigned int            m_nHitRefinementIterations; ///< The maximum number of hit refinement iterations
     double                  m_sigma3DFitMultiplier;     ///< Multiplicative factor: sigmaUVW (same as sigmaHit and sigma2DFit) to sigma3DFit
     double                  m_iterationMaxChi2Ratio;    ///< Max ratio between current and previous chi2 values to cease iterations
+    unsigned int            m_nPfoThreads;              ///< The number of threads with which to calculate proto hits (one for serial, zero for one per core)
+    bool                    m_checkPfoThreads;          ///< Whether to check that proto hits calculated with multiple threads match a serial calculation.
+                                                        ///< For validation only: each pfo is recalculated serially, so hit creation is slower than serial
+
+    const LArRotationalTransformation *m_pTransformation; ///< The rotational transformation, or nullptr for other transformation plugins
+    std::unique_ptr<LArMinChiSquaredYZSolver> m_pRefinementSolver; ///< The min chi squared yz solver for hit refinement, or nullptr if unavailable
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -54,6 +54,15 @@ void TrackHitsBaseTool::Run(ThreeDHitCreationAlgorithm *const pAlgorithm, const
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+bool TrackHitsBaseTool::IsThreadSafe() const
+{
+    // ATTN Sliding fits are made afresh for each pfo, rather than taken from the shared sliding fit cache, and the tools otherwise read only
+    // the pfo clusters, the geometry and their settings, none of which change while proto hits are calculated
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void TrackHitsBaseTool::BuildSlidingFitMap(const ParticleFlowObject *const pPfo, MatchedSlidingFitMap &matchedSlidingFitMap) const
 {
     const ClusterList &pfoClusterList(pPfo->GetClusterList());
@@ -31,6 +31,8 @@ public:
     virtual void Run(ThreeDHitCreationAlgorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pPfo,
         const pandora::CaloHitVector &inputTwoDHits, ProtoHitVector &protoHitVector);
 
+    virtual bool IsThreadSafe() const;
+
 protected:
     typedef std::map<pandora::HitType, TwoDSlidingFitResult> MatchedSlidingFitMap;
 
@@ -269,7 +269,7 @@ void ParticleRecoveryAlgorithm::CalculateEffectiveSpan(const pandora::Cluster *c
         {
             const float xSample(std::max(xMin, xMinEff - static_cast<float>(iSample) * m_sampleStepSize));
 
-            if (!LArGeometryHelper::IsXSamplingPointInGap(this->GetPandora(), xSample, slidingFitResult, m_sampleStepSize))
+            if (!LArGeometryHelper::IsXSamplingPointInGap(this->GetPandora(), m_pDetectorGapIndex.get(), xSample, slidingFitResult, m_sampleStepSize))
                 break;
 
             dxMin = xMinEff - xSample;
@@ -279,7 +279,7 @@ void ParticleRecoveryAlgorithm::CalculateEffectiveSpan(const pandora::Cluster *c
         {
             const float xSample(std::min(xMax, xMaxEff + static_cast<float>(iSample) * m_sampleStepSize));
 
-            if (!LArGeometryHelper::IsXSamplingPointInGap(this->GetPandora(), xSample, slidingFitResult, m_sampleStepSize))
+            if (!LArGeometryHelper::IsXSamplingPointInGap(this->GetPandora(), m_pDetectorGapIndex.get(), xSample, slidingFitResult, m_sampleStepSize))
                 break;
 
             dxMax = xSample - xMaxEff;
@@ -469,6 +469,14 @@ void ParticleRecoveryAlgorithm::SimpleOverlapTensor::GetConnectedElements(const
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode ParticleRecoveryAlgorithm::Initialize()
+{
+    m_pDetectorGapIndex = LArDetectorGapIndex::GetSharedInstance(this->GetPandora());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ParticleRecoveryAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadVectorOfValues(xmlHandle, "InputClusterListNames", m_inputClusterListNames));
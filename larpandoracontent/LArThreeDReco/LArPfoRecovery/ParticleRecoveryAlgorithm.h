@@ -10,6 +10,9 @@
 
 #include "Pandora/Algorithm.h"
 
+#include "larpandoracontent/LArObjects/LArDetectorGapIndex.h"
+
+#include <memory>
 #include <unordered_map>
 
 namespace lar_content
@@ -172,6 +175,7 @@ private:
      */
     void CreateTrackParticle(const pandora::ClusterList &clusterList) const;
 
+    pandora::StatusCode Initialize();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     pandora::StringVector       m_inputClusterListNames;        ///< The list of cluster list names
@@ -192,6 +196,8 @@ private:
     float                       m_sampleStepSize;               ///< The sampling step size used in association checks, units cm
     unsigned int                m_slidingFitHalfWindow;         ///< The half window for the fit sliding result constructor
     float                       m_pseudoChi2Cut;                ///< The selection cut on the matched chi2
+
+    std::shared_ptr<const LArDetectorGapIndex> m_pDetectorGapIndex; ///< The detector gap index, shared within this pandora instance
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
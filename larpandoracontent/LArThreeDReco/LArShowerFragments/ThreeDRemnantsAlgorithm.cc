@@ -24,6 +24,8 @@ ThreeDRemnantsAlgorithm::ThreeDRemnantsAlgorithm() :
     m_xOverlapWindow(2.f),
     m_pseudoChi2Cut(10.f)
 {
+    // Cluster triples are rejected unless their hit x spans, extended by the overlap window, overlap, so pruning is always safe
+    m_shouldPruneByXOverlap = true;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -124,6 +126,14 @@ void ThreeDRemnantsAlgorithm::ExamineTensor()
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+float ThreeDRemnantsAlgorithm::GetXOverlapPruningWindow() const
+{
+    // Cluster x spans are extended by the overlap window when calculating the overlap result, so the pruning must be at least as tolerant
+    return std::max(m_xOverlapPruningWindow, m_xOverlapWindow);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ThreeDRemnantsAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     AlgorithmToolVector algorithmToolVector;
@@ -39,6 +39,7 @@ public:
 private:
     void CalculateOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV, const pandora::Cluster *const pClusterW);
     void ExamineTensor();
+    float GetXOverlapPruningWindow() const;
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -178,6 +178,27 @@ void ThreeDShowersAlgorithm::CalculateOverlapResult(const Cluster *const pCluste
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode ThreeDShowersAlgorithm::CalculateIndependentOverlapResult(const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW,
+    ShowerOverlapResult &overlapResult)
+{
+    // Reads only the geometry and the sliding fit cache, which is complete before the main loop begins and is not modified during it
+    const StatusCode statusCode(this->CalculateOverlapResult(pClusterU, pClusterV, pClusterW, overlapResult));
+
+    if ((STATUS_CODE_SUCCESS == statusCode) && !overlapResult.IsInitialized())
+        return STATUS_CODE_NOT_FOUND;
+
+    return statusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ThreeDShowersAlgorithm::SupportsParallelMainLoop() const
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ThreeDShowersAlgorithm::CalculateOverlapResult(const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW, ShowerOverlapResult &overlapResult)
 {
     const TwoDSlidingShowerFitResult &fitResultU(this->GetCachedSlidingFitResult(pClusterU));
@@ -109,6 +109,9 @@ private:
     void RemoveFromSlidingFitCache(const pandora::Cluster *const pCluster);
 
     void CalculateOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV, const pandora::Cluster *const pClusterW);
+    pandora::StatusCode CalculateIndependentOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV,
+        const pandora::Cluster *const pClusterW, ShowerOverlapResult &overlapResult);
+    bool SupportsParallelMainLoop() const;
 
     /**
      *  @brief  Calculate the overlap result for given group of clusters
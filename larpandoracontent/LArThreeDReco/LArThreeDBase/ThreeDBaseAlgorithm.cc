@@ -9,6 +9,7 @@
 #include "Pandora/AlgorithmHeaders.h"
 
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
+#include "larpandoracontent/LArHelpers/LArMultiThreadingHelper.h"
 
 #include "larpandoracontent/LArObjects/LArOverlapTensor.h"
 #include "larpandoracontent/LArObjects/LArShowerOverlapResult.h"
@@ -16,16 +17,92 @@
 
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/ThreeDBaseAlgorithm.h"
 
+#include <algorithm>
+#include <limits>
+
 using namespace pandora;
 
 namespace lar_content
 {
 
+ClusterXSpanIndex::ClusterXSpanIndex(const ClusterVector &clusterVector, const float xWindow) :
+    m_clusterVector(clusterVector),
+    m_nLeafNodes(1)
+{
+    for (const Cluster *const pCluster : m_clusterVector)
+    {
+        float xMin(0.f), xMax(0.f);
+        LArClusterHelper::GetClusterSpanX(pCluster, xMin, xMax);
+
+        // Clusters without hits can never overlap any interval; record an inverted span that will fail all overlap checks
+        m_xSpans.push_back((xMin > xMax) ? XSpan(xMin, xMax) : XSpan(xMin - xWindow, xMax + xWindow));
+    }
+
+    while (m_nLeafNodes < m_clusterVector.size())
+        m_nLeafNodes *= 2;
+
+    // Node n covers the clusters covered by nodes 2n and 2n + 1; leaf node (m_nLeafNodes + i) covers cluster i alone
+    m_nodeMinX.assign(2 * m_nLeafNodes, std::numeric_limits<float>::max());
+    m_nodeMaxX.assign(2 * m_nLeafNodes, -std::numeric_limits<float>::max());
+
+    for (unsigned int index = 0; index < m_xSpans.size(); ++index)
+    {
+        if (m_xSpans.at(index).first > m_xSpans.at(index).second)
+            continue;
+
+        m_nodeMinX.at(m_nLeafNodes + index) = m_xSpans.at(index).first;
+        m_nodeMaxX.at(m_nLeafNodes + index) = m_xSpans.at(index).second;
+    }
+
+    for (unsigned int node = m_nLeafNodes - 1; node > 0; --node)
+    {
+        m_nodeMinX.at(node) = std::min(m_nodeMinX.at(2 * node), m_nodeMinX.at(2 * node + 1));
+        m_nodeMaxX.at(node) = std::max(m_nodeMaxX.at(2 * node), m_nodeMaxX.at(2 * node + 1));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterXSpanIndex::GetOverlappingIndices(const float xMin, const float xMax, IndexVector &indices) const
+{
+    indices.clear();
+
+    if ((xMin > xMax) || m_clusterVector.empty())
+        return;
+
+    this->GetOverlappingIndices(1, xMin, xMax, indices);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterXSpanIndex::GetOverlappingIndices(const unsigned int node, const float xMin, const float xMax, IndexVector &indices) const
+{
+    if ((m_nodeMaxX.at(node) < xMin) || (m_nodeMinX.at(node) > xMax))
+        return;
+
+    if (node >= m_nLeafNodes)
+    {
+        indices.push_back(node - m_nLeafNodes);
+        return;
+    }
+
+    // Visiting the lower-index child first reports the overlapping clusters in ascending index order, with no need for sorting
+    this->GetOverlappingIndices(2 * node, xMin, xMax, indices);
+    this->GetOverlappingIndices(2 * node + 1, xMin, xMax, indices);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 ThreeDBaseAlgorithm<T>::ThreeDBaseAlgorithm() :
     m_pInputClusterListU(NULL),
     m_pInputClusterListV(NULL),
-    m_pInputClusterListW(NULL)
+    m_pInputClusterListW(NULL),
+    m_shouldPruneByXOverlap(false),
+    m_xOverlapPruningWindow(1.f),
+    m_nMainLoopThreads(1),
+    m_checkMainLoopThreads(false)
 {
 }
 
@@ -91,6 +168,7 @@ bool ThreeDBaseAlgorithm<T>::MakeClusterMerges(const ClusterMergeMap &clusterMer
             if (deletedClusters.count(pParentCluster) || deletedClusters.count(pDaughterCluster))
                 throw StatusCodeException(STATUS_CODE_FAILURE);
 
+            this->PrepareClusterMerge(pParentCluster, pDaughterCluster);
             this->UpdateUponDeletion(pDaughterCluster);
             this->UpdateUponDeletion(pParentCluster);
             PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, PandoraContentApi::MergeAndDeleteClusters(*this, pParentCluster, pDaughterCluster, clusterListName, clusterListName));
@@ -105,6 +183,13 @@ bool ThreeDBaseAlgorithm<T>::MakeClusterMerges(const ClusterMergeMap &clusterMer
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+void ThreeDBaseAlgorithm<T>::PrepareClusterMerge(const Cluster *const, const Cluster *const)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 void ThreeDBaseAlgorithm<T>::UpdateForNewCluster(const Cluster *const pNewCluster)
 {
@@ -128,23 +213,52 @@ void ThreeDBaseAlgorithm<T>::UpdateForNewCluster(const Cluster *const pNewCluste
     std::sort(clusterVector1.begin(), clusterVector1.end(), LArClusterHelper::SortByNHits);
     std::sort(clusterVector2.begin(), clusterVector2.end(), LArClusterHelper::SortByNHits);
 
-    for (const Cluster *const pCluster1 : clusterVector1)
+    auto calculateOverlapResult = [&](const Cluster *const pCluster1, const Cluster *const pCluster2) -> void
     {
-        for (const Cluster *const pCluster2 : clusterVector2)
+        if (TPC_VIEW_U == hitType)
         {
-            if (TPC_VIEW_U == hitType)
-            {
-                this->CalculateOverlapResult(pNewCluster, pCluster1, pCluster2);
-            }
-            else if (TPC_VIEW_V == hitType)
-            {
-                this->CalculateOverlapResult(pCluster1, pNewCluster, pCluster2);
-            }
-            else
-            {
-                this->CalculateOverlapResult(pCluster1, pCluster2, pNewCluster);
-            }
+            this->CalculateOverlapResult(pNewCluster, pCluster1, pCluster2);
         }
+        else if (TPC_VIEW_V == hitType)
+        {
+            this->CalculateOverlapResult(pCluster1, pNewCluster, pCluster2);
+        }
+        else
+        {
+            this->CalculateOverlapResult(pCluster1, pCluster2, pNewCluster);
+        }
+    };
+
+    if (!m_shouldPruneByXOverlap)
+    {
+        for (const Cluster *const pCluster1 : clusterVector1)
+        {
+            for (const Cluster *const pCluster2 : clusterVector2)
+                calculateOverlapResult(pCluster1, pCluster2);
+        }
+
+        return;
+    }
+
+    const float xWindow(this->GetXOverlapPruningWindow());
+    const ClusterXSpanIndex xSpanIndexNew(ClusterVector(1, pNewCluster), xWindow);
+    const ClusterXSpanIndex xSpanIndex1(clusterVector1, xWindow);
+    const ClusterXSpanIndex xSpanIndex2(clusterVector2, xWindow);
+
+    float xMinNew(0.f), xMaxNew(0.f);
+    xSpanIndexNew.GetXSpan(0, xMinNew, xMaxNew);
+
+    ClusterXSpanIndex::IndexVector indices1, indices2;
+    xSpanIndex1.GetOverlappingIndices(xMinNew, xMaxNew, indices1);
+
+    for (const unsigned int index1 : indices1)
+    {
+        float xMin1(0.f), xMax1(0.f);
+        xSpanIndex1.GetXSpan(index1, xMin1, xMax1);
+        xSpanIndex2.GetOverlappingIndices(std::max(xMinNew, xMin1), std::min(xMaxNew, xMax1), indices2);
+
+        for (const unsigned int index2 : indices2)
+            calculateOverlapResult(xSpanIndex1.GetCluster(index1), xSpanIndex2.GetCluster(index2));
     }
 }
 
@@ -286,18 +400,201 @@ void ThreeDBaseAlgorithm<T>::PerformMainLoop()
     std::sort(clusterVectorV.begin(), clusterVectorV.end(), LArClusterHelper::SortByNHits);
     std::sort(clusterVectorW.begin(), clusterVectorW.end(), LArClusterHelper::SortByNHits);
 
-    for (const Cluster *const pClusterU : clusterVectorU)
+    if (1 != m_nMainLoopThreads)
+    {
+        this->PerformParallelMainLoop(clusterVectorU, clusterVectorV, clusterVectorW);
+        return;
+    }
+
+    if (!m_shouldPruneByXOverlap)
+    {
+        for (const Cluster *const pClusterU : clusterVectorU)
+        {
+            for (const Cluster *const pClusterV : clusterVectorV)
+            {
+                for (const Cluster *const pClusterW : clusterVectorW)
+                    this->CalculateOverlapResult(pClusterU, pClusterV, pClusterW);
+            }
+        }
+
+        return;
+    }
+
+    // Consider only those cluster combinations with a common overlap in x, visiting them in the same order as the exhaustive loop
+    const float xWindow(this->GetXOverlapPruningWindow());
+    const ClusterXSpanIndex xSpanIndexU(clusterVectorU, xWindow);
+    const ClusterXSpanIndex xSpanIndexV(clusterVectorV, xWindow);
+    const ClusterXSpanIndex xSpanIndexW(clusterVectorW, xWindow);
+
+    ClusterXSpanIndex::IndexVector indicesV, indicesW;
+
+    for (unsigned int indexU = 0; indexU < xSpanIndexU.GetNClusters(); ++indexU)
     {
-        for (const Cluster *const pClusterV : clusterVectorV)
+        float xMinU(0.f), xMaxU(0.f);
+        xSpanIndexU.GetXSpan(indexU, xMinU, xMaxU);
+        xSpanIndexV.GetOverlappingIndices(xMinU, xMaxU, indicesV);
+
+        for (const unsigned int indexV : indicesV)
         {
-            for (const Cluster *const pClusterW : clusterVectorW)
-                this->CalculateOverlapResult(pClusterU, pClusterV, pClusterW);
+            float xMinV(0.f), xMaxV(0.f);
+            xSpanIndexV.GetXSpan(indexV, xMinV, xMaxV);
+            xSpanIndexW.GetOverlappingIndices(std::max(xMinU, xMinV), std::min(xMaxU, xMaxV), indicesW);
+
+            for (const unsigned int indexW : indicesW)
+                this->CalculateOverlapResult(xSpanIndexU.GetCluster(indexU), xSpanIndexV.GetCluster(indexV), xSpanIndexW.GetCluster(indexW));
         }
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename T>
+void ThreeDBaseAlgorithm<T>::PerformParallelMainLoop(const ClusterVector &clusterVectorU, const ClusterVector &clusterVectorV, const ClusterVector &clusterVectorW)
+{
+    const float xWindow(this->GetXOverlapPruningWindow());
+    const ClusterXSpanIndex xSpanIndexU(clusterVectorU, xWindow);
+    const ClusterXSpanIndex xSpanIndexV(clusterVectorV, xWindow);
+    const ClusterXSpanIndex xSpanIndexW(clusterVectorW, xWindow);
+
+    // Each task considers a single u cluster, storing its overlap results in a dedicated buffer, so no state is shared between threads
+    const unsigned int nTasks(clusterVectorU.size());
+    std::vector<OverlapResultEntryVector> overlapResultEntries(nTasks);
+
+    auto calculateOverlapResults = [&](const unsigned int indexU, OverlapResultEntryVector &overlapResultEntryVector) -> StatusCode
+    {
+        const Cluster *const pClusterU(xSpanIndexU.GetCluster(indexU));
+        ClusterPairVector clusterPairsVW;
+
+        if (!m_shouldPruneByXOverlap)
+        {
+            for (const Cluster *const pClusterV : clusterVectorV)
+            {
+                for (const Cluster *const pClusterW : clusterVectorW)
+                    clusterPairsVW.push_back(ClusterPair(pClusterV, pClusterW));
+            }
+        }
+        else
+        {
+            float xMinU(0.f), xMaxU(0.f);
+            xSpanIndexU.GetXSpan(indexU, xMinU, xMaxU);
+
+            ClusterXSpanIndex::IndexVector indicesV, indicesW;
+            xSpanIndexV.GetOverlappingIndices(xMinU, xMaxU, indicesV);
+
+            for (const unsigned int indexV : indicesV)
+            {
+                float xMinV(0.f), xMaxV(0.f);
+                xSpanIndexV.GetXSpan(indexV, xMinV, xMaxV);
+                xSpanIndexW.GetOverlappingIndices(std::max(xMinU, xMinV), std::min(xMaxU, xMaxV), indicesW);
+
+                for (const unsigned int indexW : indicesW)
+                    clusterPairsVW.push_back(ClusterPair(xSpanIndexV.GetCluster(indexV), xSpanIndexW.GetCluster(indexW)));
+            }
+        }
+
+        for (const ClusterPair &clusterPairVW : clusterPairsVW)
+        {
+            T overlapResult;
+            const StatusCode statusCode(this->CalculateIndependentOverlapResult(pClusterU, clusterPairVW.first, clusterPairVW.second, overlapResult));
+
+            if (STATUS_CODE_NOT_FOUND == statusCode)
+                continue;
+
+            if (STATUS_CODE_SUCCESS != statusCode)
+                return statusCode;
+
+            overlapResultEntryVector.push_back(OverlapResultEntry(clusterPairVW, overlapResult));
+        }
+
+        return STATUS_CODE_SUCCESS;
+    };
+
+    const unsigned int nThreads(LArMultiThreadingHelper::GetNThreads(m_nMainLoopThreads, nTasks));
+    const StatusCode statusCode(LArMultiThreadingHelper::RunTasks(nTasks, nThreads, [&](const unsigned int indexU) -> StatusCode
+    {
+        return calculateOverlapResults(indexU, overlapResultEntries.at(indexU));
+    }));
+
+    if (STATUS_CODE_SUCCESS != statusCode)
+        throw StatusCodeException(statusCode);
+
+    if (m_checkMainLoopThreads)
+    {
+        for (unsigned int indexU = 0; indexU < nTasks; ++indexU)
+        {
+            OverlapResultEntryVector serialOverlapResultEntries;
+            const StatusCode serialStatusCode(calculateOverlapResults(indexU, serialOverlapResultEntries));
+
+            if ((STATUS_CODE_SUCCESS != serialStatusCode) ||
+                !ThreeDBaseAlgorithm<T>::AreEquivalent(overlapResultEntries.at(indexU), serialOverlapResultEntries))
+            {
+                std::cout << "ThreeDBaseAlgorithm: overlap results calculated concurrently differ from the serial calculation" << std::endl;
+                throw StatusCodeException(STATUS_CODE_FAILURE);
+            }
+        }
+    }
+
+    // Merge the overlap results into the tensor serially, in the same order as the serial main loop
+    for (unsigned int indexU = 0; indexU < nTasks; ++indexU)
+    {
+        for (const OverlapResultEntry &overlapResultEntry : overlapResultEntries.at(indexU))
+        {
+            m_overlapTensor.SetOverlapResult(xSpanIndexU.GetCluster(indexU), overlapResultEntry.first.first, overlapResultEntry.first.second,
+                overlapResultEntry.second);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+bool ThreeDBaseAlgorithm<T>::AreEquivalent(const OverlapResultEntryVector &overlapResultEntries, const OverlapResultEntryVector &serialOverlapResultEntries)
+{
+    if (overlapResultEntries.size() != serialOverlapResultEntries.size())
+        return false;
+
+    for (unsigned int index = 0; index < overlapResultEntries.size(); ++index)
+    {
+        const OverlapResultEntry &overlapResultEntry(overlapResultEntries.at(index));
+        const OverlapResultEntry &serialOverlapResultEntry(serialOverlapResultEntries.at(index));
+
+        if (overlapResultEntry.first != serialOverlapResultEntry.first)
+            return false;
+
+        // ATTN Only initialized results are stored, see CalculateIndependentOverlapResult, so the results can always be ordered
+        if ((overlapResultEntry.second < serialOverlapResultEntry.second) || (serialOverlapResultEntry.second < overlapResultEntry.second))
+            return false;
+    }
+
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+StatusCode ThreeDBaseAlgorithm<T>::CalculateIndependentOverlapResult(const Cluster *const, const Cluster *const, const Cluster *const, T &)
+{
+    return STATUS_CODE_NOT_ALLOWED;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+bool ThreeDBaseAlgorithm<T>::SupportsParallelMainLoop() const
+{
+    return false;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+float ThreeDBaseAlgorithm<T>::GetXOverlapPruningWindow() const
+{
+    return m_xOverlapPruningWindow;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template <typename T>
 StatusCode ThreeDBaseAlgorithm<T>::ReadSettings(const TiXmlHandle xmlHandle)
 {
@@ -306,6 +603,30 @@ StatusCode ThreeDBaseAlgorithm<T>::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "InputClusterListNameW", m_inputClusterListNameW));
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "OutputPfoListName", m_outputPfoListName));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "ShouldPruneByXOverlap", m_shouldPruneByXOverlap));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "XOverlapPruningWindow", m_xOverlapPruningWindow));
+
+    if (m_xOverlapPruningWindow < 0.f)
+    {
+        std::cout << "ThreeDBaseAlgorithm: XOverlapPruningWindow must be non-negative" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "NMainLoopThreads", m_nMainLoopThreads));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "CheckMainLoopThreads", m_checkMainLoopThreads));
+
+    if ((1 != m_nMainLoopThreads) && !this->SupportsParallelMainLoop())
+    {
+        std::cout << "ThreeDBaseAlgorithm: this algorithm does not support a parallel main loop, NMainLoopThreads must be 1" << std::endl;
+        return STATUS_CODE_INVALID_PARAMETER;
+    }
+
     return STATUS_CODE_SUCCESS;
 }
 
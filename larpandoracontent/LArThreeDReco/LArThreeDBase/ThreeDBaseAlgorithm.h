@@ -15,6 +15,7 @@
 #include "larpandoracontent/LArObjects/LArOverlapTensor.h"
 
 #include <unordered_map>
+#include <vector>
 
 namespace lar_content
 {
@@ -35,6 +36,81 @@ typedef std::unordered_map<const pandora::Cluster*, pandora::ClusterList> Cluste
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+/**
+ *  @brief  ClusterXSpanIndex class, a binary tree over the cluster indices, recording the x extent of the clusters beneath each node, used
+ *          to identify the clusters whose x spans overlap a given x interval
+ */
+class ClusterXSpanIndex
+{
+public:
+    typedef std::vector<unsigned int> IndexVector;
+
+    /**
+     *  @brief  Constructor
+     *
+     *  @param  clusterVector the cluster vector to index, in the order in which clusters should be reported
+     *  @param  xWindow the window by which each cluster x span is extended, in both directions
+     */
+    ClusterXSpanIndex(const pandora::ClusterVector &clusterVector, const float xWindow);
+
+    /**
+     *  @brief  Get the indices of the clusters whose (extended) x spans overlap a given x interval
+     *
+     *  @param  xMin the minimum x coordinate of the interval
+     *  @param  xMax the maximum x coordinate of the interval
+     *  @param  indices to receive the cluster indices, in ascending order (matching the order of the input cluster vector)
+     */
+    void GetOverlappingIndices(const float xMin, const float xMax, IndexVector &indices) const;
+
+    /**
+     *  @brief  Get the (extended) x span of an indexed cluster
+     *
+     *  @param  index the cluster index
+     *  @param  xMin to receive the minimum x coordinate
+     *  @param  xMax to receive the maximum x coordinate
+     */
+    void GetXSpan(const unsigned int index, float &xMin, float &xMax) const;
+
+    /**
+     *  @brief  Get the address of an indexed cluster
+     *
+     *  @param  index the cluster index
+     *
+     *  @return the address of the cluster
+     */
+    const pandora::Cluster *GetCluster(const unsigned int index) const;
+
+    /**
+     *  @brief  Get the number of indexed clusters
+     *
+     *  @return the number of indexed clusters
+     */
+    unsigned int GetNClusters() const;
+
+private:
+    typedef std::pair<float, float> XSpan;
+    typedef std::vector<XSpan> XSpanVector;
+    typedef std::vector<float> FloatVector;
+
+    /**
+     *  @brief  Append the indices of the clusters beneath a specified tree node whose (extended) x spans overlap a given x interval
+     *
+     *  @param  node the tree node
+     *  @param  xMin the minimum x coordinate of the interval
+     *  @param  xMax the maximum x coordinate of the interval
+     *  @param  indices to receive the cluster indices, in ascending order
+     */
+    void GetOverlappingIndices(const unsigned int node, const float xMin, const float xMax, IndexVector &indices) const;
+
+    pandora::ClusterVector      m_clusterVector;                ///< The indexed clusters
+    XSpanVector                 m_xSpans;                       ///< The (extended) x span of each cluster, ordered by cluster index
+    unsigned int                m_nLeafNodes;                   ///< The number of leaf nodes in the tree, a power of two
+    FloatVector                 m_nodeMinX;                     ///< The minimum (extended) x coordinate of the clusters beneath each tree node
+    FloatVector                 m_nodeMaxX;                     ///< The maximum (extended) x coordinate of the clusters beneath each tree node
+};
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 /**
  *  @brief  ThreeDBaseAlgorithm class
  */
@@ -80,6 +156,14 @@ public:
      */
     virtual bool MakeClusterMerges(const ClusterMergeMap &clusterMergeMap);
 
+    /**
+     *  @brief  Prepare for the merge of a daughter cluster into a parent cluster, called before either is removed from the problem space
+     *
+     *  @param  pParentCluster address of the parent cluster
+     *  @param  pDaughterCluster address of the daughter cluster
+     */
+    virtual void PrepareClusterMerge(const pandora::Cluster *const pParentCluster, const pandora::Cluster *const pDaughterCluster);
+
     /**
      *  @brief  Update to reflect addition of a new cluster to the problem space
      *
@@ -167,9 +251,17 @@ protected:
 
     /**
      *  @brief  Main loop over cluster combinations in order to populate the tensor. Responsible for calling CalculateOverlapResult.
+     *          If x overlap pruning is enabled, only combinations of clusters with a common (extended) x overlap are considered.
      */
     virtual void PerformMainLoop();
 
+    /**
+     *  @brief  Get the window by which cluster x spans are extended when pruning cluster combinations by x overlap
+     *
+     *  @return the x overlap pruning window
+     */
+    virtual float GetXOverlapPruningWindow() const;
+
     /**
      *  @brief  Calculate cluster overlap result and store in tensor
      *
@@ -179,6 +271,29 @@ protected:
      */
     virtual void CalculateOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV, const pandora::Cluster *const pClusterW) = 0;
 
+    /**
+     *  @brief  Calculate cluster overlap result, without storing it in the tensor or modifying any other algorithm state. Required only
+     *          by the parallel main loop, so must be safe to call concurrently from multiple threads. The default implementation is a
+     *          placeholder, indicating that the parallel main loop is not supported.
+     *
+     *  @param  pClusterU address of U view cluster
+     *  @param  pClusterV address of V view cluster
+     *  @param  pClusterW address of W view cluster
+     *  @param  overlapResult to receive the overlap result
+     *
+     *  @return STATUS_CODE_SUCCESS if an initialized overlap result should be stored, STATUS_CODE_NOT_FOUND if not, or STATUS_CODE_NOT_ALLOWED if
+     *          the calculation is not supported
+     */
+    virtual pandora::StatusCode CalculateIndependentOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV,
+        const pandora::Cluster *const pClusterW, T &overlapResult);
+
+    /**
+     *  @brief  Whether the algorithm supports the parallel main loop, i.e. whether it implements CalculateIndependentOverlapResult
+     *
+     *  @return boolean
+     */
+    virtual bool SupportsParallelMainLoop() const;
+
     /**
      *  @brief  Examine contents of tensor, collect together best-matching 2D particles and modify clusters as required
      */
@@ -199,17 +314,74 @@ protected:
 
     TensorType                  m_overlapTensor;                ///< The overlap tensor
 
+    bool                        m_shouldPruneByXOverlap;        ///< Whether to consider only cluster combinations with a common hit x overlap
+    float                       m_xOverlapPruningWindow;        ///< The window by which cluster x spans are extended when pruning by x overlap
+
 private:
+    typedef std::pair<const pandora::Cluster*, const pandora::Cluster*> ClusterPair;
+    typedef std::vector<ClusterPair> ClusterPairVector;
+    typedef std::pair<ClusterPair, T> OverlapResultEntry;
+    typedef std::vector<OverlapResultEntry> OverlapResultEntryVector;
+
     pandora::StatusCode Run();
 
+    /**
+     *  @brief  Main loop over cluster combinations, calculating overlap results on multiple threads and then storing them in the tensor
+     *          in the same order as the serial main loop
+     *
+     *  @param  clusterVectorU the u clusters, sorted by number of hits
+     *  @param  clusterVectorV the v clusters, sorted by number of hits
+     *  @param  clusterVectorW the w clusters, sorted by number of hits
+     */
+    void PerformParallelMainLoop(const pandora::ClusterVector &clusterVectorU, const pandora::ClusterVector &clusterVectorV,
+        const pandora::ClusterVector &clusterVectorW);
+
+    /**
+     *  @brief  Whether overlap results calculated concurrently are equivalent to those from a serial calculation, i.e. whether they are for the
+     *          same cluster combinations, in the same order, with results that the tensor ordering cannot distinguish
+     *
+     *  @param  overlapResultEntries the overlap results calculated concurrently
+     *  @param  serialOverlapResultEntries the overlap results calculated serially
+     *
+     *  @return boolean
+     */
+    static bool AreEquivalent(const OverlapResultEntryVector &overlapResultEntries, const OverlapResultEntryVector &serialOverlapResultEntries);
+
     std::string                 m_inputClusterListNameU;        ///< The name of the view U cluster list
     std::string                 m_inputClusterListNameV;        ///< The name of the view V cluster list
     std::string                 m_inputClusterListNameW;        ///< The name of the view W cluster list
     std::string                 m_outputPfoListName;            ///< The output pfo list name
+    unsigned int                m_nMainLoopThreads;             ///< The number of main loop threads (one for the serial loop, zero for one per core)
+    bool                        m_checkMainLoopThreads;         ///< Whether to check that overlap results calculated with multiple threads match a
+                                                                ///< serial calculation. For validation only: each result is recalculated serially
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline void ClusterXSpanIndex::GetXSpan(const unsigned int index, float &xMin, float &xMax) const
+{
+    const XSpan &xSpan(m_xSpans.at(index));
+    xMin = xSpan.first;
+    xMax = xSpan.second;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::Cluster *ClusterXSpanIndex::GetCluster(const unsigned int index) const
+{
+    return m_clusterVector.at(index);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int ClusterXSpanIndex::GetNClusters() const
+{
+    return m_clusterVector.size();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template<typename T>
 inline const pandora::ClusterList &ThreeDBaseAlgorithm<T>::GetInputClusterListU() const
 {
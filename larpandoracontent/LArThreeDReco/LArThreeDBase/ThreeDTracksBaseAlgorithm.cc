@@ -13,6 +13,7 @@
 
 #include "larpandoracontent/LArObjects/LArPointingCluster.h"
 #include "larpandoracontent/LArObjects/LArTrackOverlapResult.h"
+#include "larpandoracontent/LArObjects/LArTwoDSlidingFitCache.h"
 
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/ThreeDTracksBaseAlgorithm.h"
 
@@ -24,6 +25,7 @@ namespace lar_content
 template<typename T>
 ThreeDTracksBaseAlgorithm<T>::ThreeDTracksBaseAlgorithm() :
     m_slidingFitWindow(20),
+    m_shouldUpdateFitsIncrementally(false),
     m_minClusterCaloHits(5),
     m_minClusterLengthSquared(3.f * 3.f)
 {
@@ -41,12 +43,12 @@ ThreeDTracksBaseAlgorithm<T>::~ThreeDTracksBaseAlgorithm()
 template<typename T>
 const TwoDSlidingFitResult &ThreeDTracksBaseAlgorithm<T>::GetCachedSlidingFitResult(const Cluster *const pCluster) const
 {
-    TwoDSlidingFitResultMap::const_iterator iter = m_slidingFitResultMap.find(pCluster);
+    TwoDSlidingFitResultPtrMap::const_iterator iter = m_slidingFitResultMap.find(pCluster);
 
     if (m_slidingFitResultMap.end() == iter)
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
-    return iter->second;
+    return *iter->second;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -76,11 +78,23 @@ bool ThreeDTracksBaseAlgorithm<T>::MakeClusterSplits(const SplitPositionMap &spl
         for (CartesianPointVector::const_iterator sIter = splitPositions.begin(), sIterEnd = splitPositions.end(); sIter != sIterEnd; ++sIter)
         {
             const Cluster *pLowXCluster(NULL), *pHighXCluster(NULL);
+
+            // ATTN Retain the original fit, shared with the algorithm cache where it is about to be deleted
+            LArTwoDSlidingFitCache::TwoDSlidingFitResultPtr originalFitResultPtr;
+            TwoDSlidingFitResultPtrMap::const_iterator fitIter(m_slidingFitResultMap.find(pCurrentCluster));
+
+            if (m_shouldUpdateFitsIncrementally && (m_slidingFitResultMap.end() != fitIter))
+                originalFitResultPtr = fitIter->second;
+
             this->UpdateUponDeletion(pCurrentCluster);
 
             if (this->MakeClusterSplit(*sIter, pCurrentCluster, pLowXCluster, pHighXCluster))
             {
                 changesMade = true;
+
+                if (originalFitResultPtr)
+                    this->PrepareSplitSlidingFitResult(*originalFitResultPtr, pLowXCluster, pHighXCluster);
+
                 this->UpdateForNewCluster(pLowXCluster);
                 this->UpdateForNewCluster(pHighXCluster);
                 pCurrentCluster = pHighXCluster;
@@ -166,6 +180,36 @@ bool ThreeDTracksBaseAlgorithm<T>::SortSplitPositions(const pandora::CartesianVe
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template<typename T>
+void ThreeDTracksBaseAlgorithm<T>::PrepareClusterMerge(const Cluster *const pParentCluster, const Cluster *const pDaughterCluster)
+{
+    if (!m_shouldUpdateFitsIncrementally)
+        return;
+
+    TwoDSlidingFitResultPtrMap::const_iterator parentIter(m_slidingFitResultMap.find(pParentCluster));
+
+    if (m_slidingFitResultMap.end() == parentIter)
+        return;
+
+    // Retain the parent primary axis and add only the daughter positions, rather than refitting all positions of the merged cluster
+    CartesianPointVector daughterPointVector;
+    LArClusterHelper::GetCoordinateVector(pDaughterCluster, daughterPointVector);
+
+    m_preparedSlidingFitResultMap.erase(pParentCluster);
+
+    try
+    {
+        m_preparedSlidingFitResultMap.emplace(pParentCluster,
+            std::make_shared<TwoDSlidingFitResult>(pParentCluster, *parentIter->second, daughterPointVector, CartesianPointVector()));
+    }
+    catch (StatusCodeException &)
+    {
+        // No result is prepared, so the merged cluster is fitted from scratch when it is added to the cache
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template<typename T>
 void ThreeDTracksBaseAlgorithm<T>::UpdateForNewCluster(const Cluster *const pNewCluster)
 {
@@ -233,6 +277,24 @@ void ThreeDTracksBaseAlgorithm<T>::SetPfoParameters(const ProtoParticle &protoPa
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template<typename T>
+StatusCode ThreeDTracksBaseAlgorithm<T>::Initialize()
+{
+    m_pSlidingFitCache = LArTwoDSlidingFitCache::GetSharedInstance(this->GetPandora());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template<typename T>
+StatusCode ThreeDTracksBaseAlgorithm<T>::Reset()
+{
+    m_pSlidingFitCache->Clear();
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template<typename T>
 void ThreeDTracksBaseAlgorithm<T>::PreparationStep()
 {
@@ -271,6 +333,7 @@ template<typename T>
 void ThreeDTracksBaseAlgorithm<T>::TidyUp()
 {
     m_slidingFitResultMap.clear();
+    m_preparedSlidingFitResultMap.clear();
     return ThreeDBaseAlgorithm<T>::TidyUp();
 }
 
@@ -279,19 +342,59 @@ void ThreeDTracksBaseAlgorithm<T>::TidyUp()
 template<typename T>
 void ThreeDTracksBaseAlgorithm<T>::AddToSlidingFitCache(const Cluster *const pCluster)
 {
+    TwoDSlidingFitResultPtrMap::iterator preparedIter(m_preparedSlidingFitResultMap.find(pCluster));
+
+    if (m_preparedSlidingFitResultMap.end() != preparedIter)
+    {
+        const bool isInserted(m_slidingFitResultMap.emplace(pCluster, preparedIter->second).second);
+        m_preparedSlidingFitResultMap.erase(preparedIter);
+
+        if (!isInserted)
+            throw StatusCodeException(STATUS_CODE_FAILURE);
+
+        return;
+    }
+
     const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
-    const TwoDSlidingFitResult slidingFitResult(pCluster, m_slidingFitWindow, slidingFitPitch);
+    const LArTwoDSlidingFitCache::TwoDSlidingFitResultPtr slidingFitResultPtr(m_pSlidingFitCache->GetSlidingFitResult(pCluster, m_slidingFitWindow, slidingFitPitch));
 
-    if (!m_slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(pCluster, slidingFitResult)).second)
+    if (!m_slidingFitResultMap.insert(TwoDSlidingFitResultPtrMap::value_type(pCluster, slidingFitResultPtr)).second)
         throw StatusCodeException(STATUS_CODE_FAILURE);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template<typename T>
+void ThreeDTracksBaseAlgorithm<T>::PrepareSplitSlidingFitResult(const TwoDSlidingFitResult &originalFitResult, const Cluster *const pLowXCluster,
+    const Cluster *const pHighXCluster)
+{
+    const bool isLowXLarger(pLowXCluster->GetNCaloHits() > pHighXCluster->GetNCaloHits());
+    const Cluster *const pLargerCluster(isLowXLarger ? pLowXCluster : pHighXCluster);
+    const Cluster *const pSmallerCluster(isLowXLarger ? pHighXCluster : pLowXCluster);
+
+    // Visit only the positions of the smaller fragment; the smaller fragment itself will be fitted from scratch
+    CartesianPointVector smallerPointVector;
+    LArClusterHelper::GetCoordinateVector(pSmallerCluster, smallerPointVector);
+
+    m_preparedSlidingFitResultMap.erase(pLargerCluster);
+
+    try
+    {
+        m_preparedSlidingFitResultMap.emplace(pLargerCluster,
+            std::make_shared<TwoDSlidingFitResult>(pLargerCluster, originalFitResult, CartesianPointVector(), smallerPointVector));
+    }
+    catch (StatusCodeException &)
+    {
+        // No result is prepared, so the larger fragment is fitted from scratch when it is added to the cache
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template<typename T>
 void ThreeDTracksBaseAlgorithm<T>::RemoveFromSlidingFitCache(const Cluster *const pCluster)
 {
-    TwoDSlidingFitResultMap::iterator iter = m_slidingFitResultMap.find(pCluster);
+    TwoDSlidingFitResultPtrMap::iterator iter = m_slidingFitResultMap.find(pCluster);
 
     if (m_slidingFitResultMap.end() != iter)
         m_slidingFitResultMap.erase(iter);
@@ -305,6 +408,9 @@ StatusCode ThreeDTracksBaseAlgorithm<T>::ReadSettings(const TiXmlHandle xmlHandl
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "SlidingFitWindow", m_slidingFitWindow));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "ShouldUpdateFitsIncrementally", m_shouldUpdateFitsIncrementally));
+
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "MinClusterCaloHits", m_minClusterCaloHits));
 
@@ -8,10 +8,12 @@
 #ifndef LAR_THREE_D_TRACKS_BASE_ALGORITHM_H
 #define LAR_THREE_D_TRACKS_BASE_ALGORITHM_H 1
 
+#include "larpandoracontent/LArObjects/LArTwoDSlidingFitCache.h"
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
 #include "larpandoracontent/LArThreeDReco/LArThreeDBase/ThreeDBaseAlgorithm.h"
 
+#include <memory>
 #include <unordered_map>
 
 namespace lar_content
@@ -82,12 +84,15 @@ public:
      */
     static bool SortSplitPositions(const pandora::CartesianVector &lhs, const pandora::CartesianVector &rhs);
 
+    virtual void PrepareClusterMerge(const pandora::Cluster *const pParentCluster, const pandora::Cluster *const pDaughterCluster);
     virtual void UpdateForNewCluster(const pandora::Cluster *const pNewCluster);
     virtual void UpdateUponDeletion(const pandora::Cluster *const pDeletedCluster);
     virtual void SelectInputClusters(const pandora::ClusterList *const pInputClusterList, pandora::ClusterList &selectedClusterList) const;
     virtual void SetPfoParameters(const ProtoParticle &protoParticle, PandoraContentApi::ParticleFlowObject::Parameters &pfoParameters) const;
 
 protected:
+    virtual pandora::StatusCode Initialize();
+    virtual pandora::StatusCode Reset();
     virtual void PreparationStep();
 
     /**
@@ -100,12 +105,24 @@ protected:
     virtual void TidyUp();
 
     /**
-     *  @brief  Add a new sliding fit result, for the specified cluster, to the algorithm cache
+     *  @brief  Add a new sliding fit result, for the specified cluster, to the algorithm cache. Unless a result has been prepared by an
+     *          incremental update, the result is taken from the shared, event-scoped sliding fit cache.
      *
      *  @param  pCluster address of the relevant cluster
      */
     void AddToSlidingFitCache(const pandora::Cluster *const pCluster);
 
+    /**
+     *  @brief  Prepare a sliding fit result for the larger fragment of a cluster split, by removing the positions of the smaller fragment
+     *          from the sliding fit result for the original cluster. The prepared result is used when the fragment is added to the cache.
+     *
+     *  @param  originalFitResult the sliding fit result for the original cluster
+     *  @param  pLowXCluster address of the low x fragment
+     *  @param  pHighXCluster address of the high x fragment
+     */
+    void PrepareSplitSlidingFitResult(const TwoDSlidingFitResult &originalFitResult, const pandora::Cluster *const pLowXCluster,
+        const pandora::Cluster *const pHighXCluster);
+
     /**
      *  @brief  Remova an existing sliding fit result, for the specified cluster, from the algorithm cache
      *
@@ -115,8 +132,14 @@ protected:
 
     virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
+    typedef LArTwoDSlidingFitCache::TwoDSlidingFitResultPtrMap TwoDSlidingFitResultPtrMap;
+
     unsigned int                m_slidingFitWindow;             ///< The layer window for the sliding linear fits
-    TwoDSlidingFitResultMap     m_slidingFitResultMap;          ///< The sliding fit result map
+    TwoDSlidingFitResultPtrMap  m_slidingFitResultMap;          ///< The sliding fit result map, sharing results with the event-scoped cache
+    bool                        m_shouldUpdateFitsIncrementally;///< Whether to update existing fits upon merges and splits, retaining their axes
+    TwoDSlidingFitResultPtrMap  m_preparedSlidingFitResultMap;  ///< The prepared sliding fit results, for clusters about to be added to the cache
+
+    std::shared_ptr<LArTwoDSlidingFitCache> m_pSlidingFitCache; ///< The event-scoped sliding fit cache, shared by algorithms in this pandora instance
 
     unsigned int                m_minClusterCaloHits;           ///< The min number of hits in base cluster selection method
     float                       m_minClusterLengthSquared;      ///< The min length (squared) in base cluster selection method
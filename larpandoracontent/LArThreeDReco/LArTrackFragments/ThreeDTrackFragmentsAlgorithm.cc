@@ -26,6 +26,8 @@ ThreeDTrackFragmentsAlgorithm::ThreeDTrackFragmentsAlgorithm() :
     m_minMatchedSamplingPointFraction(0.5f),
     m_minMatchedHits(5)
 {
+    // Cluster pairs are rejected unless their hit x spans overlap, so pruning by hit x span never discards a viable combination
+    m_shouldPruneByXOverlap = true;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -124,22 +126,65 @@ void ThreeDTrackFragmentsAlgorithm::PerformMainLoop()
     std::sort(clusterVectorV.begin(), clusterVectorV.end(), LArClusterHelper::SortByNHits);
     std::sort(clusterVectorW.begin(), clusterVectorW.end(), LArClusterHelper::SortByNHits);
 
-    for (const Cluster *const pClusterU : clusterVectorU)
+    if (!m_shouldPruneByXOverlap)
     {
+        for (const Cluster *const pClusterU : clusterVectorU)
+        {
+            for (const Cluster *const pClusterV : clusterVectorV)
+                this->CalculateOverlapResult(pClusterU, pClusterV, NULL);
+        }
+
+        for (const Cluster *const pClusterU : clusterVectorU)
+        {
+            for (const Cluster *const pClusterW : clusterVectorW)
+                this->CalculateOverlapResult(pClusterU, NULL, pClusterW);
+        }
+
         for (const Cluster *const pClusterV : clusterVectorV)
-            this->CalculateOverlapResult(pClusterU, pClusterV, NULL);
+        {
+            for (const Cluster *const pClusterW : clusterVectorW)
+                this->CalculateOverlapResult(NULL, pClusterV, pClusterW);
+        }
+
+        return;
     }
 
-    for (const Cluster *const pClusterU : clusterVectorU)
+    // Cluster pairs without an x overlap are rejected when calculating the overlap result, so need not be considered
+    const float xWindow(this->GetXOverlapPruningWindow());
+    const ClusterXSpanIndex xSpanIndexU(clusterVectorU, xWindow);
+    const ClusterXSpanIndex xSpanIndexV(clusterVectorV, xWindow);
+    const ClusterXSpanIndex xSpanIndexW(clusterVectorW, xWindow);
+
+    ClusterXSpanIndex::IndexVector indices;
+
+    for (unsigned int indexU = 0; indexU < xSpanIndexU.GetNClusters(); ++indexU)
     {
-        for (const Cluster *const pClusterW : clusterVectorW)
-            this->CalculateOverlapResult(pClusterU, NULL, pClusterW);
+        float xMin(0.f), xMax(0.f);
+        xSpanIndexU.GetXSpan(indexU, xMin, xMax);
+        xSpanIndexV.GetOverlappingIndices(xMin, xMax, indices);
+
+        for (const unsigned int indexV : indices)
+            this->CalculateOverlapResult(xSpanIndexU.GetCluster(indexU), xSpanIndexV.GetCluster(indexV), NULL);
     }
 
-    for (const Cluster *const pClusterV : clusterVectorV)
+    for (unsigned int indexU = 0; indexU < xSpanIndexU.GetNClusters(); ++indexU)
     {
-        for (const Cluster *const pClusterW : clusterVectorW)
-            this->CalculateOverlapResult(NULL, pClusterV, pClusterW);
+        float xMin(0.f), xMax(0.f);
+        xSpanIndexU.GetXSpan(indexU, xMin, xMax);
+        xSpanIndexW.GetOverlappingIndices(xMin, xMax, indices);
+
+        for (const unsigned int indexW : indices)
+            this->CalculateOverlapResult(xSpanIndexU.GetCluster(indexU), NULL, xSpanIndexW.GetCluster(indexW));
+    }
+
+    for (unsigned int indexV = 0; indexV < xSpanIndexV.GetNClusters(); ++indexV)
+    {
+        float xMin(0.f), xMax(0.f);
+        xSpanIndexV.GetXSpan(indexV, xMin, xMax);
+        xSpanIndexW.GetOverlappingIndices(xMin, xMax, indices);
+
+        for (const unsigned int indexW : indices)
+            this->CalculateOverlapResult(NULL, xSpanIndexV.GetCluster(indexV), xSpanIndexW.GetCluster(indexW));
     }
 }
 
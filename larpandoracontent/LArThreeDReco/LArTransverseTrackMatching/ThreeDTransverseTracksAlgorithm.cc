@@ -11,6 +11,8 @@
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 
+#include "larpandoracontent/LArPlugins/LArRotationalTransformationPlugin.h"
+
 #include "larpandoracontent/LArThreeDReco/LArTransverseTrackMatching/ThreeDTransverseTracksAlgorithm.h"
 
 using namespace pandora;
@@ -26,7 +28,8 @@ ThreeDTransverseTracksAlgorithm::ThreeDTransverseTracksAlgorithm() :
     m_minSegmentMatchedPoints(3),
     m_minOverallMatchedFraction(0.5f),
     m_minOverallMatchedPoints(10),
-    m_minSamplingPointsPerLayer(0.1f)
+    m_minSamplingPointsPerLayer(0.1f),
+    m_pTransformation(nullptr)
 {
 }
 
@@ -43,6 +46,27 @@ void ThreeDTransverseTracksAlgorithm::CalculateOverlapResult(const Cluster *cons
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode ThreeDTransverseTracksAlgorithm::CalculateIndependentOverlapResult(const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW,
+    TransverseOverlapResult &overlapResult)
+{
+    // Reads only the geometry and the sliding fit cache, which is complete before the main loop begins and is not modified during it
+    const StatusCode statusCode(this->CalculateOverlapResult(pClusterU, pClusterV, pClusterW, overlapResult));
+
+    if ((STATUS_CODE_SUCCESS == statusCode) && !overlapResult.IsInitialized())
+        return STATUS_CODE_NOT_FOUND;
+
+    return statusCode;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool ThreeDTransverseTracksAlgorithm::SupportsParallelMainLoop() const
+{
+    return true;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ThreeDTransverseTracksAlgorithm::CalculateOverlapResult(const Cluster *const pClusterU, const Cluster *const pClusterV, const Cluster *const pClusterW,
     TransverseOverlapResult &overlapResult)
 {
@@ -138,44 +162,43 @@ StatusCode ThreeDTransverseTracksAlgorithm::GetSegmentOverlap(const FitSegment &
 
     const unsigned int nPoints(1 + static_cast<unsigned int>((nPointsU + nPointsV + nPointsW) / 3.f));
 
-    // Chi2 calculations
-    float pseudoChi2Sum(0.f);
-    unsigned int nSamplingPoints(0), nMatchedSamplingPoints(0);
+    FloatVector xList(nPoints + 1, 0.f);
 
     for (unsigned int n = 0; n <= nPoints; ++n)
-    {
-        const float x(minX + (maxX - minX) * static_cast<float>(n) / static_cast<float>(nPoints));
-
-        CartesianVector fitUVector(0.f, 0.f, 0.f), fitVVector(0.f, 0.f, 0.f), fitWVector(0.f, 0.f, 0.f);
-        CartesianVector fitUDirection(0.f, 0.f, 0.f), fitVDirection(0.f, 0.f, 0.f), fitWDirection(0.f, 0.f, 0.f);
-
-        if ((STATUS_CODE_SUCCESS != slidingFitResultU.GetTransverseProjection(x, fitSegmentU, fitUVector, fitUDirection)) ||
-            (STATUS_CODE_SUCCESS != slidingFitResultV.GetTransverseProjection(x, fitSegmentV, fitVVector, fitVDirection)) ||
-            (STATUS_CODE_SUCCESS != slidingFitResultW.GetTransverseProjection(x, fitSegmentW, fitWVector, fitWDirection)))
-        {
-            continue;
-        }
+        xList[n] = minX + (maxX - minX) * static_cast<float>(n) / static_cast<float>(nPoints);
 
-        const float u(fitUVector.GetZ()), v(fitVVector.GetZ()), w(fitWVector.GetZ());
-        const float uv2w(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_V, u, v));
-        const float uw2v(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_W, u, w));
-        const float vw2u(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_V, TPC_VIEW_W, v, w));
+    // Project all sampling points onto the fit in each view in turn, then store the points projected in all views contiguously
+    CartesianPointVector fitUVectors, fitVVectors, fitWVectors, fitUDirections, fitVDirections, fitWDirections;
+    std::vector<bool> isProjectedU, isProjectedV, isProjectedW;
+    slidingFitResultU.GetTransverseProjections(xList, fitSegmentU, fitUVectors, fitUDirections, isProjectedU);
+    slidingFitResultV.GetTransverseProjections(xList, fitSegmentV, fitVVectors, fitVDirections, isProjectedV);
+    slidingFitResultW.GetTransverseProjections(xList, fitSegmentW, fitWVectors, fitWDirections, isProjectedW);
 
-        ++nSamplingPoints;
-        const float deltaU((vw2u - u) * fitUDirection.GetX());
-        const float deltaV((uw2v - v) * fitVDirection.GetX());
-        const float deltaW((uv2w - w) * fitWDirection.GetX());
+    SamplingPoints samplingPoints(nPoints + 1);
 
-        const float pseudoChi2(deltaW * deltaW + deltaV * deltaV + deltaU * deltaU);
-        pseudoChi2Sum += pseudoChi2;
+    for (unsigned int n = 0; n <= nPoints; ++n)
+    {
+        if (!isProjectedU[n] || !isProjectedV[n] || !isProjectedW[n])
+            continue;
 
-        if (pseudoChi2 < m_pseudoChi2Cut)
-            ++nMatchedSamplingPoints;
+        samplingPoints.m_u.push_back(fitUVectors[n].GetZ());
+        samplingPoints.m_v.push_back(fitVVectors[n].GetZ());
+        samplingPoints.m_w.push_back(fitWVectors[n].GetZ());
+        samplingPoints.m_directionXU.push_back(fitUDirections[n].GetX());
+        samplingPoints.m_directionXV.push_back(fitVDirections[n].GetX());
+        samplingPoints.m_directionXW.push_back(fitWDirections[n].GetX());
     }
 
+    const unsigned int nSamplingPoints(samplingPoints.m_u.size());
+
     if (0 == nSamplingPoints)
         return STATUS_CODE_NOT_FOUND;
 
+    // Chi2 calculations
+    float pseudoChi2Sum(0.f);
+    unsigned int nMatchedSamplingPoints(0);
+    this->CalculatePseudoChi2(samplingPoints, pseudoChi2Sum, nMatchedSamplingPoints);
+
     const XOverlap xOverlapObject(fitSegmentU.GetMinX(), fitSegmentU.GetMaxX(), fitSegmentV.GetMinX(),
         fitSegmentV.GetMaxX(), fitSegmentW.GetMinX(), fitSegmentW.GetMaxX(), xOverlap);
 
@@ -185,6 +208,58 @@ StatusCode ThreeDTransverseTracksAlgorithm::GetSegmentOverlap(const FitSegment &
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ThreeDTransverseTracksAlgorithm::CalculatePseudoChi2(const SamplingPoints &samplingPoints, float &pseudoChi2Sum, unsigned int &nMatchedSamplingPoints) const
+{
+    const unsigned int nSamplingPoints(samplingPoints.m_u.size());
+    const float *const pU(samplingPoints.m_u.data()), *const pV(samplingPoints.m_v.data()), *const pW(samplingPoints.m_w.data());
+    const float *const pDirectionXU(samplingPoints.m_directionXU.data());
+    const float *const pDirectionXV(samplingPoints.m_directionXV.data());
+    const float *const pDirectionXW(samplingPoints.m_directionXW.data());
+
+    if (!m_pTransformation)
+    {
+        // Unknown transformation, so fall back to the (virtual) plugin interface for each sampling point
+        for (unsigned int n = 0; n < nSamplingPoints; ++n)
+        {
+            const float uv2w(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_V, pU[n], pV[n]));
+            const float uw2v(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_U, TPC_VIEW_W, pU[n], pW[n]));
+            const float vw2u(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), TPC_VIEW_V, TPC_VIEW_W, pV[n], pW[n]));
+
+            const float deltaU((vw2u - pU[n]) * pDirectionXU[n]);
+            const float deltaV((uw2v - pV[n]) * pDirectionXV[n]);
+            const float deltaW((uv2w - pW[n]) * pDirectionXW[n]);
+
+            const float pseudoChi2(deltaW * deltaW + deltaV * deltaV + deltaU * deltaU);
+            pseudoChi2Sum += pseudoChi2;
+
+            if (pseudoChi2 < m_pseudoChi2Cut)
+                ++nMatchedSamplingPoints;
+        }
+
+        return;
+    }
+
+    // Inlined transformations, identical to those used by the rotational transformation plugin, in a single pass over the sampling points
+    const LArRotationalTransformation transformation(*m_pTransformation);
+
+    for (unsigned int n = 0; n < nSamplingPoints; ++n)
+    {
+        const float uv2w(static_cast<float>(transformation.UVtoW(pU[n], pV[n])));
+        const float uw2v(static_cast<float>(transformation.WUtoV(pW[n], pU[n])));
+        const float vw2u(static_cast<float>(transformation.VWtoU(pV[n], pW[n])));
+
+        const float deltaU((vw2u - pU[n]) * pDirectionXU[n]);
+        const float deltaV((uw2v - pV[n]) * pDirectionXV[n]);
+        const float deltaW((uv2w - pW[n]) * pDirectionXW[n]);
+
+        const float pseudoChi2(deltaW * deltaW + deltaV * deltaV + deltaU * deltaU);
+        pseudoChi2Sum += pseudoChi2;
+        nMatchedSamplingPoints += ((pseudoChi2 < m_pseudoChi2Cut) ? 1 : 0);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ThreeDTransverseTracksAlgorithm::GetBestOverlapResult(const FitSegmentTensor &fitSegmentTensor, TransverseOverlapResult &bestTransverseOverlapResult) const
 {
     if (fitSegmentTensor.empty())
@@ -308,6 +383,26 @@ void ThreeDTransverseTracksAlgorithm::ExamineTensor()
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+ThreeDTransverseTracksAlgorithm::SamplingPoints::SamplingPoints(const unsigned int maxNPoints)
+{
+    m_u.reserve(maxNPoints);
+    m_v.reserve(maxNPoints);
+    m_w.reserve(maxNPoints);
+    m_directionXU.reserve(maxNPoints);
+    m_directionXV.reserve(maxNPoints);
+    m_directionXW.reserve(maxNPoints);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ThreeDTransverseTracksAlgorithm::Initialize()
+{
+    m_pTransformation = LArGeometryHelper::GetRotationalTransformation(this->GetPandora());
+    return ThreeDTracksBaseAlgorithm<TransverseOverlapResult>::Initialize();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ThreeDTransverseTracksAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     AlgorithmToolVector algorithmToolVector;
@@ -18,6 +18,7 @@
 namespace lar_content
 {
 
+class LArRotationalTransformation;
 class TransverseTensorTool;
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -39,6 +40,9 @@ private:
     typedef std::map<unsigned int, FitSegmentMatrix> FitSegmentTensor;
 
     void CalculateOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV, const pandora::Cluster *const pClusterW);
+    pandora::StatusCode CalculateIndependentOverlapResult(const pandora::Cluster *const pClusterU, const pandora::Cluster *const pClusterV,
+        const pandora::Cluster *const pClusterW, TransverseOverlapResult &overlapResult);
+    bool SupportsParallelMainLoop() const;
 
     /**
      *  @brief  Calculate the overlap result for given group of clusters
@@ -81,6 +85,36 @@ private:
         const TwoDSlidingFitResult &slidingFitResultU, const TwoDSlidingFitResult &slidingFitResultV, const TwoDSlidingFitResult &slidingFitResultW,
         TransverseOverlapResult &transverseOverlapResult) const;
 
+    /**
+     *  @brief  SamplingPoints class, holding the fit positions and fit direction x components sampled in each view, in contiguous arrays
+     */
+    class SamplingPoints
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  maxNPoints the maximum number of sampling points
+         */
+        SamplingPoints(const unsigned int maxNPoints);
+
+        pandora::FloatVector    m_u;                ///< The fit positions in the u view
+        pandora::FloatVector    m_v;                ///< The fit positions in the v view
+        pandora::FloatVector    m_w;                ///< The fit positions in the w view
+        pandora::FloatVector    m_directionXU;      ///< The x components of the fit directions in the u view
+        pandora::FloatVector    m_directionXV;      ///< The x components of the fit directions in the v view
+        pandora::FloatVector    m_directionXW;      ///< The x components of the fit directions in the w view
+    };
+
+    /**
+     *  @brief  Calculate the pseudo chi2 sum and number of matched sampling points, in a single pass over the sampled positions
+     *
+     *  @param  samplingPoints the sampling points
+     *  @param  pseudoChi2Sum to receive the pseudo chi2 sum
+     *  @param  nMatchedSamplingPoints to receive the number of matched sampling points
+     */
+    void CalculatePseudoChi2(const SamplingPoints &samplingPoints, float &pseudoChi2Sum, unsigned int &nMatchedSamplingPoints) const;
+
     /**
      *  @brief  Get the best overlap result, by examining the fit segment tensor
      *
@@ -101,6 +135,7 @@ private:
         FitSegmentTensor &fitSegmentSumTensor, TransverseOverlapResultVector &transverseOverlapResultVector) const;
 
     void ExamineTensor();
+    pandora::StatusCode Initialize();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     typedef std::vector<TransverseTensorTool*> TensorToolVector;
@@ -114,6 +149,8 @@ private:
     float                       m_minOverallMatchedFraction;///< The minimum matched sampling fraction to allow particle creation
     unsigned int                m_minOverallMatchedPoints;  ///< The minimum number of matched segment sampling points to allow particle creation
     float                       m_minSamplingPointsPerLayer;///< The minimum number of sampling points per layer to allow particle creation
+
+    const LArRotationalTransformation *m_pTransformation;  ///< The rotational transformation, or nullptr for other transformation plugins
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
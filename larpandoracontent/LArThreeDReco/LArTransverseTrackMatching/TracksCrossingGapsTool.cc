@@ -244,11 +244,11 @@ bool TracksCrossingGapsTool::CheckXPositionInGap(const float xSample, const TwoD
 
         const float zSample(LArGeometryHelper::MergeTwoPositions(this->GetPandora(), hitType2, hitType3, fitPosition2.GetZ(), fitPosition3.GetZ()));
         const CartesianVector samplingPoint(xSample, 0.f, zSample);
-        return LArGeometryHelper::IsInGap(this->GetPandora(), CartesianVector(xSample, 0.f, zSample), hitType1, m_maxGapTolerance);
+        return LArGeometryHelper::IsInGap(this->GetPandora(), m_pDetectorGapIndex.get(), CartesianVector(xSample, 0.f, zSample), hitType1, m_maxGapTolerance);
     }
 
     // ATTN Only safe to return here (for efficiency) because gapIn2 and gapIn3 values aren't used by calling function if we return false
-    gapIn1 = LArGeometryHelper::IsXSamplingPointInGap(this->GetPandora(), xSample, slidingFitResult1, m_sampleStepSize);
+    gapIn1 = LArGeometryHelper::IsXSamplingPointInGap(this->GetPandora(), m_pDetectorGapIndex.get(), xSample, slidingFitResult1, m_sampleStepSize);
 
     if (!gapIn1)
         return false;
@@ -261,10 +261,10 @@ bool TracksCrossingGapsTool::CheckXPositionInGap(const float xSample, const TwoD
         const bool endIn3(this->IsEndOfCluster(xSample, slidingFitResult3));
 
         if (!endIn2)
-            gapIn2 = LArGeometryHelper::IsXSamplingPointInGap(this->GetPandora(), xSample, slidingFitResult2, m_sampleStepSize);
+            gapIn2 = LArGeometryHelper::IsXSamplingPointInGap(this->GetPandora(), m_pDetectorGapIndex.get(), xSample, slidingFitResult2, m_sampleStepSize);
 
         if (!endIn3)
-            gapIn3 = LArGeometryHelper::IsXSamplingPointInGap(this->GetPandora(), xSample, slidingFitResult3, m_sampleStepSize);
+            gapIn3 = LArGeometryHelper::IsXSamplingPointInGap(this->GetPandora(), m_pDetectorGapIndex.get(), xSample, slidingFitResult3, m_sampleStepSize);
 
         return ((gapIn2 && endIn3) || (gapIn3 && endIn2) || (endIn2 && endIn3));
     }
@@ -272,12 +272,12 @@ bool TracksCrossingGapsTool::CheckXPositionInGap(const float xSample, const TwoD
     // Finally, check whether there is a second gap involved
     if (STATUS_CODE_SUCCESS != slidingFitResult2.GetGlobalFitPositionAtX(xSample, fitPosition2))
     {
-        gapIn2 = LArGeometryHelper::IsXSamplingPointInGap(this->GetPandora(), xSample, slidingFitResult2, m_sampleStepSize);
+        gapIn2 = LArGeometryHelper::IsXSamplingPointInGap(this->GetPandora(), m_pDetectorGapIndex.get(), xSample, slidingFitResult2, m_sampleStepSize);
         return (gapIn2 || this->IsEndOfCluster(xSample, slidingFitResult2));
     }
     else
     {
-        gapIn3 = LArGeometryHelper::IsXSamplingPointInGap(this->GetPandora(), xSample, slidingFitResult3, m_sampleStepSize);
+        gapIn3 = LArGeometryHelper::IsXSamplingPointInGap(this->GetPandora(), m_pDetectorGapIndex.get(), xSample, slidingFitResult3, m_sampleStepSize);
         return (gapIn3 || this->IsEndOfCluster(xSample, slidingFitResult3));
     }
 }
@@ -292,6 +292,14 @@ bool TracksCrossingGapsTool::IsEndOfCluster(const float xSample, const TwoDSlidi
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode TracksCrossingGapsTool::Initialize()
+{
+    m_pDetectorGapIndex = LArDetectorGapIndex::GetSharedInstance(this->GetPandora());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TracksCrossingGapsTool::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
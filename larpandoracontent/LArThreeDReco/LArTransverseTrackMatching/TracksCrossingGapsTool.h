@@ -8,6 +8,7 @@
 #ifndef TRACKS_CROSSING_GAPS_TOOL_H
 #define TRACKS_CROSSING_GAPS_TOOL_H 1
 
+#include "larpandoracontent/LArObjects/LArDetectorGapIndex.h"
 #include "larpandoracontent/LArObjects/LArTrackOverlapResult.h"
 #include "larpandoracontent/LArThreeDReco/LArTransverseTrackMatching/ThreeDTransverseTracksAlgorithm.h"
 
@@ -28,6 +29,7 @@ public:
     bool Run(ThreeDTransverseTracksAlgorithm *const pAlgorithm, TensorType &overlapTensor);
 
 private:
+    pandora::StatusCode Initialize();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     /**
@@ -125,6 +127,8 @@ private:
     float           m_maxGapTolerance;                  ///< The max gap tolerance
     float           m_sampleStepSize;                   ///< The sampling step size used in association checks, units cm
     unsigned int    m_maxAngleRatio;                    ///< The max ratio allowed in the angle
+
+    std::shared_ptr<const LArDetectorGapIndex> m_pDetectorGapIndex; ///< The detector gap index, shared within this pandora instance
 };
 
 } // namespace lar_content
@@ -25,12 +25,35 @@ SvmPfoCharacterisationAlgorithm::SvmPfoCharacterisationAlgorithm() :
     m_useThreeDInformation(true),
     m_minProbabilityCut(0.5f),
     m_minCaloHitsCut(5),
+    m_trainingOutputFormat(LArTrainingExampleWriter::TEXT),
     m_filePathEnvironmentVariable("FW_SEARCH_PATH")
 {
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+SvmPfoCharacterisationAlgorithm::~SvmPfoCharacterisationAlgorithm()
+{
+    if (m_trainingSetMode)
+    {
+        const std::string extension((LArTrainingExampleWriter::BINARY == m_trainingOutputFormat) ? ".bin" : ".txt");
+        LArTrainingExampleWriter::Close(m_trainingOutputFile + extension);
+        LArTrainingExampleWriter::Close(m_trainingOutputFile + "noChargeInfo" + extension);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode SvmPfoCharacterisationAlgorithm::Reset()
+{
+    if (m_trainingSetMode)
+        LArTrainingExampleWriter::FlushAll();
+
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 bool SvmPfoCharacterisationAlgorithm::IsClearTrack(const Cluster *const pCluster) const
 {
     if (pCluster->GetNCaloHits() < m_minCaloHitsCut)
@@ -49,7 +72,7 @@ bool SvmPfoCharacterisationAlgorithm::IsClearTrack(const Cluster *const pCluster
         }
         catch (const StatusCodeException &) {}
 
-        LArMvaHelper::ProduceTrainingExample(m_trainingOutputFile, isTrueTrack, featureVector);
+        LArMvaHelper::ProduceTrainingExample(m_trainingOutputFile, m_trainingOutputFormat, isTrueTrack, featureVector);
         return isTrueTrack;
     }
 
@@ -100,9 +123,10 @@ bool SvmPfoCharacterisationAlgorithm::IsClearTrack(const pandora::ParticleFlowOb
         {
             std::string outputFile;
             outputFile.append(m_trainingOutputFile);
-            const std::string end=((wClusterList.empty()) ? "noChargeInfo.txt" : ".txt");
+            const std::string extension((LArTrainingExampleWriter::BINARY == m_trainingOutputFormat) ? ".bin" : ".txt");
+            const std::string end=((wClusterList.empty()) ? "noChargeInfo" + extension : extension);
             outputFile.append(end);
-            LArMvaHelper::ProduceTrainingExample(outputFile, isTrueTrack, featureVector);
+            LArMvaHelper::ProduceTrainingExample(outputFile, m_trainingOutputFormat, isTrueTrack, featureVector);
         }
         return isTrueTrack;
     }// training mode
@@ -177,6 +201,12 @@ StatusCode SvmPfoCharacterisationAlgorithm::ReadSettings(const TiXmlHandle xmlHa
     if (m_trainingSetMode)
     {
         PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadValue(xmlHandle, "TrainingOutputFileName", m_trainingOutputFile));
+
+        bool useBinaryTrainingOutput(false);
+        PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+            "UseBinaryTrainingOutput", useBinaryTrainingOutput));
+
+        m_trainingOutputFormat = (useBinaryTrainingOutput ? LArTrainingExampleWriter::BINARY : LArTrainingExampleWriter::TEXT);
     }
     else
     {
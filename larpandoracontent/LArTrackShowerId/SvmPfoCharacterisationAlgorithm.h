@@ -25,7 +25,13 @@ public:
      */
     SvmPfoCharacterisationAlgorithm();
 
+    /**
+     *  @brief  Destructor, closing any training example files
+     */
+    ~SvmPfoCharacterisationAlgorithm();
+
 protected:
+    pandora::StatusCode Reset();
     virtual bool IsClearTrack(const pandora::ParticleFlowObject *const pPfo) const;
     virtual bool IsClearTrack(const pandora::Cluster *const pCluster) const;
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
@@ -43,6 +49,8 @@ protected:
     float                   m_minProbabilityCut;            ///< The minimum probability to label a cluster as track-like
     unsigned int            m_minCaloHitsCut;               ///< The minimum number of calo hits to qualify as a track
 
+    LArTrainingExampleWriter::Format m_trainingOutputFormat; ///< The training output file format
+
     std::string             m_trainingOutputFile;           ///< The training output file
     std::string             m_filePathEnvironmentVariable;  ///< The environment variable providing a list of paths to svm files
     std::string             m_svmFileName;                  ///< The svm input file
@@ -149,7 +149,7 @@ void TwoDLinearFitFeatureTool::CalculateVariablesSlidingLinearFit(const pandora:
 
             if ((maxZ - minZ) > std::numeric_limits<float>::epsilon())
             {
-                const float gapZ(LArGeometryHelper::CalculateGapDeltaZ(this->GetPandora(), minZ, maxZ, hitType));
+                const float gapZ(LArGeometryHelper::CalculateGapDeltaZ(this->GetPandora(), m_pDetectorGapIndex.get(), minZ, maxZ, hitType));
                 const float correctedGapLength(thisGapLength * (1.f - gapZ / (maxZ - minZ)));
 
                 if (correctedGapLength > maxFitGapLength)
@@ -194,6 +194,14 @@ void TwoDLinearFitFeatureTool::CalculateVariablesSlidingLinearFit(const pandora:
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode TwoDLinearFitFeatureTool::Initialize()
+{
+    m_pDetectorGapIndex = LArDetectorGapIndex::GetSharedInstance(this->GetPandora());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TwoDLinearFitFeatureTool::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
@@ -347,7 +355,7 @@ void ThreeDLinearFitFeatureTool::CalculateVariablesSlidingLinearFit(const pandor
 
             if ((maxZ - minZ) > std::numeric_limits<float>::epsilon())
             {
-                const float gapZ(LArGeometryHelper::CalculateGapDeltaZ(this->GetPandora(), minZ, maxZ, hitType));
+                const float gapZ(LArGeometryHelper::CalculateGapDeltaZ(this->GetPandora(), m_pDetectorGapIndex.get(), minZ, maxZ, hitType));
                 const float correctedGapLength(thisGapLength * (1.f - gapZ / (maxZ - minZ)));
 
                 if (correctedGapLength > maxFitGapLength)
@@ -385,6 +393,14 @@ void ThreeDLinearFitFeatureTool::CalculateVariablesSlidingLinearFit(const pandor
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode ThreeDLinearFitFeatureTool::Initialize()
+{
+    m_pDetectorGapIndex = LArDetectorGapIndex::GetSharedInstance(this->GetPandora());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode ThreeDLinearFitFeatureTool::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
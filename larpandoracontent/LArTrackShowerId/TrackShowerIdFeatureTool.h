@@ -8,6 +8,7 @@
 #ifndef LAR_TRACK_SHOWER_ID_FEATURE_TOOLS_H
 #define LAR_TRACK_SHOWER_ID_FEATURE_TOOLS_H 1
 
+#include "larpandoracontent/LArObjects/LArDetectorGapIndex.h"
 #include "larpandoracontent/LArObjects/LArSupportVectorMachine.h"
 
 namespace lar_content
@@ -63,6 +64,7 @@ public:
     void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm, const pandora::Cluster *const pCluster);
 
 private:
+    pandora::StatusCode Initialize();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     /**
@@ -81,6 +83,8 @@ private:
 
     unsigned int    m_slidingLinearFitWindow;       ///< The sliding linear fit window
     unsigned int    m_slidingLinearFitWindowLarge;  ///< The sliding linear fit window - should be large, providing a simple linear fit
+
+    std::shared_ptr<const LArDetectorGapIndex> m_pDetectorGapIndex; ///< The detector gap index, shared within this pandora instance
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -131,6 +135,7 @@ public:
     void Run(LArMvaHelper::MvaFeatureVector &featureVector, const pandora::Algorithm *const pAlgorithm, const pandora::ParticleFlowObject *const pInputPfo);
 
 private:
+    pandora::StatusCode Initialize();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     /**
@@ -149,6 +154,8 @@ private:
 
     unsigned int    m_slidingLinearFitWindow;       ///< The sliding linear fit window
     unsigned int    m_slidingLinearFitWindowLarge;  ///< The sliding linear fit window - should be large, providing a simple linear fit
+
+    std::shared_ptr<const LArDetectorGapIndex> m_pDetectorGapIndex; ///< The detector gap index, shared within this pandora instance
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -36,6 +36,8 @@ StatusCode ClusterAssociationAlgorithm::Run()
     ClusterAssociationMap clusterAssociationMap;
     this->PopulateClusterAssociationMap(clusterVector, clusterAssociationMap);
 
+    m_validClusters.clear();
+    m_validClusters.insert(clusterVector.begin(), clusterVector.end());
     m_mergeMade = true;
 
     while (m_mergeMade)
@@ -47,8 +49,8 @@ StatusCode ClusterAssociationAlgorithm::Run()
 
             for (const Cluster *const pCluster : clusterVector)
             {
-                // ATTN The clusterVector may end up with dangling pointers; only protected by this check against managed cluster list
-                if (pClusterList->end() == std::find(pClusterList->begin(), pClusterList->end(), pCluster))
+                // ATTN The clusterVector may end up with dangling pointers; only protected by this check against clusters not yet merged away
+                if (!m_validClusters.count(pCluster))
                     continue;
 
                 this->UnambiguousPropagation(pCluster, true,  clusterAssociationMap);
@@ -76,6 +78,7 @@ StatusCode ClusterAssociationAlgorithm::Run()
         }
     }
 
+    m_validClusters.clear();
     return STATUS_CODE_SUCCESS;
 }
 
@@ -169,6 +172,7 @@ void ClusterAssociationAlgorithm::UpdateForUnambiguousMerge(const Cluster *const
     ClusterSet &clusterSetToReplace(isForwardMerge ? iterEnlarge->second.m_forwardAssociations : iterEnlarge->second.m_backwardAssociations);
     clusterSetToReplace = clusterSetToMove;
     clusterAssociationMap.erase(iterDelete);
+    m_validClusters.erase(pClusterToDelete);
 
     for (ClusterAssociationMap::iterator iter = clusterAssociationMap.begin(), iterEnd = clusterAssociationMap.end(); iter != iterEnd; ++iter)
     {
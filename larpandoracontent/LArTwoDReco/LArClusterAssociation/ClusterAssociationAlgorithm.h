@@ -122,9 +122,10 @@ private:
     void NavigateAlongAssociations(const ClusterAssociationMap &clusterAssociationMap, const pandora::Cluster *const pCluster, const bool isForward,
         const pandora::Cluster *&pExtremalCluster, pandora::ClusterSet &clusterSet) const;
 
-    mutable bool m_mergeMade;
+    mutable bool                m_mergeMade;
 
-    bool         m_resolveAmbiguousAssociations;        ///< Whether to resolve ambiguous associations
+    mutable pandora::ClusterSet m_validClusters;                ///< The clean clusters not yet deleted by merges
+    bool                        m_resolveAmbiguousAssociations; ///< Whether to resolve ambiguous associations
 };
 
 } // namespace lar_content
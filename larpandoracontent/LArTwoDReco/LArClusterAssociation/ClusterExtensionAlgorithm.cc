@@ -10,11 +10,20 @@
 
 #include "larpandoracontent/LArTwoDReco/LArClusterAssociation/ClusterExtensionAlgorithm.h"
 
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+
 using namespace pandora;
 
 namespace lar_content
 {
 
+ClusterExtensionAlgorithm::ClusterExtensionAlgorithm() :
+    m_useNeighbourPruning(false)
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void ClusterExtensionAlgorithm::PopulateClusterMergeMap(const ClusterVector &clusterVector, ClusterMergeMap &clusterMergeMap) const
 {
     ClusterAssociationMatrix clusterAssociationMatrix;
@@ -22,4 +31,128 @@ void ClusterExtensionAlgorithm::PopulateClusterMergeMap(const ClusterVector &clu
     this->FillClusterMergeMap(clusterAssociationMatrix, clusterMergeMap);
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterExtensionAlgorithm::GetNearbyPointingClusterPairs(const LArPointingClusterList &pointingClusterList, const float maxVertexSeparation,
+    IndexPairVector &indexPairVector) const
+{
+    IndexKDNode2DList vertexKDNode2DList;
+    float minX(std::numeric_limits<float>::max()), maxX(-std::numeric_limits<float>::max());
+    float minZ(std::numeric_limits<float>::max()), maxZ(-std::numeric_limits<float>::max());
+
+    for (unsigned int index = 0; index < pointingClusterList.size(); ++index)
+    {
+        const LArPointingCluster &pointingCluster(pointingClusterList.at(index));
+
+        for (unsigned int useInner = 0; useInner < 2; ++useInner)
+        {
+            const CartesianVector &position(useInner == 1 ? pointingCluster.GetInnerVertex().GetPosition() : pointingCluster.GetOuterVertex().GetPosition());
+            vertexKDNode2DList.emplace_back(index, position.GetX(), position.GetZ());
+            minX = std::min(minX, position.GetX()); maxX = std::max(maxX, position.GetX());
+            minZ = std::min(minZ, position.GetZ()); maxZ = std::max(maxZ, position.GetZ());
+        }
+    }
+
+    if (vertexKDNode2DList.empty())
+        return;
+
+    IndexKDTree2D kdTree;
+    kdTree.build(vertexKDNode2DList, KDTreeBox(minX, maxX, minZ, maxZ));
+
+    // ATTN Search radius is padded so that rounding cannot exclude a pair that the exact association checks would accept
+    const float searchRadius(maxVertexSeparation * (1.f + 10.f * std::numeric_limits<float>::epsilon()) + std::numeric_limits<float>::epsilon());
+
+    for (unsigned int indexI = 0; indexI < pointingClusterList.size(); ++indexI)
+    {
+        const LArPointingCluster &pointingCluster(pointingClusterList.at(indexI));
+        std::vector<unsigned int> nearbyIndices;
+
+        for (unsigned int useInner = 0; useInner < 2; ++useInner)
+        {
+            const CartesianVector &position(useInner == 1 ? pointingCluster.GetInnerVertex().GetPosition() : pointingCluster.GetOuterVertex().GetPosition());
+
+            IndexKDTree2D::DistanceNodeInfoVector found;
+            kdTree.searchRadius(IndexKDNode2D(indexI, position.GetX(), position.GetZ()), searchRadius, found);
+
+            for (const IndexKDTree2D::DistanceNodeInfoPair &distanceNodeInfo : found)
+            {
+                if (distanceNodeInfo.second->data > indexI)
+                    nearbyIndices.push_back(distanceNodeInfo.second->data);
+            }
+        }
+
+        std::sort(nearbyIndices.begin(), nearbyIndices.end());
+        nearbyIndices.erase(std::unique(nearbyIndices.begin(), nearbyIndices.end()), nearbyIndices.end());
+
+        for (const unsigned int indexJ : nearbyIndices)
+            indexPairVector.emplace_back(indexI, indexJ);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void ClusterExtensionAlgorithm::GetNearbyDaughterClusterPairs(const LArPointingClusterList &parentClusterList, const ClusterVector &daughterClusterVector,
+    const float maxDisplacement, IndexPairVector &indexPairVector) const
+{
+    IndexKDNode2DList hitKDNode2DList;
+    float minX(std::numeric_limits<float>::max()), maxX(-std::numeric_limits<float>::max());
+    float minZ(std::numeric_limits<float>::max()), maxZ(-std::numeric_limits<float>::max());
+
+    for (unsigned int index = 0; index < daughterClusterVector.size(); ++index)
+    {
+        for (const OrderedCaloHitList::value_type &layerEntry : daughterClusterVector.at(index)->GetOrderedCaloHitList())
+        {
+            for (const CaloHit *const pCaloHit : *layerEntry.second)
+            {
+                const CartesianVector &position(pCaloHit->GetPositionVector());
+                hitKDNode2DList.emplace_back(index, position.GetX(), position.GetZ());
+                minX = std::min(minX, position.GetX()); maxX = std::max(maxX, position.GetX());
+                minZ = std::min(minZ, position.GetZ()); maxZ = std::max(maxZ, position.GetZ());
+            }
+        }
+    }
+
+    if (hitKDNode2DList.empty())
+        return;
+
+    IndexKDTree2D kdTree;
+    kdTree.build(hitKDNode2DList, KDTreeBox(minX, maxX, minZ, maxZ));
+
+    // ATTN Search radius is padded so that rounding cannot exclude a pair that the exact association checks would accept
+    const float searchRadius(maxDisplacement * (1.f + 10.f * std::numeric_limits<float>::epsilon()) + std::numeric_limits<float>::epsilon());
+
+    for (unsigned int parentIndex = 0; parentIndex < parentClusterList.size(); ++parentIndex)
+    {
+        const LArPointingCluster &parentCluster(parentClusterList.at(parentIndex));
+        std::vector<unsigned int> nearbyIndices;
+
+        for (unsigned int useInner = 0; useInner < 2; ++useInner)
+        {
+            const CartesianVector &position(useInner == 1 ? parentCluster.GetInnerVertex().GetPosition() : parentCluster.GetOuterVertex().GetPosition());
+
+            IndexKDTree2D::DistanceNodeInfoVector found;
+            kdTree.searchRadius(IndexKDNode2D(parentIndex, position.GetX(), position.GetZ()), searchRadius, found);
+
+            for (const IndexKDTree2D::DistanceNodeInfoPair &distanceNodeInfo : found)
+                nearbyIndices.push_back(distanceNodeInfo.second->data);
+        }
+
+        std::sort(nearbyIndices.begin(), nearbyIndices.end());
+        nearbyIndices.erase(std::unique(nearbyIndices.begin(), nearbyIndices.end()), nearbyIndices.end());
+
+        for (const unsigned int daughterIndex : nearbyIndices)
+            indexPairVector.emplace_back(parentIndex, daughterIndex);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode ClusterExtensionAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
+{
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "UseNeighbourPruning", m_useNeighbourPruning));
+
+    return ClusterMergingAlgorithm::ReadSettings(xmlHandle);
+}
+
 } // namespace lar_content
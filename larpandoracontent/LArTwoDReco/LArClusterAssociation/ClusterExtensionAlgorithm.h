@@ -8,19 +8,36 @@
 #ifndef LAR_CLUSTER_EXTENSION_ALGORITHM_H
 #define LAR_CLUSTER_EXTENSION_ALGORITHM_H 1
 
+#include "larpandoracontent/LArObjects/LArPointingCluster.h"
+
 #include "larpandoracontent/LArTwoDReco/LArClusterAssociation/ClusterMergingAlgorithm.h"
 
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace lar_content
 {
 
+template<typename, unsigned int> class KDTreeLinkerAlgo;
+template<typename, unsigned int> class KDTreeNodeInfoT;
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 /**
  *  @brief  ClusterExtensionAlgorithm class
  */
 class ClusterExtensionAlgorithm : public ClusterMergingAlgorithm
 {
+public:
+    /**
+     *  @brief  Default constructor
+     */
+    ClusterExtensionAlgorithm();
+
 protected:
+    virtual pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+
     void PopulateClusterMergeMap(const pandora::ClusterVector &clusterVector, ClusterMergeMap &clusterMergeMatrix) const;
 
     /**
@@ -112,6 +129,40 @@ protected:
      *  @param  clusterMergeMap the map of cluster merges
      */
     virtual void FillClusterMergeMap(const ClusterAssociationMatrix &clusterAssociationMatrix, ClusterMergeMap &clusterMergeMap) const = 0;
+
+    typedef std::pair<unsigned int, unsigned int> IndexPair;
+    typedef std::vector<IndexPair> IndexPairVector;
+
+    typedef KDTreeLinkerAlgo<unsigned int, 2> IndexKDTree2D;
+    typedef KDTreeNodeInfoT<unsigned int, 2> IndexKDNode2D;
+    typedef std::vector<IndexKDNode2D> IndexKDNode2DList;
+
+    /**
+     *  @brief  Get the pairs of pointing clusters for which a vertex of the first cluster lies within a specified distance of a vertex of the
+     *          second cluster. Pairs are given by position in the pointing cluster list, with the first index less than the second, and are
+     *          ordered as in an exhaustive pairwise loop.
+     *
+     *  @param  pointingClusterList the pointing cluster list
+     *  @param  maxVertexSeparation the maximum separation between the closest vertices of a pair
+     *  @param  indexPairVector to receive the index pairs
+     */
+    void GetNearbyPointingClusterPairs(const LArPointingClusterList &pointingClusterList, const float maxVertexSeparation,
+        IndexPairVector &indexPairVector) const;
+
+    /**
+     *  @brief  Get the pairs of parent pointing clusters and daughter clusters for which a hit of the daughter cluster lies within a specified
+     *          distance of a vertex of the parent cluster. Pairs are given by position in the parent list and daughter vector, and are
+     *          ordered as in an exhaustive pairwise loop.
+     *
+     *  @param  parentClusterList the parent pointing cluster list
+     *  @param  daughterClusterVector the daughter cluster vector
+     *  @param  maxDisplacement the maximum displacement between a parent vertex and the closest daughter hit
+     *  @param  indexPairVector to receive the index pairs
+     */
+    void GetNearbyDaughterClusterPairs(const LArPointingClusterList &parentClusterList, const pandora::ClusterVector &daughterClusterVector,
+        const float maxDisplacement, IndexPairVector &indexPairVector) const;
+
+    bool            m_useNeighbourPruning;      ///< Whether to consider only spatially nearby cluster pairs when filling the association matrix
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -140,7 +140,7 @@ bool CrossGapsAssociationAlgorithm::IsAssociated(const CartesianVector &startPos
         ++nSamplingPoints;
         const CartesianVector samplingPoint(startPosition + startDirection * static_cast<float>(iSample) * m_sampleStepSize);
 
-        if (LArGeometryHelper::IsInGap(this->GetPandora(), samplingPoint, hitType, m_gapTolerance))
+        if (LArGeometryHelper::IsInGap(this->GetPandora(), m_pDetectorGapIndex.get(), samplingPoint, hitType, m_gapTolerance))
         {
             ++nGapSamplingPoints;
             nUnmatchedSampleRun = 0; // ATTN Choose to also reset run when entering gap region
@@ -195,6 +195,14 @@ bool CrossGapsAssociationAlgorithm::IsNearCluster(const CartesianVector &samplin
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode CrossGapsAssociationAlgorithm::Initialize()
+{
+    m_pDetectorGapIndex = LArDetectorGapIndex::GetSharedInstance(this->GetPandora());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode CrossGapsAssociationAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
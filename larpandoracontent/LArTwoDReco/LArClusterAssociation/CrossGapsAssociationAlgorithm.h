@@ -10,6 +10,7 @@
 
 #include "Pandora/Algorithm.h"
 
+#include "larpandoracontent/LArObjects/LArDetectorGapIndex.h"
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
 #include "larpandoracontent/LArTwoDReco/LArClusterAssociation/ClusterAssociationAlgorithm.h"
@@ -65,6 +66,7 @@ private:
      */
     bool IsNearCluster(const pandora::CartesianVector &samplingPoint, const TwoDSlidingFitResult &targetFitResult) const;
 
+    pandora::StatusCode Initialize();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     unsigned int    m_minClusterHits;               ///< The minimum allowed number of hits in a clean cluster
@@ -77,6 +79,8 @@ private:
     unsigned int    m_minMatchedSamplingPoints;     ///< Minimum number of matched sampling points to declare association
     float           m_minMatchedSamplingFraction;   ///< Minimum ratio between matched sampling points and expectation to declare association
     float           m_gapTolerance;                 ///< The tolerance to use when querying whether a sampling point is in a gap, units cm
+
+    std::shared_ptr<const LArDetectorGapIndex> m_pDetectorGapIndex; ///< The detector gap index, shared within this pandora instance
 };
 
 } // namespace lar_content
@@ -115,7 +115,7 @@ void CrossGapsExtensionAlgorithm::BuildPointingClusterList(const bool useInner,
         const LArPointingCluster::Vertex &pointingVertex(useInner ? pointingCluster.GetInnerVertex() : pointingCluster.GetOuterVertex());
         const HitType hitType(LArClusterHelper::GetClusterHitType(pointingCluster.GetCluster()));
 
-        if (LArGeometryHelper::IsInGap(this->GetPandora(), pointingVertex.GetPosition(), hitType, m_maxGapTolerance))
+        if (LArGeometryHelper::IsInGap(this->GetPandora(), m_pDetectorGapIndex.get(), pointingVertex.GetPosition(), hitType, m_maxGapTolerance))
             outputPointingClusterList.push_back(pointingCluster);
     }
 }
@@ -141,7 +141,7 @@ bool CrossGapsExtensionAlgorithm::IsAcrossGap(const float minZ, const float maxZ
     if (maxZ - minZ < std::numeric_limits<float>::epsilon())
         return false;
 
-    const float gapDeltaZ(LArGeometryHelper::CalculateGapDeltaZ(this->GetPandora(), minZ, maxZ, hitType));
+    const float gapDeltaZ(LArGeometryHelper::CalculateGapDeltaZ(this->GetPandora(), m_pDetectorGapIndex.get(), minZ, maxZ, hitType));
 
     if (gapDeltaZ / (maxZ - minZ) < m_minGapFraction)
         return false;
@@ -320,6 +320,14 @@ void CrossGapsExtensionAlgorithm::FillClusterMergeMap(const ClusterAssociationMa
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode CrossGapsExtensionAlgorithm::Initialize()
+{
+    m_pDetectorGapIndex = LArDetectorGapIndex::GetSharedInstance(this->GetPandora());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode CrossGapsExtensionAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
@@ -8,6 +8,7 @@
 #ifndef LAR_CROSS_GAPS_EXTENSION_ALGORITHM_H
 #define LAR_GROSS_GAPS_EXTENSION_ALGORITHM_H 1
 
+#include "larpandoracontent/LArObjects/LArDetectorGapIndex.h"
 #include "larpandoracontent/LArObjects/LArPointingCluster.h"
 
 #include "larpandoracontent/LArTwoDReco/LArClusterAssociation/ClusterExtensionAlgorithm.h"
@@ -68,6 +69,7 @@ private:
      */
     bool IsAcrossGap(const float minZ, const float maxZ, const pandora::HitType hitType) const;
 
+    pandora::StatusCode Initialize();
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
     float   m_minClusterLength;               ///<
@@ -75,6 +77,8 @@ private:
     float   m_maxGapTolerance;                ///<
     float   m_maxTransverseDisplacement;      ///<
     float   m_maxRelativeAngle;               ///<
+
+    std::shared_ptr<const LArDetectorGapIndex> m_pDetectorGapIndex; ///< The detector gap index, shared within this pandora instance
 };
 
 } // namespace lar_content
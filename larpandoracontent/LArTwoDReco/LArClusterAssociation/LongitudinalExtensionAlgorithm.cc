@@ -68,6 +68,18 @@ void LongitudinalExtensionAlgorithm::FillClusterAssociationMatrix(const ClusterV
     }
 
     // Form associations between pairs of pointing clusters
+    if (m_useNeighbourPruning)
+    {
+        // ATTN Pairs whose closest vertices are separated by more than the maximum emission displacement can never be associated
+        IndexPairVector indexPairVector;
+        this->GetNearbyPointingClusterPairs(pointingClusterList, m_emissionMaxLongitudinalDisplacement, indexPairVector);
+
+        for (const IndexPair &indexPair : indexPairVector)
+            this->FillClusterAssociationMatrix(pointingClusterList.at(indexPair.first), pointingClusterList.at(indexPair.second), clusterAssociationMatrix);
+
+        return;
+    }
+
     for (LArPointingClusterList::const_iterator iterI = pointingClusterList.begin(), iterEndI = pointingClusterList.end(); iterI != iterEndI; ++iterI)
     {
         const LArPointingCluster &clusterI = *iterI;
@@ -130,11 +130,12 @@ void TransverseAssociationAlgorithm::GetNearbyClusterMap(const ClusterVector &al
             (void) hitToClusterMap.insert(HitToClusterMap::value_type(pCaloHit, pCluster));
     }
 
-    HitKDTree2D kdTree;
     HitKDNode2DList hitKDNode2DList;
 
     KDTreeBox hitsBoundingRegion2D(fill_and_bound_2d_kd_tree(allCaloHits, hitKDNode2DList));
-    kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
+    m_kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
+
+    HitKDNode2DList found;
 
     for (const Cluster *const pCluster : allClusters)
     {
@@ -145,13 +146,15 @@ void TransverseAssociationAlgorithm::GetNearbyClusterMap(const ClusterVector &al
         {
             KDTreeBox searchRegionHits(build_2d_kd_search_region(pCaloHit, m_searchRegionX, m_searchRegionZ));
 
-            HitKDNode2DList found;
-            kdTree.search(searchRegionHits, found);
+            found.clear();
+            m_kdTree.search(searchRegionHits, found);
 
             for (const auto &hit : found)
                 (void) nearbyClusters[pCluster].insert(hitToClusterMap.at(hit.data));
         }
     }
+
+    m_kdTree.clear();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
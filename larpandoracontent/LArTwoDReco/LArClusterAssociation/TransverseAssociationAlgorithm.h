@@ -12,12 +12,11 @@
 
 #include "larpandoracontent/LArTwoDReco/LArClusterAssociation/ClusterAssociationAlgorithm.h"
 
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+
 namespace lar_content
 {
 
-template<typename, unsigned int> class KDTreeLinkerAlgo;
-template<typename, unsigned int> class KDTreeNodeInfoT;
-
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 /**
@@ -351,6 +350,7 @@ private:
 
     float        m_searchRegionX;                    ///< Search region, applied to x dimension, for look-up from kd-trees
     float        m_searchRegionZ;                    ///< Search region, applied to u/v/w dimension, for look-up from kd-trees
+    mutable HitKDTree2D m_kdTree;                    ///< The kd tree for hit look-up, retaining its node pool between calls
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
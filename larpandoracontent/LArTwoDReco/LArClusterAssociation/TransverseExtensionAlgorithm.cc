@@ -59,6 +59,18 @@ void TransverseExtensionAlgorithm::FillClusterAssociationMatrix(const ClusterVec
     }
 
     // Form associations between clusters
+    if (m_useNeighbourPruning)
+    {
+        // ATTN Daughter clusters with no hit within the maximum longitudinal displacement of a parent vertex can never be associated
+        IndexPairVector indexPairVector;
+        this->GetNearbyDaughterClusterPairs(pointingClusterList, clusterVector, m_maxLongitudinalDisplacement, indexPairVector);
+
+        for (const IndexPair &indexPair : indexPairVector)
+            this->FillClusterAssociationMatrix(pointingClusterList.at(indexPair.first), clusterVector.at(indexPair.second), clusterAssociationMatrix);
+
+        return;
+    }
+
     for (LArPointingClusterList::const_iterator iter1 = pointingClusterList.begin(), iterEnd1 = pointingClusterList.end(); iter1 != iterEnd1; ++iter1)
     {
         const LArPointingCluster &parentCluster = *iter1;
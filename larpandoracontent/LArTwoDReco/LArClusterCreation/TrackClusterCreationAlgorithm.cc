@@ -12,6 +12,8 @@
 
 #include "larpandoracontent/LArTwoDReco/LArClusterCreation/TrackClusterCreationAlgorithm.h"
 
+#include <algorithm>
+
 using namespace pandora;
 
 namespace lar_content
@@ -36,9 +38,14 @@ StatusCode TrackClusterCreationAlgorithm::Run()
     OrderedCaloHitList selectedCaloHitList, rejectedCaloHitList;
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, this->FilterCaloHits(pCaloHitList, selectedCaloHitList, rejectedCaloHitList));
 
+    SortedLayerHitsVector sortedLayerHitsVector;
+
+    for (const OrderedCaloHitList::value_type &layerEntry : selectedCaloHitList)
+        sortedLayerHitsVector.emplace_back(layerEntry.first, *layerEntry.second);
+
     HitAssociationMap forwardHitAssociationMap, backwardHitAssociationMap;
-    this->MakePrimaryAssociations(selectedCaloHitList, forwardHitAssociationMap, backwardHitAssociationMap);
-    this->MakeSecondaryAssociations(selectedCaloHitList, forwardHitAssociationMap, backwardHitAssociationMap);
+    this->MakePrimaryAssociations(sortedLayerHitsVector, forwardHitAssociationMap, backwardHitAssociationMap);
+    this->MakeSecondaryAssociations(sortedLayerHitsVector, forwardHitAssociationMap, backwardHitAssociationMap);
 
     HitJoinMap hitJoinMap;
     HitToClusterMap hitToClusterMap;
@@ -180,28 +187,33 @@ StatusCode TrackClusterCreationAlgorithm::AddFilteredCaloHits(const OrderedCaloH
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void TrackClusterCreationAlgorithm::MakePrimaryAssociations(const OrderedCaloHitList &orderedCaloHitList, HitAssociationMap &forwardHitAssociationMap,
+void TrackClusterCreationAlgorithm::MakePrimaryAssociations(const SortedLayerHitsVector &sortedLayerHitsVector, HitAssociationMap &forwardHitAssociationMap,
     HitAssociationMap &backwardHitAssociationMap) const
 {
-    for (OrderedCaloHitList::const_iterator iterI = orderedCaloHitList.begin(), iterIEnd = orderedCaloHitList.end(); iterI != iterIEnd; ++iterI)
+    std::vector<unsigned int> candidateIndices;
+
+    for (unsigned int layerI = 0, nLayers = sortedLayerHitsVector.size(); layerI < nLayers; ++layerI)
     {
         unsigned int nLayersConsidered(0);
+        const SortedLayerHits &sortedLayerHitsI(sortedLayerHitsVector.at(layerI));
 
-        CaloHitVector caloHitsI(iterI->second->begin(), iterI->second->end());
-        std::sort(caloHitsI.begin(), caloHitsI.end(), LArClusterHelper::SortHitsByPosition);
-
-        for (OrderedCaloHitList::const_iterator iterJ = iterI, iterJEnd = orderedCaloHitList.end(); (nLayersConsidered++ <= m_maxGapLayers + 1) && (iterJ != iterJEnd); ++iterJ)
+        for (unsigned int layerJ = layerI; (nLayersConsidered++ <= m_maxGapLayers + 1) && (layerJ < nLayers); ++layerJ)
         {
-            if (iterJ->first == iterI->first || iterJ->first > iterI->first + m_maxGapLayers + 1)
+            const SortedLayerHits &sortedLayerHitsJ(sortedLayerHitsVector.at(layerJ));
+
+            if (sortedLayerHitsJ.GetPseudoLayer() == sortedLayerHitsI.GetPseudoLayer() ||
+                sortedLayerHitsJ.GetPseudoLayer() > sortedLayerHitsI.GetPseudoLayer() + m_maxGapLayers + 1)
                 continue;
 
-            CaloHitVector caloHitsJ(iterJ->second->begin(), iterJ->second->end());
-            std::sort(caloHitsJ.begin(), caloHitsJ.end(), LArClusterHelper::SortHitsByPosition);
+            const CaloHitVector &caloHitsJ(sortedLayerHitsJ.GetCaloHits());
 
-            for (const CaloHit *const pCaloHitI : caloHitsI)
+            // ATTN Only hits beyond the maximum separation are skipped, and candidates are visited in position order, so associations are unchanged
+            for (const CaloHit *const pCaloHitI : sortedLayerHitsI.GetCaloHits())
             {
-                for (const CaloHit *const pCaloHitJ : caloHitsJ)
-                    this->CreatePrimaryAssociation(pCaloHitI, pCaloHitJ, forwardHitAssociationMap, backwardHitAssociationMap);
+                sortedLayerHitsJ.GetCandidateIndices(pCaloHitI->GetPositionVector(), m_maxCaloHitSeparationSquared, candidateIndices);
+
+                for (const unsigned int indexJ : candidateIndices)
+                    this->CreatePrimaryAssociation(pCaloHitI, caloHitsJ.at(indexJ), forwardHitAssociationMap, backwardHitAssociationMap);
             }
         }
     }
@@ -209,15 +221,12 @@ void TrackClusterCreationAlgorithm::MakePrimaryAssociations(const OrderedCaloHit
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-void TrackClusterCreationAlgorithm::MakeSecondaryAssociations(const OrderedCaloHitList &orderedCaloHitList, HitAssociationMap &forwardHitAssociationMap,
+void TrackClusterCreationAlgorithm::MakeSecondaryAssociations(const SortedLayerHitsVector &sortedLayerHitsVector, HitAssociationMap &forwardHitAssociationMap,
     HitAssociationMap &backwardHitAssociationMap) const
 {
-    for (OrderedCaloHitList::const_iterator iter = orderedCaloHitList.begin(), iterEnd = orderedCaloHitList.end(); iter != iterEnd; ++iter)
+    for (const SortedLayerHits &sortedLayerHits : sortedLayerHitsVector)
     {
-        CaloHitVector caloHits(iter->second->begin(), iter->second->end());
-        std::sort(caloHits.begin(), caloHits.end(), LArClusterHelper::SortHitsByPosition);
-
-        for (const CaloHit *const pCaloHit : caloHits)
+        for (const CaloHit *const pCaloHit : sortedLayerHits.GetCaloHits())
         {
             HitAssociationMap::const_iterator fwdIter = forwardHitAssociationMap.find(pCaloHit);
             const CaloHit *const pForwardHit((forwardHitAssociationMap.end() == fwdIter) ? NULL : fwdIter->second.GetPrimaryTarget());
@@ -435,6 +444,49 @@ const CaloHit *TrackClusterCreationAlgorithm::TraceHitAssociation(const CaloHit
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+TrackClusterCreationAlgorithm::SortedLayerHits::SortedLayerHits(const unsigned int pseudoLayer, const CaloHitList &caloHitList) :
+    m_pseudoLayer(pseudoLayer),
+    m_caloHits(caloHitList.begin(), caloHitList.end())
+{
+    std::sort(m_caloHits.begin(), m_caloHits.end(), LArClusterHelper::SortHitsByPosition);
+
+    for (unsigned int index = 0, nCaloHits = m_caloHits.size(); index < nCaloHits; ++index)
+        m_xCoordinateIndices.emplace_back(m_caloHits.at(index)->GetPositionVector().GetX(), index);
+
+    std::sort(m_xCoordinateIndices.begin(), m_xCoordinateIndices.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void TrackClusterCreationAlgorithm::SortedLayerHits::GetCandidateIndices(const CartesianVector &position, const float maxSeparationSquared,
+    std::vector<unsigned int> &candidateIndices) const
+{
+    candidateIndices.clear();
+    const float x(position.GetX());
+
+    // ATTN Separations are computed as in CartesianVector, so a hit is excluded only if its separation squared must exceed the maximum
+    const auto lowIter(std::partition_point(m_xCoordinateIndices.begin(), m_xCoordinateIndices.end(),
+        [x, maxSeparationSquared](const CoordinateIndexVector::value_type &entry)
+        {
+            const float dx(entry.first - x);
+            return ((dx < 0.f) && (dx * dx > maxSeparationSquared));
+        }));
+
+    const auto highIter(std::partition_point(lowIter, m_xCoordinateIndices.end(),
+        [x, maxSeparationSquared](const CoordinateIndexVector::value_type &entry)
+        {
+            const float dx(entry.first - x);
+            return ((dx <= 0.f) || (dx * dx <= maxSeparationSquared));
+        }));
+
+    for (auto iter = lowIter; iter != highIter; ++iter)
+        candidateIndices.push_back(iter->second);
+
+    std::sort(candidateIndices.begin(), candidateIndices.end());
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TrackClusterCreationAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
@@ -11,6 +11,7 @@
 #include "Pandora/Algorithm.h"
 
 #include <unordered_map>
+#include <vector>
 
 namespace lar_content
 {
@@ -84,6 +85,53 @@ private:
         float                   m_secondaryDistanceSquared;     ///< the secondary distance squared
     };
 
+    /**
+     *  @brief  SortedLayerHits class, holding the hits in a pseudo layer sorted by position, with an index of the hits sorted by x coordinate
+     */
+    class SortedLayerHits
+    {
+    public:
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pseudoLayer the pseudo layer
+         *  @param  caloHitList the calo hits in the pseudo layer
+         */
+        SortedLayerHits(const unsigned int pseudoLayer, const pandora::CaloHitList &caloHitList);
+
+        /**
+         *  @brief  Get the pseudo layer
+         *
+         *  @return the pseudo layer
+         */
+        unsigned int GetPseudoLayer() const;
+
+        /**
+         *  @brief  Get the calo hits, sorted by position
+         *
+         *  @return the calo hits
+         */
+        const pandora::CaloHitVector &GetCaloHits() const;
+
+        /**
+         *  @brief  Get the indices, in position order, of the calo hits that could lie within a maximum separation of a given position.
+         *          Hits are excluded only if their separation in x alone exceeds the maximum separation.
+         *
+         *  @param  position the position
+         *  @param  maxSeparationSquared the maximum separation squared
+         *  @param  candidateIndices to receive the candidate calo hit indices, in ascending order
+         */
+        void GetCandidateIndices(const pandora::CartesianVector &position, const float maxSeparationSquared, std::vector<unsigned int> &candidateIndices) const;
+
+    private:
+        typedef std::vector<std::pair<float, unsigned int> > CoordinateIndexVector;
+
+        unsigned int            m_pseudoLayer;                  ///< the pseudo layer
+        pandora::CaloHitVector  m_caloHits;                     ///< the calo hits, sorted by position
+        CoordinateIndexVector   m_xCoordinateIndices;           ///< the x coordinates and indices of the calo hits, sorted by x coordinate
+    };
+
+    typedef std::vector<SortedLayerHits> SortedLayerHitsVector;
     typedef std::unordered_map<const pandora::CaloHit*, HitAssociation> HitAssociationMap;
     typedef std::unordered_map<const pandora::CaloHit*, const pandora::CaloHit*> HitJoinMap;
     typedef std::unordered_map<const pandora::CaloHit*, const pandora::Cluster*> HitToClusterMap;
@@ -112,21 +160,21 @@ private:
     /**
      *  @brief  Control primary association formation
      *
-     *  @param  orderedCaloHitList the ordered calo hit list
+     *  @param  sortedLayerHitsVector the sorted hits in each pseudo layer, in pseudo layer order
      *  @param  forwardHitAssociationMap the forward hit association map
      *  @param  backwardHitAssociationMap the backward hit association map
      */
-    void MakePrimaryAssociations(const pandora::OrderedCaloHitList &orderedCaloHitList, HitAssociationMap &forwardHitAssociationMap,
+    void MakePrimaryAssociations(const SortedLayerHitsVector &sortedLayerHitsVector, HitAssociationMap &forwardHitAssociationMap,
         HitAssociationMap &backwardHitAssociationMap) const;
 
     /**
      *  @brief  Control secondary association formation
      *
-     *  @param  orderedCaloHitList the ordered calo hit list
+     *  @param  sortedLayerHitsVector the sorted hits in each pseudo layer, in pseudo layer order
      *  @param  forwardHitAssociationMap the forward hit association map
      *  @param  backwardHitAssociationMap the backward hit association map
      */
-    void MakeSecondaryAssociations(const pandora::OrderedCaloHitList &orderedCaloHitList, HitAssociationMap &forwardHitAssociationMap,
+    void MakeSecondaryAssociations(const SortedLayerHitsVector &sortedLayerHitsVector, HitAssociationMap &forwardHitAssociationMap,
         HitAssociationMap &backwardHitAssociationMap) const;
 
     /**
@@ -204,6 +252,20 @@ private:
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+inline unsigned int TrackClusterCreationAlgorithm::SortedLayerHits::GetPseudoLayer() const
+{
+    return m_pseudoLayer;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::CaloHitVector &TrackClusterCreationAlgorithm::SortedLayerHits::GetCaloHits() const
+{
+    return m_caloHits;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 inline TrackClusterCreationAlgorithm::HitAssociation::HitAssociation(const pandora::CaloHit *const pPrimaryTarget, const float primaryDistanceSquared) :
     m_pPrimaryTarget(pPrimaryTarget),
     m_pSecondaryTarget(NULL),
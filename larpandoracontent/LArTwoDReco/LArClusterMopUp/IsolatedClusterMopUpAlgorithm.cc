@@ -88,25 +88,26 @@ void IsolatedClusterMopUpAlgorithm::GetCaloHitToClusterMap(const CaloHitList &ca
             (void) hitToParentClusterMap.insert(CaloHitToClusterMap::value_type(pCaloHit, pCluster));
     }
 
-    HitKDTree2D kdTree;
     HitKDNode2DList hitKDNode2DList;
 
     KDTreeBox hitsBoundingRegion2D(fill_and_bound_2d_kd_tree(allCaloHits, hitKDNode2DList));
-    kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
+    m_kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
+
+    HitKDTree2D::DistanceNodeInfoVector nearestHits;
 
     for (const CaloHit *const pCaloHit : caloHitList)
     {
         if (!PandoraContentApi::IsAvailable(*this, pCaloHit))
             throw StatusCodeException(STATUS_CODE_FAILURE);
 
-        const HitKDNode2D *pResultHit(nullptr);
-        float resultDistance(std::numeric_limits<float>::max());
         const HitKDNode2D targetHit(pCaloHit, pCaloHit->GetPositionVector().GetX(), pCaloHit->GetPositionVector().GetZ());
-        kdTree.findNearestNeighbour(targetHit, pResultHit, resultDistance);
+        m_kdTree.findKNearestNeighbours(targetHit, 1, nearestHits);
 
-        if (pResultHit && (resultDistance < m_maxHitClusterDistance))
-            (void) caloHitToClusterMap.insert(CaloHitToClusterMap::value_type(pCaloHit, hitToParentClusterMap.at(pResultHit->data)));
+        if (!nearestHits.empty() && (nearestHits.front().first < m_maxHitClusterDistance))
+            (void) caloHitToClusterMap.insert(CaloHitToClusterMap::value_type(pCaloHit, hitToParentClusterMap.at(nearestHits.front().second->data)));
     }
+
+    m_kdTree.clear();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -12,14 +12,13 @@
 
 #include "larpandoracontent/LArTwoDReco/LArClusterMopUp/ClusterMopUpBaseAlgorithm.h"
 
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+
 #include <unordered_map>
 
 namespace lar_content
 {
 
-template<typename, unsigned int> class KDTreeLinkerAlgo;
-template<typename, unsigned int> class KDTreeNodeInfoT;
-
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 /**
@@ -64,6 +63,7 @@ private:
     unsigned int    m_maxCaloHitsInCluster;     ///< The maximum number of hits in a cluster to be dissolved
     float           m_maxHitClusterDistance;    ///< The maximum hit to cluster distance for isolated hit merging
     bool            m_addHitsAsIsolated;        ///< Whether to add hits to clusters as "isolated" (don't contribute to spatial properties)
+    mutable HitKDTree2D m_kdTree;               ///< The kd tree for hit look-up, retaining its node pool between calls
 };
 
 } // namespace lar_content
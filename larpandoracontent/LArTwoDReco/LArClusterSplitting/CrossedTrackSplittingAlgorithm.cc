@@ -46,11 +46,12 @@ StatusCode CrossedTrackSplittingAlgorithm::PreparationStep(const ClusterVector &
             (void) hitToClusterMap.insert(HitToClusterMap::value_type(pCaloHit, pCluster));
     }
 
-    HitKDTree2D kdTree;
     HitKDNode2DList hitKDNode2DList;
 
     KDTreeBox hitsBoundingRegion2D(fill_and_bound_2d_kd_tree(allCaloHits, hitKDNode2DList));
-    kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
+    m_kdTree.build(hitKDNode2DList, hitsBoundingRegion2D);
+
+    HitKDNode2DList found;
 
     for (const Cluster *const pCluster : clusterVector)
     {
@@ -61,14 +62,16 @@ StatusCode CrossedTrackSplittingAlgorithm::PreparationStep(const ClusterVector &
         {
             KDTreeBox searchRegionHits(build_2d_kd_search_region(pCaloHit, m_searchRegion1D, m_searchRegion1D));
 
-            HitKDNode2DList found;
-            kdTree.search(searchRegionHits, found);
+            found.clear();
+            m_kdTree.search(searchRegionHits, found);
 
             for (const auto &hit : found)
                 (void) m_nearbyClusters[pCluster].insert(hitToClusterMap.at(hit.data));
         }
     }
 
+    m_kdTree.clear();
+
     return STATUS_CODE_SUCCESS;
 }
 
@@ -77,6 +80,7 @@ StatusCode CrossedTrackSplittingAlgorithm::PreparationStep(const ClusterVector &
 StatusCode CrossedTrackSplittingAlgorithm::TidyUpStep()
 {
     m_nearbyClusters.clear();
+    m_clusterHitIndex.Clear();
 
     return STATUS_CODE_SUCCESS;
 }
@@ -102,15 +106,16 @@ StatusCode CrossedTrackSplittingAlgorithm::FindBestSplitPosition(const TwoDSlidi
     const CartesianVector& minPosition2(slidingFitResult2.GetGlobalMinLayerPosition());
     const CartesianVector& maxPosition2(slidingFitResult2.GetGlobalMaxLayerPosition());
 
-    if (LArClusterHelper::GetClosestDistance(minPosition1, slidingFitResult2.GetCluster()) < 2.f * m_maxClusterSeparation ||
-        LArClusterHelper::GetClosestDistance(maxPosition1, slidingFitResult2.GetCluster()) < 2.f * m_maxClusterSeparation ||
-        LArClusterHelper::GetClosestDistance(minPosition2, slidingFitResult1.GetCluster()) < 2.f * m_maxClusterSeparation ||
-        LArClusterHelper::GetClosestDistance(maxPosition2, slidingFitResult1.GetCluster()) < 2.f * m_maxClusterSeparation)
+    // ATTN Clusters are not revisited once split, so cluster hit index entries remain valid until the tidy up step
+    if (LArClusterHelper::GetClosestDistance(minPosition1, slidingFitResult2.GetCluster(), m_clusterHitIndex) < 2.f * m_maxClusterSeparation ||
+        LArClusterHelper::GetClosestDistance(maxPosition1, slidingFitResult2.GetCluster(), m_clusterHitIndex) < 2.f * m_maxClusterSeparation ||
+        LArClusterHelper::GetClosestDistance(minPosition2, slidingFitResult1.GetCluster(), m_clusterHitIndex) < 2.f * m_maxClusterSeparation ||
+        LArClusterHelper::GetClosestDistance(maxPosition2, slidingFitResult1.GetCluster(), m_clusterHitIndex) < 2.f * m_maxClusterSeparation)
     {
         return STATUS_CODE_NOT_FOUND;
     }
 
-    if (LArClusterHelper::GetClosestDistance(slidingFitResult1.GetCluster(), slidingFitResult2.GetCluster()) > m_maxClusterSeparation)
+    if (LArClusterHelper::GetClosestDistance(slidingFitResult1.GetCluster(), slidingFitResult2.GetCluster(), m_clusterHitIndex) > m_maxClusterSeparation)
         return STATUS_CODE_NOT_FOUND;
 
     CartesianPointVector candidateVector;
@@ -255,7 +260,7 @@ void CrossedTrackSplittingAlgorithm::FindCandidateSplitPositions(const Cluster *
     for (const CaloHit *const pCaloHit : caloHitVector1)
     {
         const CartesianVector position1(pCaloHit->GetPositionVector());
-        const CartesianVector position2(LArClusterHelper::GetClosestPosition(position1, pCluster2));
+        const CartesianVector position2(LArClusterHelper::GetClosestPosition(position1, pCluster2, m_clusterHitIndex));
 
         if ((position1 - position2).GetMagnitudeSquared() < m_maxClusterSeparationSquared)
             candidateVector.push_back((position1 + position2) * 0.5);
@@ -264,7 +269,7 @@ void CrossedTrackSplittingAlgorithm::FindCandidateSplitPositions(const Cluster *
     for (const CaloHit *const pCaloHit : caloHitVector2)
     {
         const CartesianVector position2(pCaloHit->GetPositionVector());
-        const CartesianVector position1(LArClusterHelper::GetClosestPosition(position2, pCluster1));
+        const CartesianVector position1(LArClusterHelper::GetClosestPosition(position2, pCluster1, m_clusterHitIndex));
 
         if ((position2 - position1).GetMagnitudeSquared() < m_maxClusterSeparationSquared)
             candidateVector.push_back((position2 + position1) * 0.5);
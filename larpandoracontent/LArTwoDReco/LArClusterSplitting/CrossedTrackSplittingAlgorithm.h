@@ -10,14 +10,15 @@
 
 #include "Pandora/Algorithm.h"
 
+#include "larpandoracontent/LArObjects/LArClusterHitIndex.h"
+
 #include "larpandoracontent/LArTwoDReco/LArClusterSplitting/TwoDSlidingFitSplittingAndSwitchingAlgorithm.h"
 
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+
 namespace lar_content
 {
 
-template<typename, unsigned int> class KDTreeLinkerAlgo;
-template<typename, unsigned int> class KDTreeNodeInfoT;
-
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 /**
@@ -60,7 +61,9 @@ private:
     float                   m_minCosRelativeAngle;              ///< maximum relative angle between tracks after un-crossing
 
     float                   m_searchRegion1D;                   ///< Search region, applied to each dimension, for look-up from kd-trees
+    HitKDTree2D             m_kdTree;                           ///< The kd tree for hit look-up, retaining its node pool between events
     ClusterToClustersMap    m_nearbyClusters;                   ///< The nearby clusters map
+    mutable LArClusterHitIndex m_clusterHitIndex;               ///< The cluster hit index for closest approach queries, cleared after each pass
 };
 
 } // namespace lar_content
@@ -26,6 +26,22 @@ TwoDSlidingFitSplittingAlgorithm::TwoDSlidingFitSplittingAlgorithm() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode TwoDSlidingFitSplittingAlgorithm::Initialize()
+{
+    m_pSlidingFitCache = LArTwoDSlidingFitCache::GetSharedInstance(this->GetPandora());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode TwoDSlidingFitSplittingAlgorithm::Reset()
+{
+    m_pSlidingFitCache->Clear();
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode TwoDSlidingFitSplittingAlgorithm::DivideCaloHits(const Cluster *const pCluster, CaloHitList &firstHitList, CaloHitList &secondHitList) const
 {
     if (LArClusterHelper::GetLengthSquared(pCluster) < m_minClusterLength * m_minClusterLength)
@@ -35,7 +51,9 @@ StatusCode TwoDSlidingFitSplittingAlgorithm::DivideCaloHits(const Cluster *const
     {
         const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
 
-        const TwoDSlidingFitResult slidingFitResult(pCluster, m_slidingFitHalfWindow, slidingFitPitch);
+        // Clusters left unchanged by earlier splitting passes reuse their cached fits
+        const LArTwoDSlidingFitCache::TwoDSlidingFitResultPtr slidingFitResultPtr(m_pSlidingFitCache->GetSlidingFitResult(pCluster, m_slidingFitHalfWindow, slidingFitPitch));
+        const TwoDSlidingFitResult &slidingFitResult(*slidingFitResultPtr);
         CartesianVector splitPosition(0.f, 0.f, 0.f);
 
         if (STATUS_CODE_SUCCESS == this->FindBestSplitPosition(slidingFitResult, splitPosition))
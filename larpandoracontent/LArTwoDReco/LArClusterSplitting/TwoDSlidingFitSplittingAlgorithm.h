@@ -8,10 +8,13 @@
 #ifndef LAR_TWO_D_SLIDING_FIT_SPLITTING_ALGORITHM_H
 #define LAR_TWO_D_SLIDING_FIT_SPLITTING_ALGORITHM_H 1
 
+#include "larpandoracontent/LArObjects/LArTwoDSlidingFitCache.h"
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
 #include "larpandoracontent/LArTwoDReco/LArClusterSplitting/ClusterSplittingAlgorithm.h"
 
+#include <memory>
+
 namespace lar_content
 {
 
@@ -44,6 +47,8 @@ protected:
     float           m_minClusterLength;       ///<
 
 private:
+    pandora::StatusCode Initialize();
+    pandora::StatusCode Reset();
     pandora::StatusCode DivideCaloHits(const pandora::Cluster *const pCluster, pandora::CaloHitList &firstCaloHitList,
         pandora::CaloHitList &secondCaloHitList) const;
 
@@ -59,6 +64,8 @@ private:
      */
     pandora::StatusCode DivideCaloHits(const TwoDSlidingFitResult &slidingFitResult, const pandora::CartesianVector& splitPosition,
         pandora::CaloHitList &firstCaloHitList, pandora::CaloHitList &secondCaloHitList) const;
+
+    std::shared_ptr<LArTwoDSlidingFitCache> m_pSlidingFitCache; ///< The event-scoped sliding fit cache, shared by algorithms in this pandora instance
 };
 
 } // namespace lar_content
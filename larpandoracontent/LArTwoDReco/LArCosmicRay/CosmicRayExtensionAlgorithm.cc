@@ -64,6 +64,18 @@ void CosmicRayExtensionAlgorithm::FillClusterAssociationMatrix(const ClusterVect
     }
 
     // Form associations between pairs of pointing clusters
+    if (m_useNeighbourPruning)
+    {
+        // ATTN Pairs whose closest vertices are separated by more than the maximum longitudinal displacement can never be associated
+        IndexPairVector indexPairVector;
+        this->GetNearbyPointingClusterPairs(pointingClusterList, m_maxLongitudinalDisplacement, indexPairVector);
+
+        for (const IndexPair &indexPair : indexPairVector)
+            this->FillClusterAssociationMatrix(pointingClusterList.at(indexPair.first), pointingClusterList.at(indexPair.second), clusterAssociationMatrix);
+
+        return;
+    }
+
     for (LArPointingClusterList::const_iterator iterI = pointingClusterList.begin(), iterEndI = pointingClusterList.end(); iterI != iterEndI; ++iterI)
     {
         const LArPointingCluster &clusterI = *iterI;
@@ -10,30 +10,36 @@
 
 #include "KDTreeLinkerToolsT.h"
 
+#include <algorithm>
+#include <utility>
 #include <vector>
 
 namespace lar_content
 {
 
 /**
- *  @brief  Class that implements the KDTree partition of 2D space and a closest point search algorithm
+ *  @brief  Class that implements the KDTree partition of 2D space and a closest point search algorithm. The node pool is retained when the
+ *          tree is cleared, so a single instance can be rebuilt (e.g. once per event) without further memory allocation.
  */
 template <typename DATA, unsigned DIM = 2>
 class KDTreeLinkerAlgo
 {
 public:
+    typedef std::pair<float, const KDTreeNodeInfoT<DATA, DIM> *> DistanceNodeInfoPair;
+    typedef std::vector<DistanceNodeInfoPair> DistanceNodeInfoVector;
+
     /**
      *  @brief  Default constructor
      */
     KDTreeLinkerAlgo();
 
     /**
-     *  @brief  Destructor calls clear
+     *  @brief  Destructor frees the node pool
      */
     ~KDTreeLinkerAlgo();
 
     /**
-     *  @brief  Build the KD tree from the "eltList" in the space define by "region"
+     *  @brief  Build the KD tree from the "eltList" in the space define by "region", replacing any existing tree
      *
      *  @param  eltList
      *  @param  region
@@ -58,6 +64,26 @@ public:
      */
     void findNearestNeighbour(const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeNodeInfoT<DATA, DIM> *&result, float &distance);
 
+    /**
+     *  @brief  Find the k nearest neighbours of a point. The result vector is cleared and then filled with (distance, element) pairs, in
+     *          order of increasing distance; if its capacity is reused between queries, no memory allocation is required per query.
+     *
+     *  @param  point the point
+     *  @param  k the maximum number of neighbours to find
+     *  @param  result to receive the (distance, element) pairs
+     */
+    void findKNearestNeighbours(const KDTreeNodeInfoT<DATA, DIM> &point, const unsigned int k, DistanceNodeInfoVector &result);
+
+    /**
+     *  @brief  Find all elements within a given distance of a point. The (distance, element) pairs are appended to the result vector, in
+     *          no particular order; if its capacity is reused between queries, no memory allocation is required per query.
+     *
+     *  @param  point the point
+     *  @param  radius the search radius
+     *  @param  result to receive the (distance, element) pairs
+     */
+    void searchRadius(const KDTreeNodeInfoT<DATA, DIM> &point, const float radius, DistanceNodeInfoVector &result);
+
     /**
      *  @brief  Whether the tree is empty
      *
@@ -73,7 +99,7 @@ public:
     int size();
 
     /**
-     *  @brief  Clear all allocated structures
+     *  @brief  Clear the tree, retaining the node pool for reuse by the next build
      */
     void clear();
 
@@ -124,6 +150,38 @@ private:
     void recNearestNeighbour(unsigned depth, const KDTreeNodeT<DATA, DIM> *current, const KDTreeNodeInfoT<DATA, DIM> &point,
           const KDTreeNodeT<DATA, DIM> *&best_match, float &best_dist);
 
+    /**
+     *  @brief  Recursive k nearest neighbours search, maintaining a max-heap of the best candidates. Is called by findKNearestNeighbours()
+     *
+     *  @param  current
+     *  @param  point
+     *  @param  k
+     *  @param  heap
+     */
+    void recKNearestNeighbours(const KDTreeNodeT<DATA, DIM> *current, const KDTreeNodeInfoT<DATA, DIM> &point, const unsigned int k,
+          DistanceNodeInfoVector &heap) const;
+
+    /**
+     *  @brief  Recursive radius search. Is called by searchRadius()
+     *
+     *  @param  current
+     *  @param  point
+     *  @param  radius2
+     *  @param  result
+     */
+    void recSearchRadius(const KDTreeNodeT<DATA, DIM> *current, const KDTreeNodeInfoT<DATA, DIM> &point, const float radius2,
+          DistanceNodeInfoVector &result) const;
+
+    /**
+     *  @brief  Squared distance between a point and the closest position within a region
+     *
+     *  @param  point
+     *  @param  region
+     *
+     *  @return dist2
+     */
+    float regionDist2(const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeBoxT<DIM> &region) const;
+
     /**
      *  @brief  Add all elements of an subtree to the closest elements. Used during the recSearch().
      *
@@ -142,13 +200,14 @@ private:
     float dist2(const KDTreeNodeInfoT<DATA, DIM> &a, const KDTreeNodeInfoT<DATA, DIM> &b) const;
 
     /**
-     *  @brief  Frees the KDTree.
+     *  @brief  Frees the KDTree and the node pool.
      */
     void clearTree();
 
     KDTreeNodeT<DATA, DIM>                     *root_;              ///< The KDTree root
-    KDTreeNodeT<DATA, DIM>                     *nodePool_;          ///< Node pool allows us to do just 1 call to new for each tree building
-    int                                         nodePoolSize_;      ///< The node pool size
+    KDTreeNodeT<DATA, DIM>                     *nodePool_;          ///< Node pool allows us to do at most 1 call to new for each tree building
+    int                                         nodePoolCapacity_;  ///< The number of nodes allocated in the node pool
+    int                                         nodePoolSize_;      ///< The node pool size used by the current tree
     int                                         nodePoolPos_;       ///< The node pool position
 
     std::vector<KDTreeNodeInfoT<DATA, DIM> >   *closestNeighbour;   ///< The closest neighbour
@@ -162,6 +221,7 @@ template <typename DATA, unsigned DIM>
 inline KDTreeLinkerAlgo<DATA, DIM>::KDTreeLinkerAlgo() :
     root_(nullptr),
     nodePool_(nullptr),
+    nodePoolCapacity_(0),
     nodePoolSize_(-1),
     nodePoolPos_(-1),
     closestNeighbour(nullptr),
@@ -174,7 +234,7 @@ inline KDTreeLinkerAlgo<DATA, DIM>::KDTreeLinkerAlgo() :
 template <typename DATA, unsigned DIM>
 inline KDTreeLinkerAlgo<DATA, DIM>::~KDTreeLinkerAlgo()
 {
-    this->clear();
+    this->clearTree();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -182,13 +242,22 @@ inline KDTreeLinkerAlgo<DATA, DIM>::~KDTreeLinkerAlgo()
 template <typename DATA, unsigned DIM>
 inline void KDTreeLinkerAlgo<DATA, DIM>::build(std::vector<KDTreeNodeInfoT<DATA, DIM> > &eltList, const KDTreeBoxT<DIM> &region)
 {
+    this->clear();
+
     if (eltList.size())
     {
         initialEltList = &eltList;
         const size_t mysize = initialEltList->size();
 
         nodePoolSize_ = mysize * 2 - 1;
-        nodePool_ = new KDTreeNodeT<DATA, DIM>[nodePoolSize_];
+
+        // Grow the node pool only if the existing allocation is too small
+        if (nodePoolSize_ > nodePoolCapacity_)
+        {
+            delete[] nodePool_;
+            nodePool_ = new KDTreeNodeT<DATA, DIM>[nodePoolSize_];
+            nodePoolCapacity_ = nodePoolSize_;
+        }
 
         // Here we build the KDTree
         root_ = this->recBuild(0, mysize, 0, region);
@@ -414,6 +483,126 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::recNearestNeighbour(unsigned int depth,
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerAlgo<DATA, DIM>::findKNearestNeighbours(const KDTreeNodeInfoT<DATA, DIM> &point, const unsigned int k,
+    DistanceNodeInfoVector &result)
+{
+    result.clear();
+
+    if (!root_ || (0 == k))
+        return;
+
+    this->recKNearestNeighbours(root_, point, k, result);
+
+    // The result is a max-heap ordered by squared distance, so sorting it gives increasing distance
+    std::sort_heap(result.begin(), result.end());
+
+    for (DistanceNodeInfoPair &distanceNodeInfoPair : result)
+        distanceNodeInfoPair.first = std::sqrt(distanceNodeInfoPair.first);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerAlgo<DATA, DIM>::recKNearestNeighbours(const KDTreeNodeT<DATA, DIM> *current, const KDTreeNodeInfoT<DATA, DIM> &point,
+    const unsigned int k, DistanceNodeInfoVector &heap) const
+{
+    if ((current->left == nullptr) && (current->right == nullptr))
+    {
+        // Leaf case. Only leaves are considered, as each node holds a copy of its median element, which is also stored in a leaf
+        const float dist_current = this->dist2(point, current->info);
+
+        if (heap.size() < k)
+        {
+            heap.push_back(DistanceNodeInfoPair(dist_current, &(current->info)));
+            std::push_heap(heap.begin(), heap.end());
+        }
+        else if (dist_current < heap.front().first)
+        {
+            std::pop_heap(heap.begin(), heap.end());
+            heap.back() = DistanceNodeInfoPair(dist_current, &(current->info));
+            std::push_heap(heap.begin(), heap.end());
+        }
+    }
+    else
+    {
+        // Node case. Visit the closer son first, and skip any son whose region cannot contain a better candidate
+        const float left_dist = this->regionDist2(point, current->left->region);
+        const float right_dist = this->regionDist2(point, current->right->region);
+        const bool isLeftFirst(left_dist <= right_dist);
+
+        const KDTreeNodeT<DATA, DIM> *const first = (isLeftFirst ? current->left : current->right);
+        const KDTreeNodeT<DATA, DIM> *const second = (isLeftFirst ? current->right : current->left);
+        const float first_dist = (isLeftFirst ? left_dist : right_dist);
+        const float second_dist = (isLeftFirst ? right_dist : left_dist);
+
+        if ((heap.size() < k) || (first_dist < heap.front().first))
+            this->recKNearestNeighbours(first, point, k, heap);
+
+        if ((heap.size() < k) || (second_dist < heap.front().first))
+            this->recKNearestNeighbours(second, point, k, heap);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerAlgo<DATA, DIM>::searchRadius(const KDTreeNodeInfoT<DATA, DIM> &point, const float radius, DistanceNodeInfoVector &result)
+{
+    if (!root_ || (radius < 0.f))
+        return;
+
+    const typename DistanceNodeInfoVector::size_type firstNewIndex(result.size());
+    this->recSearchRadius(root_, point, radius * radius, result);
+
+    for (typename DistanceNodeInfoVector::size_type index = firstNewIndex; index < result.size(); ++index)
+        result[index].first = std::sqrt(result[index].first);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline void KDTreeLinkerAlgo<DATA, DIM>::recSearchRadius(const KDTreeNodeT<DATA, DIM> *current, const KDTreeNodeInfoT<DATA, DIM> &point,
+    const float radius2, DistanceNodeInfoVector &result) const
+{
+    if ((current->left == nullptr) && (current->right == nullptr))
+    {
+        // Leaf case
+        const float dist_current = this->dist2(point, current->info);
+
+        if (dist_current <= radius2)
+            result.push_back(DistanceNodeInfoPair(dist_current, &(current->info)));
+    }
+    else
+    {
+        // Node case
+        if (this->regionDist2(point, current->left->region) <= radius2)
+            this->recSearchRadius(current->left, point, radius2, result);
+
+        if (this->regionDist2(point, current->right->region) <= radius2)
+            this->recSearchRadius(current->right, point, radius2, result);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename DATA, unsigned DIM>
+inline float KDTreeLinkerAlgo<DATA, DIM>::regionDist2(const KDTreeNodeInfoT<DATA, DIM> &point, const KDTreeBoxT<DIM> &region) const
+{
+    double d = 0.;
+
+    for (unsigned i = 0 ; i < DIM; ++i)
+    {
+        const double diff = (point.dims[i] < region.dimmin[i]) ? (region.dimmin[i] - point.dims[i]) :
+            (point.dims[i] > region.dimmax[i]) ? (point.dims[i] - region.dimmax[i]) : 0.;
+        d += diff * diff;
+    }
+
+    return (float)d;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 template < typename DATA, unsigned DIM >
 inline void KDTreeLinkerAlgo<DATA, DIM>::addSubtree(const KDTreeNodeT<DATA, DIM> *current)
 {
@@ -456,6 +645,7 @@ inline void KDTreeLinkerAlgo<DATA, DIM>::clearTree()
 {
     delete[] nodePool_;
     nodePool_ = nullptr;
+    nodePoolCapacity_ = 0;
     root_ = nullptr;
     nodePoolSize_ = -1;
     nodePoolPos_ = -1;
@@ -482,8 +672,9 @@ inline int KDTreeLinkerAlgo<DATA, DIM>::size()
 template <typename DATA, unsigned DIM>
 inline void KDTreeLinkerAlgo<DATA, DIM>::clear()
 {
-    if (root_)
-        this->clearTree();
+    root_ = nullptr;
+    nodePoolSize_ = -1;
+    nodePoolPos_ = -1;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -515,6 +706,10 @@ inline KDTreeNodeT<DATA, DIM> *KDTreeLinkerAlgo<DATA, DIM>::recBuild(int low, in
         // Leaf case
         KDTreeNodeT<DATA, DIM> *leaf = this->getNextNode();
         leaf->setAttributs(region, (*initialEltList)[low]);
+
+        // Pooled nodes may be reused from a previous tree
+        leaf->left = nullptr;
+        leaf->right = nullptr;
         return leaf;
     }
     else
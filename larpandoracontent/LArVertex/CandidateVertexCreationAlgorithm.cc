@@ -11,8 +11,13 @@
 #include "larpandoracontent/LArHelpers/LArClusterHelper.h"
 #include "larpandoracontent/LArHelpers/LArGeometryHelper.h"
 
+#include "larpandoracontent/LArObjects/LArTwoDSlidingFitCache.h"
+
 #include "larpandoracontent/LArVertex/CandidateVertexCreationAlgorithm.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <utility>
 
 using namespace pandora;
@@ -35,6 +40,7 @@ CandidateVertexCreationAlgorithm::CandidateVertexCreationAlgorithm() :
     m_extrapolationStepSize(0.1f),
     m_maxCrossingSeparationSquared(2.f * 2.f),
     m_minNearbyCrossingDistanceSquared(0.5f * 0.5f),
+    m_useCrossingSearchGrid(false),
     m_reducedCandidates(false),
     m_selectionCutFactorMax(2.f),
     m_nClustersPassingMaxCutsPar(26.f)
@@ -43,6 +49,22 @@ CandidateVertexCreationAlgorithm::CandidateVertexCreationAlgorithm() :
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode CandidateVertexCreationAlgorithm::Initialize()
+{
+    m_pSlidingFitCache = LArTwoDSlidingFitCache::GetSharedInstance(this->GetPandora());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode CandidateVertexCreationAlgorithm::Reset()
+{
+    m_pSlidingFitCache->Clear();
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode CandidateVertexCreationAlgorithm::Run()
 {
     try
@@ -255,6 +277,44 @@ void CandidateVertexCreationAlgorithm::FindCrossingPoints(const ClusterVector &c
         this->GetSpacepoints(pCluster, mapIter->second);
     }
 
+    if (m_useCrossingSearchGrid)
+    {
+        ClusterToSpacepointGridMap clusterToSpacepointGridMap;
+
+        for (const Cluster *const pCluster : clusterVector)
+        {
+            const CartesianPointVector &spacepoints(clusterToSpacepointsMap.at(pCluster));
+            SpacepointGrid &spacepointGrid(clusterToSpacepointGridMap.emplace(pCluster, SpacepointGrid(m_maxCrossingSeparationSquared)).first->second);
+
+            for (unsigned int iSpacepoint = 0; iSpacepoint < spacepoints.size(); ++iSpacepoint)
+                spacepointGrid.AddPosition(spacepoints.at(iSpacepoint), iSpacepoint);
+        }
+
+        SpacepointGrid crossingPointGrid(m_minNearbyCrossingDistanceSquared);
+
+        for (const Cluster *const pCluster1 : clusterVector)
+        {
+            const SpacepointGrid &spacepointGrid1(clusterToSpacepointGridMap.at(pCluster1));
+
+            for (const Cluster *const pCluster2 : clusterVector)
+            {
+                if (pCluster1 == pCluster2)
+                    continue;
+
+                // ATTN Skipped cluster pairs are those for which the exhaustive search could not find a crossing
+                const SpacepointGrid &spacepointGrid2(clusterToSpacepointGridMap.at(pCluster2));
+
+                if (!spacepointGrid1.IsNearby(spacepointGrid2))
+                    continue;
+
+                this->FindCrossingPoints(clusterToSpacepointsMap.at(pCluster1), clusterToSpacepointsMap.at(pCluster2), spacepointGrid2,
+                    crossingPointGrid, crossingPoints);
+            }
+        }
+
+        return;
+    }
+
     for (const Cluster *const pCluster1 : clusterVector)
     {
         for (const Cluster *const pCluster2 : clusterVector)
@@ -341,6 +401,64 @@ void CandidateVertexCreationAlgorithm::FindCrossingPoints(const CartesianPointVe
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void CandidateVertexCreationAlgorithm::FindCrossingPoints(const CartesianPointVector &spacepoints1, const CartesianPointVector &spacepoints2,
+    const SpacepointGrid &spacepointGrid2, SpacepointGrid &crossingPointGrid, CartesianPointVector &crossingPoints) const
+{
+    bool bestCrossingFound(false);
+    float bestSeparationSquared(m_maxCrossingSeparationSquared);
+    unsigned int bestIndex1(0), bestIndex2(0);
+    SpacepointGrid::IndexVector candidateIndices;
+
+    for (unsigned int index1 = 0; index1 < spacepoints1.size(); ++index1)
+    {
+        const CartesianVector &position1(spacepoints1.at(index1));
+        candidateIndices.clear();
+        spacepointGrid2.GetCandidateIndices(position1, candidateIndices);
+
+        for (const unsigned int index2 : candidateIndices)
+        {
+            const float separationSquared((position1 - spacepoints2.at(index2)).GetMagnitudeSquared());
+
+            // ATTN Ties resolved to match the first pair found by the exhaustive search, which iterates over spacepoints1 then spacepoints2
+            if ((separationSquared < bestSeparationSquared) ||
+                (bestCrossingFound && (separationSquared == bestSeparationSquared) && (index1 == bestIndex1) && (index2 < bestIndex2)))
+            {
+                bestCrossingFound = true;
+                bestSeparationSquared = separationSquared;
+                bestIndex1 = index1;
+                bestIndex2 = index2;
+            }
+        }
+    }
+
+    if (bestCrossingFound)
+    {
+        const CartesianVector &bestPosition1(spacepoints1.at(bestIndex1)), &bestPosition2(spacepoints2.at(bestIndex2));
+
+        candidateIndices.clear();
+        crossingPointGrid.GetCandidateIndices(bestPosition1, candidateIndices);
+        crossingPointGrid.GetCandidateIndices(bestPosition2, candidateIndices);
+
+        for (const unsigned int existingIndex : candidateIndices)
+        {
+            const CartesianVector &existingPosition(crossingPoints.at(existingIndex));
+
+            if (((existingPosition - bestPosition1).GetMagnitudeSquared() < m_minNearbyCrossingDistanceSquared) ||
+                ((existingPosition - bestPosition2).GetMagnitudeSquared() < m_minNearbyCrossingDistanceSquared))
+            {
+                return;
+            }
+        }
+
+        crossingPointGrid.AddPosition(bestPosition1, crossingPoints.size());
+        crossingPoints.push_back(bestPosition1);
+        crossingPointGrid.AddPosition(bestPosition2, crossingPoints.size());
+        crossingPoints.push_back(bestPosition2);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void CandidateVertexCreationAlgorithm::CreateCrossingVertices(const CartesianPointVector &crossingPoints1, const CartesianPointVector &crossingPoints2,
     const HitType hitType1, const HitType hitType2, unsigned int &nCrossingCandidates) const
 {
@@ -379,9 +497,9 @@ void CandidateVertexCreationAlgorithm::CreateCrossingVertices(const CartesianPoi
 void CandidateVertexCreationAlgorithm::AddToSlidingFitCache(const Cluster *const pCluster)
 {
     const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
-    const TwoDSlidingFitResult slidingFitResult(pCluster, m_slidingFitWindow, slidingFitPitch);
+    const LArTwoDSlidingFitCache::TwoDSlidingFitResultPtr slidingFitResultPtr(m_pSlidingFitCache->GetSlidingFitResult(pCluster, m_slidingFitWindow, slidingFitPitch));
 
-    if (!m_slidingFitResultMap.insert(TwoDSlidingFitResultMap::value_type(pCluster, slidingFitResult)).second)
+    if (!m_slidingFitResultMap.insert(LArTwoDSlidingFitCache::TwoDSlidingFitResultPtrMap::value_type(pCluster, slidingFitResultPtr)).second)
         throw StatusCodeException(STATUS_CODE_FAILURE);
 }
 
@@ -389,12 +507,12 @@ void CandidateVertexCreationAlgorithm::AddToSlidingFitCache(const Cluster *const
 
 const TwoDSlidingFitResult &CandidateVertexCreationAlgorithm::GetCachedSlidingFitResult(const Cluster *const pCluster) const
 {
-    TwoDSlidingFitResultMap::const_iterator iter = m_slidingFitResultMap.find(pCluster);
+    LArTwoDSlidingFitCache::TwoDSlidingFitResultPtrMap::const_iterator iter = m_slidingFitResultMap.find(pCluster);
 
     if (m_slidingFitResultMap.end() == iter)
         throw StatusCodeException(STATUS_CODE_NOT_FOUND);
 
-    return iter->second;
+    return *iter->second;
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -471,7 +589,94 @@ StatusCode CandidateVertexCreationAlgorithm::ReadSettings(const TiXmlHandle xmlH
         "MinNearbyCrossingDistance", minNearbyCrossingDistance));
     m_minNearbyCrossingDistanceSquared = minNearbyCrossingDistance * minNearbyCrossingDistance;
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "UseCrossingSearchGrid", m_useCrossingSearchGrid));
+
     return STATUS_CODE_SUCCESS;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+CandidateVertexCreationAlgorithm::SpacepointGrid::SpacepointGrid(const float maxSeparationSquared) :
+    m_cellSize((maxSeparationSquared > 0.f) ? std::sqrt(static_cast<double>(maxSeparationSquared)) * (1. + 1.e-5) : 0.),
+    m_minX(std::numeric_limits<double>::max()),
+    m_maxX(-std::numeric_limits<double>::max()),
+    m_minZ(std::numeric_limits<double>::max()),
+    m_maxZ(-std::numeric_limits<double>::max())
+{
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CandidateVertexCreationAlgorithm::SpacepointGrid::AddPosition(const CartesianVector &position, const unsigned int index)
+{
+    m_minX = std::min(m_minX, static_cast<double>(position.GetX()));
+    m_maxX = std::max(m_maxX, static_cast<double>(position.GetX()));
+    m_minZ = std::min(m_minZ, static_cast<double>(position.GetZ()));
+    m_maxZ = std::max(m_maxZ, static_cast<double>(position.GetZ()));
+
+    // ATTN A non-positive max separation admits no neighbours, so there is no need to populate the cells
+    if (m_cellSize > 0.)
+        m_cellMap[SpacepointGrid::GetCellKey(this->GetCellCoordinate(position.GetX()), this->GetCellCoordinate(position.GetZ()))].push_back(index);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void CandidateVertexCreationAlgorithm::SpacepointGrid::GetCandidateIndices(const CartesianVector &position, IndexVector &indices) const
+{
+    if (m_cellMap.empty())
+        return;
+
+    const long long cellX(this->GetCellCoordinate(position.GetX())), cellZ(this->GetCellCoordinate(position.GetZ()));
+
+    for (long long iX = cellX - 1; iX <= cellX + 1; ++iX)
+    {
+        for (long long iZ = cellZ - 1; iZ <= cellZ + 1; ++iZ)
+        {
+            const CellMap::const_iterator iter(m_cellMap.find(SpacepointGrid::GetCellKey(iX, iZ)));
+
+            if (m_cellMap.end() != iter)
+                indices.insert(indices.end(), iter->second.begin(), iter->second.end());
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+bool CandidateVertexCreationAlgorithm::SpacepointGrid::IsNearby(const SpacepointGrid &other) const
+{
+    if (!(m_cellSize > 0.))
+        return false;
+
+    const double gapX(std::max(other.m_minX - m_maxX, m_minX - other.m_maxX));
+    const double gapZ(std::max(other.m_minZ - m_maxZ, m_minZ - other.m_maxZ));
+
+    return ((gapX < m_cellSize) && (gapZ < m_cellSize));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+long long CandidateVertexCreationAlgorithm::SpacepointGrid::GetCellCoordinate(const float coordinate) const
+{
+    // ATTN Clamping merges distant cells, which preserves the candidate superset and keeps cell keys unique
+    const double maxCellCoordinate(1 << 30);
+    const double cellCoordinate(std::floor(static_cast<double>(coordinate) / m_cellSize));
+
+    if (!(cellCoordinate > -maxCellCoordinate))
+        return -static_cast<long long>(maxCellCoordinate);
+
+    if (!(cellCoordinate < maxCellCoordinate))
+        return static_cast<long long>(maxCellCoordinate);
+
+    return static_cast<long long>(cellCoordinate);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+long long CandidateVertexCreationAlgorithm::SpacepointGrid::GetCellKey(const long long cellX, const long long cellZ)
+{
+    return static_cast<long long>((static_cast<unsigned long long>(cellX) << 32) ^ (static_cast<unsigned long long>(cellZ) & 0xffffffffULL));
+}
+
 } // namespace lar_content
@@ -8,10 +8,12 @@
 #ifndef LAR_CANDIDATE_VERTEX_CREATION_ALGORITHM_H
 #define LAR_CANDIDATE_VERTEX_CREATION_ALGORITHM_H 1
 
+#include "larpandoracontent/LArObjects/LArTwoDSlidingFitCache.h"
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
 #include "Pandora/Algorithm.h"
 
+#include <memory>
 #include <unordered_map>
 
 namespace lar_content
@@ -29,6 +31,80 @@ public:
     CandidateVertexCreationAlgorithm();
 
 private:
+    /**
+     *  @brief  SpacepointGrid class, bucketing 2D positions into square cells in the x-z plane for fast proximity queries
+     */
+    class SpacepointGrid
+    {
+    public:
+        typedef std::vector<unsigned int> IndexVector;
+
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  maxSeparationSquared the squared separation below which positions must be reported as candidate neighbours
+         */
+        SpacepointGrid(const float maxSeparationSquared);
+
+        /**
+         *  @brief  Add a position to the grid
+         *
+         *  @param  position the position
+         *  @param  index the index to associate with the position
+         */
+        void AddPosition(const pandora::CartesianVector &position, const unsigned int index);
+
+        /**
+         *  @brief  Get the indices of a superset of the added positions within the max separation of a specified position
+         *
+         *  @param  position the position
+         *  @param  indices to receive the candidate indices
+         */
+        void GetCandidateIndices(const pandora::CartesianVector &position, IndexVector &indices) const;
+
+        /**
+         *  @brief  Whether any position in this grid could lie within the max separation of any position in another grid
+         *
+         *  @param  other the other grid
+         *
+         *  @return boolean
+         */
+        bool IsNearby(const SpacepointGrid &other) const;
+
+    private:
+        typedef std::unordered_map<long long, IndexVector> CellMap;
+
+        /**
+         *  @brief  Get the cell coordinate containing a given position coordinate
+         *
+         *  @param  coordinate the position coordinate
+         *
+         *  @return the cell coordinate
+         */
+        long long GetCellCoordinate(const float coordinate) const;
+
+        /**
+         *  @brief  Get the key for a cell
+         *
+         *  @param  cellX the cell x coordinate
+         *  @param  cellZ the cell z coordinate
+         *
+         *  @return the cell key
+         */
+        static long long GetCellKey(const long long cellX, const long long cellZ);
+
+        double      m_cellSize;     ///< The cell size, padded so that all positions within the max separation lie in adjacent cells
+        CellMap     m_cellMap;      ///< The map from cell key to indices of the positions in the cell
+        double      m_minX;         ///< The min x coordinate of the added positions
+        double      m_maxX;         ///< The max x coordinate of the added positions
+        double      m_minZ;         ///< The min z coordinate of the added positions
+        double      m_maxZ;         ///< The max z coordinate of the added positions
+    };
+
+    typedef std::unordered_map<const pandora::Cluster*, SpacepointGrid> ClusterToSpacepointGridMap;
+
+    pandora::StatusCode Initialize();
+    pandora::StatusCode Reset();
     pandora::StatusCode Run();
 
     /**
@@ -92,6 +168,18 @@ private:
     void FindCrossingPoints(const pandora::CartesianPointVector &spacepoints1, const pandora::CartesianPointVector &spacepoints2,
         pandora::CartesianPointVector &crossingPoints) const;
 
+    /**
+     *  @brief  Identify where (extrapolated) clusters plausibly cross in 2D, using spatial grids to identify nearby spacepoints and crossings
+     *
+     *  @param  spacepoints1 space points for cluster 1
+     *  @param  spacepoints2 space points for cluster 2
+     *  @param  spacepointGrid2 the spacepoint grid for cluster 2
+     *  @param  crossingPointGrid the grid of crossing points identified so far
+     *  @param  crossingPoints to receive the list of plausible 2D crossing points
+     */
+    void FindCrossingPoints(const pandora::CartesianPointVector &spacepoints1, const pandora::CartesianPointVector &spacepoints2,
+        const SpacepointGrid &spacepointGrid2, SpacepointGrid &crossingPointGrid, pandora::CartesianPointVector &crossingPoints) const;
+
     /**
      *  @brief  Attempt to create candidate vertex positions, using 2D crossing points in 2 views
      *
@@ -132,7 +220,8 @@ private:
     bool                    m_replaceCurrentVertexList;         ///< Whether to replace the current vertex list with the output list
 
     unsigned int            m_slidingFitWindow;                 ///< The layer window for the sliding linear fits
-    TwoDSlidingFitResultMap m_slidingFitResultMap;              ///< The sliding fit result map
+    LArTwoDSlidingFitCache::TwoDSlidingFitResultPtrMap m_slidingFitResultMap; ///< The sliding fit result map, sharing results with the event-scoped cache
+    std::shared_ptr<LArTwoDSlidingFitCache> m_pSlidingFitCache; ///< The event-scoped sliding fit cache, shared by algorithms in this pandora instance
 
     unsigned int            m_minClusterCaloHits;               ///< The min number of hits in base cluster selection method
     float                   m_minClusterLengthSquared;          ///< The min length (squared) in base cluster selection method
@@ -148,6 +237,7 @@ private:
     float                   m_extrapolationStepSize;            ///< The extrapolation step size in cm
     float                   m_maxCrossingSeparationSquared;     ///< The separation (squared) between spacepoints below which a crossing can be identified
     float                   m_minNearbyCrossingDistanceSquared; ///< The minimum allowed distance between identified crossing positions
+    bool                    m_useCrossingSearchGrid;            ///< Whether to use spatial grids to accelerate the crossing search
 
     bool                    m_reducedCandidates;                ///< Whether to reduce the number of candidates
     float                   m_selectionCutFactorMax;            ///< Maximum factor to multiply the base cluster selection cuts
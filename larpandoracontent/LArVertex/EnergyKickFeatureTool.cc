@@ -48,6 +48,28 @@ void EnergyKickFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, c
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void EnergyKickFeatureTool::RunBatch(VertexSelectionBaseAlgorithm::VertexFeatureMatrix &featureMatrix, const VertexSelectionBaseAlgorithm *const pAlgorithm,
+    const VertexSelectionBaseAlgorithm::VertexFeatureBatch &vertexFeatureBatch, const VertexSelectionBaseAlgorithm::SlidingFitDataListMap &slidingFitDataListMap,
+    const VertexSelectionBaseAlgorithm::ClusterListMap &, const VertexSelectionBaseAlgorithm::KDTreeMap &,
+    const VertexSelectionBaseAlgorithm::ShowerClusterListMap &, const FloatVector &)
+{
+    if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
+       std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
+
+    vertexFeatureBatch.CalculateFeatures([&](const unsigned int vertexIndex) -> float
+    {
+        float energyKick(0.f);
+
+        energyKick += this->GetEnergyKickForView(vertexFeatureBatch.GetProjectedPosition(vertexIndex, TPC_VIEW_U), slidingFitDataListMap.at(TPC_VIEW_U));
+        energyKick += this->GetEnergyKickForView(vertexFeatureBatch.GetProjectedPosition(vertexIndex, TPC_VIEW_V), slidingFitDataListMap.at(TPC_VIEW_V));
+        energyKick += this->GetEnergyKickForView(vertexFeatureBatch.GetProjectedPosition(vertexIndex, TPC_VIEW_W), slidingFitDataListMap.at(TPC_VIEW_W));
+
+        return energyKick;
+    }, featureMatrix);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 float EnergyKickFeatureTool::GetEnergyKickForView(const CartesianVector &vertexPosition2D,
     const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList) const
 {
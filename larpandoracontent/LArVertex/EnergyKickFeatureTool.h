@@ -16,7 +16,7 @@ namespace lar_content
 /**
  *  @brief  EnergyKickFeatureTool class
  */
-class EnergyKickFeatureTool : public VertexSelectionBaseAlgorithm::VertexFeatureTool
+class EnergyKickFeatureTool : public VertexSelectionBaseAlgorithm::VertexFeatureTool, public VertexSelectionBaseAlgorithm::VertexFeatureBatchTool
 {
 public:
     /**
@@ -37,6 +37,19 @@ public:
         const VertexSelectionBaseAlgorithm::SlidingFitDataListMap &slidingFitDataListMap, const VertexSelectionBaseAlgorithm::ClusterListMap &,
         const VertexSelectionBaseAlgorithm::KDTreeMap &, const VertexSelectionBaseAlgorithm::ShowerClusterListMap &, const float, float &);
 
+    /**
+     *  @brief  Run the tool for all candidate vertices in a batch
+     *
+     *  @param  featureMatrix the feature matrix, to which to append the energy kick features
+     *  @param  pAlgorithm address of the calling algorithm
+     *  @param  vertexFeatureBatch the vertex feature batch
+     *  @param  slidingFitDataListMap map of the sliding fit data lists
+     */
+    void RunBatch(VertexSelectionBaseAlgorithm::VertexFeatureMatrix &featureMatrix, const VertexSelectionBaseAlgorithm *const pAlgorithm,
+        const VertexSelectionBaseAlgorithm::VertexFeatureBatch &vertexFeatureBatch, const VertexSelectionBaseAlgorithm::SlidingFitDataListMap &slidingFitDataListMap,
+        const VertexSelectionBaseAlgorithm::ClusterListMap &, const VertexSelectionBaseAlgorithm::KDTreeMap &, const VertexSelectionBaseAlgorithm::ShowerClusterListMap &,
+        const pandora::FloatVector &);
+
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -46,8 +46,34 @@ void GlobalAsymmetryFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVect
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void GlobalAsymmetryFeatureTool::RunBatch(VertexSelectionBaseAlgorithm::VertexFeatureMatrix &featureMatrix, const VertexSelectionBaseAlgorithm *const pAlgorithm,
+    const VertexSelectionBaseAlgorithm::VertexFeatureBatch &vertexFeatureBatch, const VertexSelectionBaseAlgorithm::SlidingFitDataListMap &slidingFitDataListMap,
+    const VertexSelectionBaseAlgorithm::ClusterListMap &, const VertexSelectionBaseAlgorithm::KDTreeMap &,
+    const VertexSelectionBaseAlgorithm::ShowerClusterListMap &, const FloatVector &)
+{
+    if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
+       std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
+
+    vertexFeatureBatch.CalculateFeatures([&](const unsigned int vertexIndex) -> float
+    {
+        float globalAsymmetry(0.f);
+
+        globalAsymmetry += this->GetGlobalAsymmetryForView(vertexFeatureBatch.GetProjectedPosition(vertexIndex, TPC_VIEW_U), slidingFitDataListMap.at(TPC_VIEW_U),
+            &vertexFeatureBatch, vertexIndex);
+        globalAsymmetry += this->GetGlobalAsymmetryForView(vertexFeatureBatch.GetProjectedPosition(vertexIndex, TPC_VIEW_V), slidingFitDataListMap.at(TPC_VIEW_V),
+            &vertexFeatureBatch, vertexIndex);
+        globalAsymmetry += this->GetGlobalAsymmetryForView(vertexFeatureBatch.GetProjectedPosition(vertexIndex, TPC_VIEW_W), slidingFitDataListMap.at(TPC_VIEW_W),
+            &vertexFeatureBatch, vertexIndex);
+
+        return globalAsymmetry;
+    }, featureMatrix);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 float GlobalAsymmetryFeatureTool::GetGlobalAsymmetryForView(const CartesianVector &vertexPosition2D,
-    const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList) const
+    const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList, const VertexSelectionBaseAlgorithm::VertexFeatureBatch *const pVertexFeatureBatch,
+    const unsigned int vertexIndex) const
 {
     bool useEnergy(true);
     CartesianVector energyWeightedDirectionSum(0.f, 0.f, 0.f), hitWeightedDirectionSum(0.f, 0.f, 0.f);
@@ -65,7 +91,8 @@ float GlobalAsymmetryFeatureTool::GetGlobalAsymmetryForView(const CartesianVecto
         const bool minLayerClosest(vertexToMinLayer.GetMagnitudeSquared() < vertexToMaxLayer.GetMagnitudeSquared());
         const CartesianVector &clusterDirection((minLayerClosest) ? slidingFitData.GetMinLayerDirection() : slidingFitData.GetMaxLayerDirection());
 
-        if ((LArClusterHelper::GetClosestDistance(vertexPosition2D, pCluster) < m_maxAsymmetryDistance))
+        if ((pVertexFeatureBatch ? pVertexFeatureBatch->GetClosestDistance(vertexIndex, pCluster) :
+            LArClusterHelper::GetClosestDistance(vertexPosition2D, pCluster)) < m_maxAsymmetryDistance)
         {
             this->IncrementAsymmetryParameters(pCluster->GetElectromagneticEnergy(), clusterDirection, energyWeightedDirectionSum);
             this->IncrementAsymmetryParameters(static_cast<float>(pCluster->GetNCaloHits()), clusterDirection, hitWeightedDirectionSum);
@@ -77,7 +104,7 @@ float GlobalAsymmetryFeatureTool::GetGlobalAsymmetryForView(const CartesianVecto
     if (localWeightedDirectionSum.GetMagnitudeSquared() < std::numeric_limits<float>::epsilon())
         return 0.f;
 
-    return this->CalculateGlobalAsymmetry(useEnergy, vertexPosition2D, slidingFitDataList, localWeightedDirectionSum);
+    return this->CalculateGlobalAsymmetry(useEnergy, vertexPosition2D, slidingFitDataList, localWeightedDirectionSum, pVertexFeatureBatch);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -100,7 +127,8 @@ void GlobalAsymmetryFeatureTool::IncrementAsymmetryParameters(const float weight
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 float GlobalAsymmetryFeatureTool::CalculateGlobalAsymmetry(const bool useEnergyMetrics, const CartesianVector &vertexPosition2D,
-    const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList, const CartesianVector &localWeightedDirectionSum) const
+    const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList, const CartesianVector &localWeightedDirectionSum,
+    const VertexSelectionBaseAlgorithm::VertexFeatureBatch *const pVertexFeatureBatch) const
 {
     // Project every hit onto local event axis direction and record side of the projected vtx position on which it falls
     float beforeVtxHitEnergy(0.f), afterVtxHitEnergy(0.f);
@@ -113,13 +141,14 @@ float GlobalAsymmetryFeatureTool::CalculateGlobalAsymmetry(const bool useEnergyM
     {
         const Cluster * const pCluster(slidingFitData.GetCluster());
 
-        CaloHitList caloHitList;
-        pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
+        CaloHitVector caloHitVector;
+
+        if (!pVertexFeatureBatch)
+            VertexSelectionBaseAlgorithm::VertexFeatureBatch::SortCaloHits(pCluster, caloHitVector);
 
-        CaloHitVector caloHitVector(caloHitList.begin(), caloHitList.end());
-        std::sort(caloHitVector.begin(), caloHitVector.end(), LArClusterHelper::SortHitsByPosition);
+        const CaloHitVector &sortedCaloHitVector(pVertexFeatureBatch ? pVertexFeatureBatch->GetSortedCaloHits(pCluster) : caloHitVector);
 
-        for (const CaloHit *const pCaloHit : caloHitVector)
+        for (const CaloHit *const pCaloHit : sortedCaloHitVector)
         {
             if (pCaloHit->GetPositionVector().GetDotProduct(localWeightedDirection) < evtProjectedVtxPos)
             {
@@ -16,7 +16,7 @@ namespace lar_content
 /**
  *  @brief  GlobalAsymmetryFeatureTool class
  */
-class GlobalAsymmetryFeatureTool : public VertexSelectionBaseAlgorithm::VertexFeatureTool
+class GlobalAsymmetryFeatureTool : public VertexSelectionBaseAlgorithm::VertexFeatureTool, public VertexSelectionBaseAlgorithm::VertexFeatureBatchTool
 {
 public:
     /**
@@ -37,6 +37,19 @@ public:
         const VertexSelectionBaseAlgorithm::SlidingFitDataListMap &slidingFitDataListMap, const VertexSelectionBaseAlgorithm::ClusterListMap &,
         const VertexSelectionBaseAlgorithm::KDTreeMap &, const VertexSelectionBaseAlgorithm::ShowerClusterListMap &, const float, float &);
 
+    /**
+     *  @brief  Run the tool for all candidate vertices in a batch
+     *
+     *  @param  featureMatrix the feature matrix, to which to append the global asymmetry features
+     *  @param  pAlgorithm address of the calling algorithm
+     *  @param  vertexFeatureBatch the vertex feature batch
+     *  @param  slidingFitDataListMap map of the sliding fit data lists
+     */
+    void RunBatch(VertexSelectionBaseAlgorithm::VertexFeatureMatrix &featureMatrix, const VertexSelectionBaseAlgorithm *const pAlgorithm,
+        const VertexSelectionBaseAlgorithm::VertexFeatureBatch &vertexFeatureBatch, const VertexSelectionBaseAlgorithm::SlidingFitDataListMap &slidingFitDataListMap,
+        const VertexSelectionBaseAlgorithm::ClusterListMap &, const VertexSelectionBaseAlgorithm::KDTreeMap &, const VertexSelectionBaseAlgorithm::ShowerClusterListMap &,
+        const pandora::FloatVector &);
+
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -45,10 +58,13 @@ private:
      *
      *  @param  vertexPosition2D the vertex position projected into this view
      *  @param  slidingFitDataList the list of sliding fit data objects for this view
+     *  @param  pVertexFeatureBatch address of the vertex feature batch from which to take sorted calo hits, if any
+     *  @param  vertexIndex the index of the vertex in the vertex feature batch, if any
      *
      *  @return the global asymmetry feature
      */
-    float GetGlobalAsymmetryForView(const pandora::CartesianVector &vertexPosition2D, const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList) const;
+    float GetGlobalAsymmetryForView(const pandora::CartesianVector &vertexPosition2D, const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList,
+        const VertexSelectionBaseAlgorithm::VertexFeatureBatch *const pVertexFeatureBatch = nullptr, const unsigned int vertexIndex = 0) const;
 
     /**
      *  @brief  Increment the asymmetry parameters
@@ -66,11 +82,13 @@ private:
      *  @param  vertexPosition2D the vertex position in this view
      *  @param  slidingFitDataList the list of sliding fit data objects
      *  @param  localWeightedDirectionSum the local event axis
+     *  @param  pVertexFeatureBatch address of the vertex feature batch from which to take sorted calo hits, if any
      *
      *  @return the global asymmetry feature
      */
     float CalculateGlobalAsymmetry(const bool useEnergyMetrics, const pandora::CartesianVector &vertexPosition2D,
-        const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList, const pandora::CartesianVector &localWeightedDirectionSum) const;
+        const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList, const pandora::CartesianVector &localWeightedDirectionSum,
+        const VertexSelectionBaseAlgorithm::VertexFeatureBatch *const pVertexFeatureBatch = nullptr) const;
 
     float     m_maxAsymmetryDistance;    ///< The max distance between cluster (any hit) and vertex to calculate asymmetry score
 };
@@ -50,8 +50,34 @@ void LocalAsymmetryFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVecto
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void LocalAsymmetryFeatureTool::RunBatch(VertexSelectionBaseAlgorithm::VertexFeatureMatrix &featureMatrix, const VertexSelectionBaseAlgorithm *const pAlgorithm,
+    const VertexSelectionBaseAlgorithm::VertexFeatureBatch &vertexFeatureBatch, const VertexSelectionBaseAlgorithm::SlidingFitDataListMap &slidingFitDataListMap,
+    const VertexSelectionBaseAlgorithm::ClusterListMap &, const VertexSelectionBaseAlgorithm::KDTreeMap &,
+    const VertexSelectionBaseAlgorithm::ShowerClusterListMap &, const FloatVector &)
+{
+    if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
+       std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
+
+    vertexFeatureBatch.CalculateFeatures([&](const unsigned int vertexIndex) -> float
+    {
+        float localAsymmetry(0.f);
+
+        localAsymmetry += this->GetLocalAsymmetryForView(vertexFeatureBatch.GetProjectedPosition(vertexIndex, TPC_VIEW_U), slidingFitDataListMap.at(TPC_VIEW_U),
+            &vertexFeatureBatch, vertexIndex);
+        localAsymmetry += this->GetLocalAsymmetryForView(vertexFeatureBatch.GetProjectedPosition(vertexIndex, TPC_VIEW_V), slidingFitDataListMap.at(TPC_VIEW_V),
+            &vertexFeatureBatch, vertexIndex);
+        localAsymmetry += this->GetLocalAsymmetryForView(vertexFeatureBatch.GetProjectedPosition(vertexIndex, TPC_VIEW_W), slidingFitDataListMap.at(TPC_VIEW_W),
+            &vertexFeatureBatch, vertexIndex);
+
+        return localAsymmetry;
+    }, featureMatrix);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 float LocalAsymmetryFeatureTool::GetLocalAsymmetryForView(const CartesianVector &vertexPosition2D,
-    const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList) const
+    const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList, const VertexSelectionBaseAlgorithm::VertexFeatureBatch *const pVertexFeatureBatch,
+    const unsigned int vertexIndex) const
 {
     bool useEnergy(true), useAsymmetry(true);
     CartesianVector energyWeightedDirectionSum(0.f, 0.f, 0.f), hitWeightedDirectionSum(0.f, 0.f, 0.f);
@@ -70,7 +96,8 @@ float LocalAsymmetryFeatureTool::GetLocalAsymmetryForView(const CartesianVector
         const bool minLayerClosest(vertexToMinLayer.GetMagnitudeSquared() < vertexToMaxLayer.GetMagnitudeSquared());
         const CartesianVector &clusterDirection((minLayerClosest) ? slidingFitData.GetMinLayerDirection() : slidingFitData.GetMaxLayerDirection());
 
-        if (useAsymmetry && (LArClusterHelper::GetClosestDistance(vertexPosition2D, pCluster) < m_maxAsymmetryDistance))
+        if (useAsymmetry && ((pVertexFeatureBatch ? pVertexFeatureBatch->GetClosestDistance(vertexIndex, pCluster) :
+            LArClusterHelper::GetClosestDistance(vertexPosition2D, pCluster)) < m_maxAsymmetryDistance))
         {
             useAsymmetry &= this->IncrementAsymmetryParameters(pCluster->GetElectromagneticEnergy(), clusterDirection, energyWeightedDirectionSum);
             useAsymmetry &= this->IncrementAsymmetryParameters(static_cast<float>(pCluster->GetNCaloHits()), clusterDirection, hitWeightedDirectionSum);
@@ -86,7 +113,7 @@ float LocalAsymmetryFeatureTool::GetLocalAsymmetryForView(const CartesianVector
         return 1.f;
 
     const CartesianVector &localWeightedDirectionSum(useEnergy ? energyWeightedDirectionSum : hitWeightedDirectionSum);
-    return this->CalculateLocalAsymmetry(useEnergy, vertexPosition2D, asymmetryClusters, localWeightedDirectionSum);
+    return this->CalculateLocalAsymmetry(useEnergy, vertexPosition2D, asymmetryClusters, localWeightedDirectionSum, pVertexFeatureBatch);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -118,7 +145,8 @@ bool LocalAsymmetryFeatureTool::IncrementAsymmetryParameters(const float weight,
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 float LocalAsymmetryFeatureTool::CalculateLocalAsymmetry(const bool useEnergyMetrics, const CartesianVector &vertexPosition2D,
-    const ClusterVector &asymmetryClusters, const CartesianVector &localWeightedDirectionSum) const
+    const ClusterVector &asymmetryClusters, const CartesianVector &localWeightedDirectionSum,
+    const VertexSelectionBaseAlgorithm::VertexFeatureBatch *const pVertexFeatureBatch) const
 {
     if (asymmetryClusters.empty() || (asymmetryClusters.size() > m_maxAsymmetryNClusters))
         return 1.f;
@@ -132,13 +160,14 @@ float LocalAsymmetryFeatureTool::CalculateLocalAsymmetry(const bool useEnergyMet
 
     for (const Cluster *const pCluster : asymmetryClusters)
     {
-        CaloHitList caloHitList;
-        pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
+        CaloHitVector caloHitVector;
+
+        if (!pVertexFeatureBatch)
+            VertexSelectionBaseAlgorithm::VertexFeatureBatch::SortCaloHits(pCluster, caloHitVector);
 
-        CaloHitVector caloHitVector(caloHitList.begin(), caloHitList.end());
-        std::sort(caloHitVector.begin(), caloHitVector.end(), LArClusterHelper::SortHitsByPosition);
+        const CaloHitVector &sortedCaloHitVector(pVertexFeatureBatch ? pVertexFeatureBatch->GetSortedCaloHits(pCluster) : caloHitVector);
 
-        for (const CaloHit *const pCaloHit : caloHitVector)
+        for (const CaloHit *const pCaloHit : sortedCaloHitVector)
         {
             if (pCaloHit->GetPositionVector().GetDotProduct(localWeightedDirection) < evtProjectedVtxPos)
             {
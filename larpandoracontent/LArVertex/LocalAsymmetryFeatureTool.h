@@ -16,7 +16,7 @@ namespace lar_content
 /**
  *  @brief  LocalAsymmetryFeatureTool class
  */
-class LocalAsymmetryFeatureTool : public VertexSelectionBaseAlgorithm::VertexFeatureTool
+class LocalAsymmetryFeatureTool : public VertexSelectionBaseAlgorithm::VertexFeatureTool, public VertexSelectionBaseAlgorithm::VertexFeatureBatchTool
 {
 public:
     /**
@@ -37,6 +37,19 @@ public:
         const VertexSelectionBaseAlgorithm::SlidingFitDataListMap &slidingFitDataListMap,const VertexSelectionBaseAlgorithm::ClusterListMap &,
         const VertexSelectionBaseAlgorithm::KDTreeMap &, const VertexSelectionBaseAlgorithm::ShowerClusterListMap &, const float, float &);
 
+    /**
+     *  @brief  Run the tool for all candidate vertices in a batch
+     *
+     *  @param  featureMatrix the feature matrix, to which to append the local asymmetry features
+     *  @param  pAlgorithm address of the calling algorithm
+     *  @param  vertexFeatureBatch the vertex feature batch
+     *  @param  slidingFitDataListMap map of the sliding fit data lists
+     */
+    void RunBatch(VertexSelectionBaseAlgorithm::VertexFeatureMatrix &featureMatrix, const VertexSelectionBaseAlgorithm *const pAlgorithm,
+        const VertexSelectionBaseAlgorithm::VertexFeatureBatch &vertexFeatureBatch, const VertexSelectionBaseAlgorithm::SlidingFitDataListMap &slidingFitDataListMap,
+        const VertexSelectionBaseAlgorithm::ClusterListMap &, const VertexSelectionBaseAlgorithm::KDTreeMap &, const VertexSelectionBaseAlgorithm::ShowerClusterListMap &,
+        const pandora::FloatVector &);
+
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -45,10 +58,13 @@ private:
      *
      *  @param  vertexPosition2D the vertex position projected into this view
      *  @param  slidingFitDataList the list of sliding fit data objects in this view
+     *  @param  pVertexFeatureBatch address of the vertex feature batch from which to take sorted calo hits, if any
+     *  @param  vertexIndex the index of the vertex in the vertex feature batch, if any
      *
      *  @return the local asymmetry feature
      */
-    float GetLocalAsymmetryForView(const pandora::CartesianVector &vertexPosition2D, const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList) const;
+    float GetLocalAsymmetryForView(const pandora::CartesianVector &vertexPosition2D, const VertexSelectionBaseAlgorithm::SlidingFitDataList &slidingFitDataList,
+        const VertexSelectionBaseAlgorithm::VertexFeatureBatch *const pVertexFeatureBatch = nullptr, const unsigned int vertexIndex = 0) const;
 
     /**
      *  @brief  Increment the asymmetry parameters
@@ -69,11 +85,13 @@ private:
      *  @param  vertexPosition2D the vertex position
      *  @param  asymmetryClusters the clusters to use to calculate the asymmetry
      *  @param  localWeightedDirectionSum the local event axis
+     *  @param  pVertexFeatureBatch address of the vertex feature batch from which to take sorted calo hits, if any
      *
      *  @return the local asymmetry feature
      */
     float CalculateLocalAsymmetry(const bool useEnergyMetrics, const pandora::CartesianVector &vertexPosition2D,
-        const pandora::ClusterVector &asymmetryClusters, const pandora::CartesianVector &localWeightedDirectionSum) const;
+        const pandora::ClusterVector &asymmetryClusters, const pandora::CartesianVector &localWeightedDirectionSum,
+        const VertexSelectionBaseAlgorithm::VertexFeatureBatch *const pVertexFeatureBatch = nullptr) const;
 
     float           m_maxAsymmetryDistance;     ///< The max distance between cluster (any hit) and vertex to calculate asymmetry score
     float           m_minAsymmetryCosAngle;     ///< The min opening angle cosine used to determine viability of asymmetry score
@@ -13,6 +13,9 @@
 
 #include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
 
+#include <algorithm>
+#include <cmath>
+
 using namespace pandora;
 
 namespace lar_content
@@ -29,7 +32,10 @@ RPhiFeatureTool::RPhiFeatureTool() :
     m_fastHistogramNPhiBins(200),
     m_fastHistogramPhiMin(-1.1f * M_PI),
     m_fastHistogramPhiMax(+1.1f * M_PI),
-    m_enableFolding(true)
+    m_enableFolding(true),
+    m_useBinnedKernelEstimate(false),
+    m_nKernelBinsPerSigma(10),
+    m_shareKDTreeSearches(false)
 {
 }
 
@@ -43,9 +49,10 @@ void RPhiFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const V
     if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
        std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
 
-    KernelEstimate kernelEstimateU(m_kernelEstimateSigma);
-    KernelEstimate kernelEstimateV(m_kernelEstimateSigma);
-    KernelEstimate kernelEstimateW(m_kernelEstimateSigma);
+    const FloatVector *const pGaussianLookupTable(m_useBinnedKernelEstimate ? &m_gaussianLookupTable : nullptr);
+    KernelEstimate kernelEstimateU(m_kernelEstimateSigma, pGaussianLookupTable, m_nKernelBinsPerSigma);
+    KernelEstimate kernelEstimateV(m_kernelEstimateSigma, pGaussianLookupTable, m_nKernelBinsPerSigma);
+    KernelEstimate kernelEstimateW(m_kernelEstimateSigma, pGaussianLookupTable, m_nKernelBinsPerSigma);
 
     this->FillKernelEstimate(pVertex, TPC_VIEW_U, kdTreeMap.at(TPC_VIEW_U), kernelEstimateU);
     this->FillKernelEstimate(pVertex, TPC_VIEW_V, kdTreeMap.at(TPC_VIEW_V), kernelEstimateV);
@@ -79,6 +86,110 @@ void RPhiFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVector, const V
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void RPhiFeatureTool::RunBatch(VertexSelectionBaseAlgorithm::VertexFeatureMatrix &featureMatrix, const VertexSelectionBaseAlgorithm *const pAlgorithm,
+    const VertexSelectionBaseAlgorithm::VertexFeatureBatch &vertexFeatureBatch, const VertexSelectionBaseAlgorithm::SlidingFitDataListMap &,
+    const VertexSelectionBaseAlgorithm::ClusterListMap &, const VertexSelectionBaseAlgorithm::KDTreeMap &kdTreeMap,
+    const VertexSelectionBaseAlgorithm::ShowerClusterListMap &, const FloatVector &beamDeweightingScores)
+{
+    if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
+       std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
+
+    const unsigned int nVertices(vertexFeatureBatch.GetVertexVector().size());
+
+    if ((featureMatrix.size() != nVertices) || (beamDeweightingScores.size() != nVertices))
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    // ATTN kd tree searches are not thread safe, so are made serially, with nearby vertices sharing a search only if explicitly enabled
+    VertexSelectionBaseAlgorithm::HitKDNode2DListVector foundHitsU, foundHitsV, foundHitsW;
+    UIntVector searchIndicesU, searchIndicesV, searchIndicesW;
+    vertexFeatureBatch.SearchKDTree(TPC_VIEW_U, kdTreeMap.at(TPC_VIEW_U), m_maxHitVertexDisplacement1D, m_shareKDTreeSearches, foundHitsU,
+        searchIndicesU);
+    vertexFeatureBatch.SearchKDTree(TPC_VIEW_V, kdTreeMap.at(TPC_VIEW_V), m_maxHitVertexDisplacement1D, m_shareKDTreeSearches, foundHitsV,
+        searchIndicesV);
+    vertexFeatureBatch.SearchKDTree(TPC_VIEW_W, kdTreeMap.at(TPC_VIEW_W), m_maxHitVertexDisplacement1D, m_shareKDTreeSearches, foundHitsW,
+        searchIndicesW);
+
+    const FloatVector *const pGaussianLookupTable(m_useBinnedKernelEstimate ? &m_gaussianLookupTable : nullptr);
+    const KernelEstimate emptyKernelEstimate(m_kernelEstimateSigma, pGaussianLookupTable, m_nKernelBinsPerSigma);
+    std::vector<KernelEstimate> kernelEstimatesU(nVertices, emptyKernelEstimate);
+    std::vector<KernelEstimate> kernelEstimatesV(nVertices, emptyKernelEstimate);
+    std::vector<KernelEstimate> kernelEstimatesW(nVertices, emptyKernelEstimate);
+
+    const bool useFastScore(m_fastScoreCheck || m_fastScoreOnly);
+    FloatVector fastScores(nVertices, 0.f);
+
+    // Each task fills the kernel estimates and fast score for its own vertex
+    auto calculateFastScore = [&](const unsigned int vertexIndex) -> StatusCode
+    {
+        this->FillKernelEstimate(vertexFeatureBatch.GetProjectedPosition(vertexIndex, TPC_VIEW_U), foundHitsU.at(searchIndicesU.at(vertexIndex)),
+            kernelEstimatesU.at(vertexIndex));
+        this->FillKernelEstimate(vertexFeatureBatch.GetProjectedPosition(vertexIndex, TPC_VIEW_V), foundHitsV.at(searchIndicesV.at(vertexIndex)),
+            kernelEstimatesV.at(vertexIndex));
+        this->FillKernelEstimate(vertexFeatureBatch.GetProjectedPosition(vertexIndex, TPC_VIEW_W), foundHitsW.at(searchIndicesW.at(vertexIndex)),
+            kernelEstimatesW.at(vertexIndex));
+
+        if (useFastScore)
+            fastScores.at(vertexIndex) = this->GetFastScore(kernelEstimatesU.at(vertexIndex), kernelEstimatesV.at(vertexIndex), kernelEstimatesW.at(vertexIndex));
+
+        return STATUS_CODE_SUCCESS;
+    };
+
+    const unsigned int nThreads(vertexFeatureBatch.GetNThreads());
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArMultiThreadingHelper::RunTasks(nVertices, LArMultiThreadingHelper::GetNThreads(nThreads, nVertices),
+        calculateFastScore));
+
+    // The fast score check depends on the best fast score so far, so is applied in vertex order
+    float bestFastScore(-std::numeric_limits<float>::max());
+    FloatVector rPhiFeatures(nVertices, 0.f);
+    UIntVector scoredVertexIndices;
+
+    for (unsigned int vertexIndex = 0; vertexIndex < nVertices; ++vertexIndex)
+    {
+        if (useFastScore)
+        {
+            const float fastScore(fastScores.at(vertexIndex));
+
+            if (m_fastScoreOnly)
+            {
+                rPhiFeatures.at(vertexIndex) = fastScore;
+                continue;
+            }
+
+            const float expBeamDeweightingScore = std::exp(beamDeweightingScores.at(vertexIndex));
+
+            if (expBeamDeweightingScore * fastScore < m_minFastScoreFraction * bestFastScore)
+                continue;
+
+            if (expBeamDeweightingScore * fastScore > bestFastScore)
+                bestFastScore = expBeamDeweightingScore * fastScore;
+        }
+
+        scoredVertexIndices.push_back(vertexIndex);
+    }
+
+    auto calculateScore = [&](const unsigned int scoredIndex) -> StatusCode
+    {
+        const unsigned int vertexIndex(scoredVertexIndices.at(scoredIndex));
+        const KernelEstimate &kernelEstimateU(kernelEstimatesU.at(vertexIndex));
+        const KernelEstimate &kernelEstimateV(kernelEstimatesV.at(vertexIndex));
+        const KernelEstimate &kernelEstimateW(kernelEstimatesW.at(vertexIndex));
+
+        rPhiFeatures.at(vertexIndex) = m_fullScore ? this->GetFullScore(kernelEstimateU, kernelEstimateV, kernelEstimateW) :
+            this->GetMidwayScore(kernelEstimateU, kernelEstimateV, kernelEstimateW);
+
+        return STATUS_CODE_SUCCESS;
+    };
+
+    const unsigned int nScoredVertices(scoredVertexIndices.size());
+    PANDORA_THROW_RESULT_IF(STATUS_CODE_SUCCESS, !=, LArMultiThreadingHelper::RunTasks(nScoredVertices,
+        LArMultiThreadingHelper::GetNThreads(nThreads, nScoredVertices), calculateScore));
+
+    for (unsigned int vertexIndex = 0; vertexIndex < nVertices; ++vertexIndex)
+        featureMatrix.at(vertexIndex).push_back(rPhiFeatures.at(vertexIndex));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 float RPhiFeatureTool::GetFastScore(const KernelEstimate &kernelEstimateU, const KernelEstimate &kernelEstimateV,
     const KernelEstimate &kernelEstimateW) const
 {
@@ -175,8 +286,24 @@ void RPhiFeatureTool::FillKernelEstimate(const Vertex *const pVertex, const HitT
     VertexSelectionBaseAlgorithm::HitKDNode2DList found;
     kdTree.search(searchRegionHits, found);
 
+    this->FillKernelEstimate(vertexPosition2D, found, kernelEstimate);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void RPhiFeatureTool::FillKernelEstimate(const CartesianVector &vertexPosition2D, const VertexSelectionBaseAlgorithm::HitKDNode2DList &found,
+    KernelEstimate &kernelEstimate) const
+{
+    const KDTreeBox searchRegionHits(build_2d_kd_search_region(vertexPosition2D, m_maxHitVertexDisplacement1D, m_maxHitVertexDisplacement1D));
+
     for (const auto &hit : found)
     {
+        if ((hit.dims[0] < searchRegionHits.dimmin[0]) || (hit.dims[0] > searchRegionHits.dimmax[0]) ||
+            (hit.dims[1] < searchRegionHits.dimmin[1]) || (hit.dims[1] > searchRegionHits.dimmax[1]))
+        {
+            continue;
+        }
+
         const CartesianVector displacement(hit.data->GetPositionVector() - vertexPosition2D);
         const float magnitude(displacement.GetMagnitude());
 
@@ -194,6 +321,26 @@ void RPhiFeatureTool::FillKernelEstimate(const Vertex *const pVertex, const HitT
 
         kernelEstimate.AddContribution(phi, weight);
     }
+
+    kernelEstimate.Finalise();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void RPhiFeatureTool::FillGaussianLookupTable()
+{
+    m_gaussianLookupTable.clear();
+
+    if (m_kernelEstimateSigma < std::numeric_limits<float>::epsilon())
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    const float gaussConstant(1.f / std::sqrt(2.f * M_PI * m_kernelEstimateSigma * m_kernelEstimateSigma));
+
+    for (unsigned int iBin = 0; iBin <= 3 * m_nKernelBinsPerSigma; ++iBin)
+    {
+        const float deltaSigma(static_cast<float>(iBin) / static_cast<float>(m_nKernelBinsPerSigma));
+        m_gaussianLookupTable.push_back(gaussConstant * std::exp(-0.5f * deltaSigma * deltaSigma));
+    }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -217,9 +364,17 @@ float RPhiFeatureTool::atan2Fast(const float y, const float x) const
 
 float RPhiFeatureTool::KernelEstimate::Sample(const float x) const
 {
+    if (!m_isFinalised)
+        throw StatusCodeException(STATUS_CODE_NOT_INITIALIZED);
+
+    if (m_pGaussianLookupTable)
+        return this->SampleBinned(x);
+
     const ContributionList &contributionList(this->GetContributionList());
-    ContributionList::const_iterator lowerIter(contributionList.lower_bound(x - 3.f * m_sigma));
-    ContributionList::const_iterator upperIter(contributionList.upper_bound(x + 3.f * m_sigma));
+    ContributionList::const_iterator lowerIter(std::lower_bound(contributionList.begin(), contributionList.end(), x - 3.f * m_sigma,
+        [](const ContributionList::value_type &contribution, const float value) {return (contribution.first < value);}));
+    ContributionList::const_iterator upperIter(std::upper_bound(lowerIter, contributionList.end(), x + 3.f * m_sigma,
+        [](const float value, const ContributionList::value_type &contribution) {return (value < contribution.first);}));
 
     float sample(0.f);
     const float gaussConstant(1.f / std::sqrt(2.f * M_PI * m_sigma * m_sigma));
@@ -238,7 +393,79 @@ float RPhiFeatureTool::KernelEstimate::Sample(const float x) const
 
 void RPhiFeatureTool::KernelEstimate::AddContribution(const float x, const float weight)
 {
-    m_contributionList.insert(ContributionList::value_type(x, weight));
+    if (m_isFinalised)
+        throw StatusCodeException(STATUS_CODE_NOT_ALLOWED);
+
+    m_contributionList.push_back(ContributionList::value_type(x, weight));
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void RPhiFeatureTool::KernelEstimate::Finalise()
+{
+    if (m_isFinalised)
+        throw StatusCodeException(STATUS_CODE_NOT_ALLOWED);
+
+    // ATTN Stable sort retains insertion order for equal x coordinates, matching the original multimap ordering
+    std::stable_sort(m_contributionList.begin(), m_contributionList.end(),
+        [](const ContributionList::value_type &lhs, const ContributionList::value_type &rhs) {return (lhs.first < rhs.first);});
+
+    m_isFinalised = true;
+
+    if (!m_pGaussianLookupTable || m_contributionList.empty())
+        return;
+
+    // Linear binning of the contributions, followed by convolution with the tabulated kernel
+    const int nKernelBins(static_cast<int>(m_pGaussianLookupTable->size()) - 1);
+    m_binnedXLow = m_contributionList.front().first - static_cast<float>(nKernelBins + 1) * m_binWidth;
+    const float binnedXRange(m_contributionList.back().first - m_binnedXLow);
+    const int nBins(static_cast<int>(std::ceil(binnedXRange / m_binWidth)) + nKernelBins + 3);
+
+    FloatVector binnedWeights(nBins, 0.f);
+
+    for (const ContributionList::value_type &contribution : m_contributionList)
+    {
+        const float binPosition((contribution.first - m_binnedXLow) / m_binWidth);
+        const int lowBin(std::max(0, std::min(nBins - 2, static_cast<int>(std::floor(binPosition)))));
+        const float highFraction(std::max(0.f, std::min(1.f, binPosition - static_cast<float>(lowBin))));
+
+        binnedWeights.at(lowBin) += (1.f - highFraction) * contribution.second;
+        binnedWeights.at(lowBin + 1) += highFraction * contribution.second;
+    }
+
+    m_binnedEstimate.assign(nBins, 0.f);
+
+    for (int iBin = 0; iBin < nBins; ++iBin)
+    {
+        const float binnedWeight(binnedWeights.at(iBin));
+
+        if (std::fabs(binnedWeight) < std::numeric_limits<float>::min())
+            continue;
+
+        const int minBin(std::max(0, iBin - nKernelBins)), maxBin(std::min(nBins - 1, iBin + nKernelBins));
+
+        for (int jBin = minBin; jBin <= maxBin; ++jBin)
+            m_binnedEstimate.at(jBin) += binnedWeight * m_pGaussianLookupTable->at(std::abs(jBin - iBin));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float RPhiFeatureTool::KernelEstimate::SampleBinned(const float x) const
+{
+    if (m_binnedEstimate.empty())
+        return 0.f;
+
+    const float binPosition((x - m_binnedXLow) / m_binWidth);
+    const int nBins(static_cast<int>(m_binnedEstimate.size()));
+
+    if (!(binPosition >= 0.f) || !(binPosition <= static_cast<float>(nBins - 1)))
+        return 0.f;
+
+    const int lowBin(std::min(nBins - 2, static_cast<int>(binPosition)));
+    const float highFraction(binPosition - static_cast<float>(lowBin));
+
+    return ((1.f - highFraction) * m_binnedEstimate.at(lowBin) + highFraction * m_binnedEstimate.at(lowBin + 1));
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -278,6 +505,26 @@ StatusCode RPhiFeatureTool::ReadSettings(const TiXmlHandle xmlHandle)
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "EnableFolding", m_enableFolding));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "UseBinnedKernelEstimate", m_useBinnedKernelEstimate));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "NKernelBinsPerSigma", m_nKernelBinsPerSigma));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "ShareKDTreeSearches", m_shareKDTreeSearches));
+
+    if (m_useBinnedKernelEstimate)
+    {
+        if (0 == m_nKernelBinsPerSigma)
+        {
+            std::cout << "RPhiFeatureTool: NKernelBinsPerSigma must be positive when using binned kernel estimates" << std::endl;
+            return STATUS_CODE_INVALID_PARAMETER;
+        }
+
+        this->FillGaussianLookupTable();
+    }
+
     return STATUS_CODE_SUCCESS;
 }
 
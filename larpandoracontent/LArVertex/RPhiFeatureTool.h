@@ -18,7 +18,7 @@ namespace lar_content
 /**
  *  @brief  RPhiFeatureTool class
  */
-class RPhiFeatureTool : public VertexSelectionBaseAlgorithm::VertexFeatureTool
+class RPhiFeatureTool : public VertexSelectionBaseAlgorithm::VertexFeatureTool, public VertexSelectionBaseAlgorithm::VertexFeatureBatchTool
 {
 public:
     /**
@@ -42,6 +42,22 @@ public:
         const VertexSelectionBaseAlgorithm::KDTreeMap &kdTreeMap, const VertexSelectionBaseAlgorithm::ShowerClusterListMap &,
         const float beamDeweightingScore, float &bestFastScore);
 
+    /**
+     *  @brief  Run the tool for all candidate vertices in a batch. Kernel estimates and scores are calculated concurrently, but the fast
+     *          score check is applied in vertex order, so the features match those from running the tool vertex by vertex, with one best
+     *          fast score for the whole batch.
+     *
+     *  @param  featureMatrix the feature matrix, to which to append the r/phi features
+     *  @param  pAlgorithm address of the calling algorithm
+     *  @param  vertexFeatureBatch the vertex feature batch
+     *  @param  kdTreeMap map of the hit kd trees
+     *  @param  beamDeweightingScores the beam deweighting scores, in vertex order
+     */
+    void RunBatch(VertexSelectionBaseAlgorithm::VertexFeatureMatrix &featureMatrix, const VertexSelectionBaseAlgorithm *const pAlgorithm,
+        const VertexSelectionBaseAlgorithm::VertexFeatureBatch &vertexFeatureBatch, const VertexSelectionBaseAlgorithm::SlidingFitDataListMap &,
+        const VertexSelectionBaseAlgorithm::ClusterListMap &, const VertexSelectionBaseAlgorithm::KDTreeMap &kdTreeMap,
+        const VertexSelectionBaseAlgorithm::ShowerClusterListMap &, const pandora::FloatVector &beamDeweightingScores);
+
 private:
     /**
      *  @brief Kernel estimate class
@@ -53,8 +69,11 @@ private:
          *  @brief  Constructor
          *
          *  @param  sigma the width associated with the kernel estimate
+         *  @param  pGaussianLookupTable address of a gaussian lookup table, sampled at sigma / nBinsPerSigma intervals from the kernel centre,
+         *          with which to build a binned estimate, or nullptr to evaluate the estimate exactly
+         *  @param  nBinsPerSigma the number of lookup table entries per sigma
          */
-        KernelEstimate(const float sigma);
+        KernelEstimate(const float sigma, const pandora::FloatVector *const pGaussianLookupTable = nullptr, const unsigned int nBinsPerSigma = 0);
 
         /**
          *  @brief  Sample the parameterised distribution at a specified x coordinate
@@ -65,7 +84,7 @@ private:
          */
         float Sample(const float x) const;
 
-        typedef std::multimap<float, float> ContributionList;   ///< Map from x coord to weight, ATTN avoid map.find, etc. with float key
+        typedef std::vector<std::pair<float, float> > ContributionList;   ///< List of x coord and weight, sorted by x coord once finalised
 
         /**
          *  @brief  Get the contribution list
@@ -89,9 +108,29 @@ private:
          */
         void AddContribution(const float x, const float weight);
 
+        /**
+         *  @brief  Sort the contributions and, if requested, build the binned estimate. Must be called after the final contribution is added.
+         */
+        void Finalise();
+
     private:
+        /**
+         *  @brief  Sample the binned estimate, interpolating linearly between bins
+         *
+         *  @param  x the position at which to sample
+         *
+         *  @return the sample value
+         */
+        float SampleBinned(const float x) const;
+
         ContributionList            m_contributionList;         ///< The contribution list
         const float                 m_sigma;                    ///< The assigned width
+        const pandora::FloatVector *m_pGaussianLookupTable;     ///< The gaussian lookup table, or nullptr for exact evaluation
+        const unsigned int          m_nBinsPerSigma;            ///< The number of bins per sigma for the binned estimate
+        bool                        m_isFinalised;              ///< Whether the kernel estimate has been finalised
+        float                       m_binnedXLow;               ///< The x coordinate of the first bin in the binned estimate
+        float                       m_binWidth;                 ///< The bin width for the binned estimate
+        pandora::FloatVector        m_binnedEstimate;           ///< The binned estimate, sampled at bin positions
     };
 
     //--------------------------------------------------------------------------------------------------------------------------------------
@@ -141,6 +180,22 @@ private:
      */
     void FillKernelEstimate(const pandora::Vertex *const pVertex, const pandora::HitType hitType, VertexSelectionBaseAlgorithm::HitKDTree2D &kdTree, KernelEstimate &kernelEstimate) const;
 
+    /**
+     *  @brief  Use the hits found in a kd tree search that lie within the search window about a projected vertex position to fill a provided
+     *          kernel estimate
+     *
+     *  @param  vertexPosition2D the vertex position projected into the relevant view
+     *  @param  found the hits found in a kd tree search enclosing the search window
+     *  @param  kernelEstimate to receive the populated kernel estimate
+     */
+    void FillKernelEstimate(const pandora::CartesianVector &vertexPosition2D, const VertexSelectionBaseAlgorithm::HitKDNode2DList &found,
+        KernelEstimate &kernelEstimate) const;
+
+    /**
+     *  @brief  Fill the gaussian lookup table used for binned kernel estimation
+     */
+    void FillGaussianLookupTable();
+
     /**
      *  @brief  Whether to accept a candidate vertex, based on its spatial position in relation to other selected candidates
      *
@@ -175,15 +230,33 @@ private:
     float           m_fastHistogramPhiMax;          ///< Max value for fast score histograms
 
     bool            m_enableFolding;                ///< Whether to enable folding of -pi -> +pi phi distribution into 0 -> +pi region only
+
+    bool                    m_useBinnedKernelEstimate;  ///< Whether to sample binned kernel estimates, rather than evaluating them exactly. Binned
+                                                        ///< midway and full scores agree with exact scores to within ~1e-3 of the sum of absolute
+                                                        ///< score terms, for 10 bins per sigma, with residual differences from the 3 sigma kernel cut
+    unsigned int            m_nKernelBinsPerSigma;      ///< The number of bins per kernel estimate sigma for binned kernel estimates
+    pandora::FloatVector    m_gaussianLookupTable;      ///< The gaussian lookup table for binned kernel estimates
+
+    bool                    m_shareKDTreeSearches;      ///< Whether nearby vertices share kd tree searches when calculating features in batches. Shared
+                                                        ///< searches may also find hits on a vertex search window edge, so features can differ slightly
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-inline RPhiFeatureTool::KernelEstimate::KernelEstimate(const float sigma) :
-    m_sigma(sigma)
+inline RPhiFeatureTool::KernelEstimate::KernelEstimate(const float sigma, const pandora::FloatVector *const pGaussianLookupTable,
+        const unsigned int nBinsPerSigma) :
+    m_sigma(sigma),
+    m_pGaussianLookupTable(pGaussianLookupTable),
+    m_nBinsPerSigma(nBinsPerSigma),
+    m_isFinalised(false),
+    m_binnedXLow(0.f),
+    m_binWidth(sigma / static_cast<float>(std::max(nBinsPerSigma, 1U)))
 {
     if (m_sigma < std::numeric_limits<float>::epsilon())
         throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+
+    if (m_pGaussianLookupTable && ((0 == m_nBinsPerSigma) || (m_pGaussianLookupTable->size() != 3 * m_nBinsPerSigma + 1)))
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
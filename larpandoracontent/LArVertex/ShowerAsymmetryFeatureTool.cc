@@ -46,8 +46,33 @@ void ShowerAsymmetryFeatureTool::Run(LArMvaHelper::MvaFeatureVector &featureVect
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void ShowerAsymmetryFeatureTool::RunBatch(VertexSelectionBaseAlgorithm::VertexFeatureMatrix &featureMatrix, const VertexSelectionBaseAlgorithm *const pAlgorithm,
+    const VertexSelectionBaseAlgorithm::VertexFeatureBatch &vertexFeatureBatch, const VertexSelectionBaseAlgorithm::SlidingFitDataListMap &,
+    const VertexSelectionBaseAlgorithm::ClusterListMap &, const VertexSelectionBaseAlgorithm::KDTreeMap &,
+    const VertexSelectionBaseAlgorithm::ShowerClusterListMap &showerClusterListMap, const FloatVector &)
+{
+    if (PandoraContentApi::GetSettings(*pAlgorithm)->ShouldDisplayAlgorithmInfo())
+       std::cout << "----> Running Algorithm Tool: " << this->GetInstanceName() << ", " << this->GetType() << std::endl;
+
+    vertexFeatureBatch.CalculateFeatures([&](const unsigned int vertexIndex) -> float
+    {
+        float showerAsymmetry(0.f);
+
+        showerAsymmetry += this->GetShowerAsymmetryForView(vertexFeatureBatch.GetProjectedPosition(vertexIndex, TPC_VIEW_U), showerClusterListMap.at(TPC_VIEW_U),
+            &vertexFeatureBatch);
+        showerAsymmetry += this->GetShowerAsymmetryForView(vertexFeatureBatch.GetProjectedPosition(vertexIndex, TPC_VIEW_V), showerClusterListMap.at(TPC_VIEW_V),
+            &vertexFeatureBatch);
+        showerAsymmetry += this->GetShowerAsymmetryForView(vertexFeatureBatch.GetProjectedPosition(vertexIndex, TPC_VIEW_W), showerClusterListMap.at(TPC_VIEW_W),
+            &vertexFeatureBatch);
+
+        return showerAsymmetry;
+    }, featureMatrix);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 float ShowerAsymmetryFeatureTool::GetShowerAsymmetryForView(const CartesianVector &vertexPosition2D,
-    const VertexSelectionBaseAlgorithm::ShowerClusterList &showerClusterList) const
+    const VertexSelectionBaseAlgorithm::ShowerClusterList &showerClusterList, const VertexSelectionBaseAlgorithm::VertexFeatureBatch *const pVertexFeatureBatch) const
 {
     float showerAsymmetry(1.f);
 
@@ -67,7 +92,7 @@ float ShowerAsymmetryFeatureTool::GetShowerAsymmetryForView(const CartesianVecto
             const float projectedVtxPosition = vertexPosition2D.GetDotProduct(showerDirection);
 
             float beforeVtxEnergy(0.f), afterVtxEnergy(0.f);
-            this->CalculateAsymmetryParameters(showerCluster, projectedVtxPosition, showerDirection, beforeVtxEnergy, afterVtxEnergy);
+            this->CalculateAsymmetryParameters(showerCluster, projectedVtxPosition, showerDirection, beforeVtxEnergy, afterVtxEnergy, pVertexFeatureBatch);
 
             if (beforeVtxEnergy + afterVtxEnergy > 0.f)
                 showerAsymmetry = std::fabs(afterVtxEnergy - beforeVtxEnergy) / (afterVtxEnergy + beforeVtxEnergy);
@@ -96,20 +121,22 @@ bool ShowerAsymmetryFeatureTool::ShouldUseShowerCluster(const CartesianVector &v
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 void ShowerAsymmetryFeatureTool::CalculateAsymmetryParameters(const VertexSelectionBaseAlgorithm::ShowerCluster &showerCluster,
-    const float projectedVtxPosition, const CartesianVector &showerDirection, float &beforeVtxEnergy, float &afterVtxEnergy) const
+    const float projectedVtxPosition, const CartesianVector &showerDirection, float &beforeVtxEnergy, float &afterVtxEnergy,
+    const VertexSelectionBaseAlgorithm::VertexFeatureBatch *const pVertexFeatureBatch) const
 {
     beforeVtxEnergy = 0.f;
     afterVtxEnergy = 0.f;
 
     for (const Cluster * const pCluster : showerCluster.GetClusters())
     {
-        CaloHitList caloHitList;
-        pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
+        CaloHitVector caloHitVector;
+
+        if (!pVertexFeatureBatch)
+            VertexSelectionBaseAlgorithm::VertexFeatureBatch::SortCaloHits(pCluster, caloHitVector);
 
-        CaloHitVector caloHitVector(caloHitList.begin(), caloHitList.end());
-        std::sort(caloHitVector.begin(), caloHitVector.end(), LArClusterHelper::SortHitsByPosition);
+        const CaloHitVector &sortedCaloHitVector(pVertexFeatureBatch ? pVertexFeatureBatch->GetSortedCaloHits(pCluster) : caloHitVector);
 
-        for (const CaloHit *const pCaloHit : caloHitVector)
+        for (const CaloHit *const pCaloHit : sortedCaloHitVector)
         {
             if (pCaloHit->GetPositionVector().GetDotProduct(showerDirection) < projectedVtxPosition)
                 beforeVtxEnergy += pCaloHit->GetElectromagneticEnergy();
@@ -18,7 +18,7 @@ namespace lar_content
 /**
  *  @brief  ShowerAsymmetryFeatureTool class
  */
-class ShowerAsymmetryFeatureTool : public VertexSelectionBaseAlgorithm::VertexFeatureTool
+class ShowerAsymmetryFeatureTool : public VertexSelectionBaseAlgorithm::VertexFeatureTool, public VertexSelectionBaseAlgorithm::VertexFeatureBatchTool
 {
 public:
     /**
@@ -40,6 +40,19 @@ public:
         const VertexSelectionBaseAlgorithm::KDTreeMap &, const VertexSelectionBaseAlgorithm::ShowerClusterListMap &showerClusterListMap,
         const float, float &);
 
+    /**
+     *  @brief  Run the tool for all candidate vertices in a batch
+     *
+     *  @param  featureMatrix the feature matrix, to which to append the shower asymmetry features
+     *  @param  pAlgorithm address of the calling algorithm
+     *  @param  vertexFeatureBatch the vertex feature batch
+     *  @param  showerClusterListMap map of the shower cluster lists
+     */
+    void RunBatch(VertexSelectionBaseAlgorithm::VertexFeatureMatrix &featureMatrix, const VertexSelectionBaseAlgorithm *const pAlgorithm,
+        const VertexSelectionBaseAlgorithm::VertexFeatureBatch &vertexFeatureBatch, const VertexSelectionBaseAlgorithm::SlidingFitDataListMap &,
+        const VertexSelectionBaseAlgorithm::ClusterListMap &, const VertexSelectionBaseAlgorithm::KDTreeMap &, const VertexSelectionBaseAlgorithm::ShowerClusterListMap &showerClusterListMap,
+        const pandora::FloatVector &);
+
 private:
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
 
@@ -48,10 +61,12 @@ private:
      *
      *  @param  vertexPosition2D the projected vertex position
      *  @param  showerClusterList the list of shower clusters in this view
+     *  @param  pVertexFeatureBatch address of the vertex feature batch from which to take sorted calo hits, if any
      *
      *  @return the shower asymmetry feature
      */
-    float GetShowerAsymmetryForView(const pandora::CartesianVector &vertexPosition2D, const VertexSelectionBaseAlgorithm::ShowerClusterList &showerClusterList) const;
+    float GetShowerAsymmetryForView(const pandora::CartesianVector &vertexPosition2D, const VertexSelectionBaseAlgorithm::ShowerClusterList &showerClusterList,
+        const VertexSelectionBaseAlgorithm::VertexFeatureBatch *const pVertexFeatureBatch = nullptr) const;
 
     /**
      *  @brief  Get whether we should use a given shower cluster for asymmetry calculation
@@ -71,9 +86,11 @@ private:
      *  @param  showerDirection the direction of the shower axis
      *  @param  beforeVtxEnergy the shower energy before the vertex position
      *  @param  afterVtxEnergy the shower energy after the vertex position
+     *  @param  pVertexFeatureBatch address of the vertex feature batch from which to take sorted calo hits, if any
      */
     void CalculateAsymmetryParameters(const VertexSelectionBaseAlgorithm::ShowerCluster &showerCluster, const float projectedVtxPosition,
-        const pandora::CartesianVector &showerDirection, float &beforeVtxEnergy, float &afterVtxEnergy) const;
+        const pandora::CartesianVector &showerDirection, float &beforeVtxEnergy, float &afterVtxEnergy,
+        const VertexSelectionBaseAlgorithm::VertexFeatureBatch *const pVertexFeatureBatch = nullptr) const;
 
     float   m_vertexClusterDistance;    ///< The distance around the vertex to look for shower clusters
 };
@@ -37,6 +37,7 @@ TrainedVertexSelectionAlgorithm::TrainedVertexSelectionAlgorithm() :
     m_trainingSetMode(false),
     m_allowClassifyDuringTraining(false),
     m_mcVertexXCorrection(0.f),
+    m_trainingOutputFormat(LArTrainingExampleWriter::TEXT),
     m_minClusterCaloHits(12),
     m_slidingFitWindow(100),
     m_minShowerSpineLength(15.f),
@@ -53,12 +54,36 @@ TrainedVertexSelectionAlgorithm::TrainedVertexSelectionAlgorithm() :
     m_maxTrueVertexRadius(1.f),
     m_useRPhiFeatureForRegion(false),
     m_dropFailedRPhiFastScoreCandidates(true),
-    m_testBeamMode(false)
+    m_testBeamMode(false),
+    m_useBatchFeatureTools(false),
+    m_nFeatureToolThreads(1),
+    m_checkBatchFeatureTools(false)
 {
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+TrainedVertexSelectionAlgorithm::~TrainedVertexSelectionAlgorithm()
+{
+    if (m_trainingSetMode)
+    {
+        for (const std::string &trainingOutputFileName : m_trainingOutputFileNames)
+            LArTrainingExampleWriter::Close(trainingOutputFileName);
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode TrainedVertexSelectionAlgorithm::Reset()
+{
+    if (m_trainingSetMode)
+        LArTrainingExampleWriter::FlushAll();
+
+    return VertexSelectionBaseAlgorithm::Reset();
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void TrainedVertexSelectionAlgorithm::CalculateShowerClusterList(const ClusterList &inputClusterList, ShowerClusterList &showerClusterList) const
 {
     ClusterEndPointsMap clusterEndPointsMap;
@@ -68,11 +93,10 @@ void TrainedVertexSelectionAlgorithm::CalculateShowerClusterList(const ClusterLi
     const float slidingFitPitch(LArGeometryHelper::GetWireZPitch(this->GetPandora()));
     ClusterList availableShowerLikeClusters(showerLikeClusters.begin(), showerLikeClusters.end());
 
-    HitKDTree2D kdTree;
     HitToClusterMap hitToClusterMap;
 
     if (!m_useShowerClusteringApproximation)
-        this->PopulateKdTree(availableShowerLikeClusters, kdTree, hitToClusterMap);
+        this->PopulateKdTree(availableShowerLikeClusters, m_showerClusteringKDTree, hitToClusterMap);
 
     while (!availableShowerLikeClusters.empty())
     {
@@ -88,7 +112,7 @@ void TrainedVertexSelectionAlgorithm::CalculateShowerClusterList(const ClusterLi
             {
                 if (!m_useShowerClusteringApproximation)
                 {
-                    addedCluster = this->AddClusterToShower(kdTree, hitToClusterMap, availableShowerLikeClusters, pCluster, showerCluster);
+                    addedCluster = this->AddClusterToShower(m_showerClusteringKDTree, hitToClusterMap, availableShowerLikeClusters, pCluster, showerCluster);
                 }
                 else
                 {
@@ -109,6 +133,8 @@ void TrainedVertexSelectionAlgorithm::CalculateShowerClusterList(const ClusterLi
 
         showerClusterList.emplace_back(showerCluster, slidingFitPitch, m_slidingFitWindow);
     }
+
+    m_showerClusteringKDTree.clear();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -206,11 +232,13 @@ bool TrainedVertexSelectionAlgorithm::AddClusterToShower(HitKDTree2D &kdTree, co
     CaloHitList daughterHits;
     pCluster->GetOrderedCaloHitList().FillCaloHitList(daughterHits);
 
+    HitKDNode2DList found;
+
     for (const CaloHit *const pCaloHit : daughterHits)
     {
         KDTreeBox searchRegionHits = build_2d_kd_search_region(pCaloHit, m_showerClusteringDistance, m_showerClusteringDistance);
 
-        HitKDNode2DList found;
+        found.clear();
         kdTree.search(searchRegionHits, found);
 
         for (const auto &hit : found)
@@ -386,6 +414,110 @@ void TrainedVertexSelectionAlgorithm::PopulateVertexFeatureInfoMap(const BeamCon
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void TrainedVertexSelectionAlgorithm::PopulateVertexFeatureInfoMap(const BeamConstants &beamConstants, const ClusterListMap &clusterListMap,
+    const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
+    const VertexVector &vertexVector, VertexFeatureInfoMap &vertexFeatureInfoMap) const
+{
+    if (!m_useBatchFeatureTools)
+    {
+        for (const Vertex *const pVertex : vertexVector)
+        {
+            this->PopulateVertexFeatureInfoMap(beamConstants, clusterListMap, slidingFitDataListMap, showerClusterListMap, kdTreeMap, pVertex,
+                vertexFeatureInfoMap);
+        }
+
+        return;
+    }
+
+    FloatVector beamDeweightingScores;
+
+    for (const Vertex *const pVertex : vertexVector)
+        beamDeweightingScores.push_back(this->GetBeamDeweightingScore(beamConstants, pVertex));
+
+    const VertexFeatureBatch vertexFeatureBatch(this, vertexVector, slidingFitDataListMap, showerClusterListMap, m_nFeatureToolThreads);
+    VertexFeatureMatrix energyKickMatrix(vertexVector.size()), localAsymmetryMatrix(vertexVector.size());
+    VertexFeatureMatrix globalAsymmetryMatrix(vertexVector.size()), showerAsymmetryMatrix(vertexVector.size());
+
+    this->CalculateBatchFeaturesOfType<EnergyKickFeatureTool>(vertexFeatureBatch, clusterListMap, slidingFitDataListMap, showerClusterListMap,
+        kdTreeMap, beamDeweightingScores, energyKickMatrix);
+
+    this->CalculateBatchFeaturesOfType<LocalAsymmetryFeatureTool>(vertexFeatureBatch, clusterListMap, slidingFitDataListMap, showerClusterListMap,
+        kdTreeMap, beamDeweightingScores, localAsymmetryMatrix);
+
+    this->CalculateBatchFeaturesOfType<GlobalAsymmetryFeatureTool>(vertexFeatureBatch, clusterListMap, slidingFitDataListMap, showerClusterListMap,
+        kdTreeMap, beamDeweightingScores, globalAsymmetryMatrix);
+
+    this->CalculateBatchFeaturesOfType<ShowerAsymmetryFeatureTool>(vertexFeatureBatch, clusterListMap, slidingFitDataListMap, showerClusterListMap,
+        kdTreeMap, beamDeweightingScores, showerAsymmetryMatrix);
+
+    for (unsigned int vertexIndex = 0; vertexIndex < vertexVector.size(); ++vertexIndex)
+    {
+        const double energyKick(energyKickMatrix.at(vertexIndex).at(0).Get());
+        const double localAsymmetry(localAsymmetryMatrix.at(vertexIndex).at(0).Get());
+        const double globalAsymmetry(globalAsymmetryMatrix.at(vertexIndex).at(0).Get());
+        const double showerAsymmetry(showerAsymmetryMatrix.at(vertexIndex).at(0).Get());
+
+        VertexFeatureInfo vertexFeatureInfo(beamDeweightingScores.at(vertexIndex), 0.f, energyKick, localAsymmetry, globalAsymmetry, showerAsymmetry);
+        vertexFeatureInfoMap.emplace(vertexVector.at(vertexIndex), vertexFeatureInfo);
+    }
+
+    if (m_checkBatchFeatureTools)
+    {
+        VertexFeatureInfoMap serialVertexFeatureInfoMap;
+
+        for (const Vertex *const pVertex : vertexVector)
+        {
+            this->PopulateVertexFeatureInfoMap(beamConstants, clusterListMap, slidingFitDataListMap, showerClusterListMap, kdTreeMap, pVertex,
+                serialVertexFeatureInfoMap);
+
+            const VertexFeatureInfo &vertexFeatureInfo(vertexFeatureInfoMap.at(pVertex));
+            const VertexFeatureInfo &serialVertexFeatureInfo(serialVertexFeatureInfoMap.at(pVertex));
+
+            if ((vertexFeatureInfo.m_beamDeweighting != serialVertexFeatureInfo.m_beamDeweighting) ||
+                (vertexFeatureInfo.m_energyKick != serialVertexFeatureInfo.m_energyKick) ||
+                (vertexFeatureInfo.m_localAsymmetry != serialVertexFeatureInfo.m_localAsymmetry) ||
+                (vertexFeatureInfo.m_globalAsymmetry != serialVertexFeatureInfo.m_globalAsymmetry) ||
+                (vertexFeatureInfo.m_showerAsymmetry != serialVertexFeatureInfo.m_showerAsymmetry))
+            {
+                std::cout << "TrainedVertexSelectionAlgorithm: batch vertex features differ from those calculated vertex by vertex" << std::endl;
+                throw StatusCodeException(STATUS_CODE_FAILURE);
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename T>
+void TrainedVertexSelectionAlgorithm::CalculateBatchFeaturesOfType(const VertexFeatureBatch &vertexFeatureBatch, const ClusterListMap &clusterListMap,
+    const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
+    const FloatVector &beamDeweightingScores, VertexFeatureMatrix &featureMatrix) const
+{
+    const VertexVector &vertexVector(vertexFeatureBatch.GetVertexVector());
+
+    for (VertexFeatureTool *const pFeatureTool : m_featureToolVector)
+    {
+        if (!dynamic_cast<T *const>(pFeatureTool))
+            continue;
+
+        if (VertexFeatureBatchTool *const pBatchFeatureTool = dynamic_cast<VertexFeatureBatchTool *const>(pFeatureTool))
+        {
+            pBatchFeatureTool->RunBatch(featureMatrix, this, vertexFeatureBatch, slidingFitDataListMap, clusterListMap, kdTreeMap, showerClusterListMap,
+                beamDeweightingScores);
+            continue;
+        }
+
+        for (unsigned int vertexIndex = 0; vertexIndex < vertexVector.size(); ++vertexIndex)
+        {
+            float bestFastScore(-std::numeric_limits<float>::max()); // not actually used - artefact of toolizing RPhi score and still using performance trick
+            pFeatureTool->Run(featureMatrix.at(vertexIndex), this, vertexVector.at(vertexIndex), slidingFitDataListMap, clusterListMap, kdTreeMap,
+                showerClusterListMap, beamDeweightingScores.at(vertexIndex), bestFastScore);
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 void TrainedVertexSelectionAlgorithm::PopulateInitialScoreList(VertexFeatureInfoMap &vertexFeatureInfoMap, const Vertex *const pVertex,
                                                            VertexScoreList &initialScoreList) const
 {
@@ -478,6 +610,12 @@ void TrainedVertexSelectionAlgorithm::ProduceTrainingSets(const VertexVector &ve
 void TrainedVertexSelectionAlgorithm::CalculateRPhiScores(VertexVector &vertexVector, VertexFeatureInfoMap &vertexFeatureInfoMap,
     const KDTreeMap &kdTreeMap) const
 {
+    if (m_useBatchFeatureTools)
+    {
+        this->CalculateBatchRPhiScores(vertexVector, vertexFeatureInfoMap, kdTreeMap);
+        return;
+    }
+
     float bestFastScore(-std::numeric_limits<float>::max());
 
     for (auto iter = vertexVector.begin(); iter != vertexVector.end(); /* no increment */)
@@ -497,6 +635,50 @@ void TrainedVertexSelectionAlgorithm::CalculateRPhiScores(VertexVector &vertexVe
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+void TrainedVertexSelectionAlgorithm::CalculateBatchRPhiScores(VertexVector &vertexVector, VertexFeatureInfoMap &vertexFeatureInfoMap,
+    const KDTreeMap &kdTreeMap) const
+{
+    FloatVector beamDeweightingScores;
+
+    for (const Vertex *const pVertex : vertexVector)
+        beamDeweightingScores.push_back(vertexFeatureInfoMap.at(pVertex).m_beamDeweighting);
+
+    const VertexFeatureBatch vertexFeatureBatch(this, vertexVector, m_nFeatureToolThreads);
+    VertexFeatureMatrix rPhiMatrix(vertexVector.size());
+
+    this->CalculateBatchFeaturesOfType<RPhiFeatureTool>(vertexFeatureBatch, ClusterListMap(), SlidingFitDataListMap(), ShowerClusterListMap(),
+        kdTreeMap, beamDeweightingScores, rPhiMatrix);
+
+    VertexVector scoredVertexVector;
+    float bestFastScore(-std::numeric_limits<float>::max());
+
+    for (unsigned int vertexIndex = 0; vertexIndex < vertexVector.size(); ++vertexIndex)
+    {
+        VertexFeatureInfo &vertexFeatureInfo = vertexFeatureInfoMap.at(vertexVector.at(vertexIndex));
+        vertexFeatureInfo.m_rPhiFeature = static_cast<float>(rPhiMatrix.at(vertexIndex).at(0).Get());
+
+        if (m_checkBatchFeatureTools)
+        {
+            // ATTN The fast score check depends on the best fast score so far, so vertices must be recalculated in order, as in CalculateRPhiScores
+            const double serialRPhiFeature(LArMvaHelper::CalculateFeaturesOfType<RPhiFeatureTool>(m_featureToolVector, this, vertexVector.at(vertexIndex),
+                SlidingFitDataListMap(), ClusterListMap(), kdTreeMap, ShowerClusterListMap(), vertexFeatureInfo.m_beamDeweighting, bestFastScore).at(0).Get());
+
+            if (vertexFeatureInfo.m_rPhiFeature != static_cast<float>(serialRPhiFeature))
+            {
+                std::cout << "TrainedVertexSelectionAlgorithm: batch r/phi features differ from those calculated vertex by vertex" << std::endl;
+                throw StatusCodeException(STATUS_CODE_FAILURE);
+            }
+        }
+
+        if (!m_dropFailedRPhiFastScoreCandidates || (vertexFeatureInfo.m_rPhiFeature > std::numeric_limits<float>::epsilon()))
+            scoredVertexVector.push_back(vertexVector.at(vertexIndex));
+    }
+
+    vertexVector.swap(scoredVertexVector);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 std::string TrainedVertexSelectionAlgorithm::GetInteractionType() const
 {
     // Extract input collections
@@ -544,6 +726,10 @@ const pandora::Vertex * TrainedVertexSelectionAlgorithm::ProduceTrainingExamples
     VertexFeatureInfo bestVertexFeatureInfo(vertexFeatureInfoMap.at(pBestVertex));
     this->AddVertexFeaturesToVector(bestVertexFeatureInfo, bestVertexFeatureList, useRPhi);
 
+    const std::string extension((LArTrainingExampleWriter::BINARY == m_trainingOutputFormat) ? ".bin" : ".txt");
+    const std::string trainingOutputFileName(trainingOutputFile + "_" + interactionType + extension);
+    m_trainingOutputFileNames.insert(trainingOutputFileName);
+
     for (const Vertex *const pVertex : vertexVector)
     {
         if (pVertex == pBestVertex)
@@ -557,14 +743,14 @@ const pandora::Vertex * TrainedVertexSelectionAlgorithm::ProduceTrainingExamples
         {
             if (coinFlip(generator))
             {
-                LArMvaHelper::ProduceTrainingExample(trainingOutputFile + "_" + interactionType + ".txt", true, eventFeatureList,
-                    bestVertexFeatureList, featureList);
+                LArMvaHelper::ProduceTrainingExample(trainingOutputFileName, m_trainingOutputFormat, true,
+                    eventFeatureList, bestVertexFeatureList, featureList);
             }
 
             else
             {
-                LArMvaHelper::ProduceTrainingExample(trainingOutputFile + "_" + interactionType + ".txt", false, eventFeatureList, featureList,
-                    bestVertexFeatureList);
+                LArMvaHelper::ProduceTrainingExample(trainingOutputFileName, m_trainingOutputFormat, false,
+                    eventFeatureList, featureList, bestVertexFeatureList);
             }
         }
     }
@@ -676,6 +862,12 @@ StatusCode TrainedVertexSelectionAlgorithm::ReadSettings(const TiXmlHandle xmlHa
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "TrainingOutputFileVertex", m_trainingOutputFileVertex));
 
+    bool useBinaryTrainingOutput(false);
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "UseBinaryTrainingOutput", useBinaryTrainingOutput));
+
+    m_trainingOutputFormat = (useBinaryTrainingOutput ? LArTrainingExampleWriter::BINARY : LArTrainingExampleWriter::TEXT);
+
     if (m_trainingSetMode && (m_trainingOutputFileRegion.empty() || m_trainingOutputFileVertex.empty()))
     {
         std::cout << "TrainedVertexSelectionAlgorithm: TrainingOutputFileRegion and TrainingOutputFileVertex are required for training set " <<
@@ -749,6 +941,15 @@ StatusCode TrainedVertexSelectionAlgorithm::ReadSettings(const TiXmlHandle xmlHa
     PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
         "TestBeamMode", m_testBeamMode));
 
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "UseBatchFeatureTools", m_useBatchFeatureTools));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "NFeatureToolThreads", m_nFeatureToolThreads));
+
+    PANDORA_RETURN_RESULT_IF_AND_IF(STATUS_CODE_SUCCESS, STATUS_CODE_NOT_FOUND, !=, XmlHelper::ReadValue(xmlHandle,
+        "CheckBatchFeatureTools", m_checkBatchFeatureTools));
+
     return VertexSelectionBaseAlgorithm::ReadSettings(xmlHandle);
 }
 
@@ -18,14 +18,14 @@
 
 #include "larpandoracontent/LArVertex/VertexSelectionBaseAlgorithm.h"
 
+#include "larpandoracontent/LArUtility/KDTreeLinkerAlgoT.h"
+
 #include <random>
+#include <set>
 
 namespace lar_content
 {
 
-template<typename, unsigned int> class KDTreeLinkerAlgo;
-template<typename, unsigned int> class KDTreeNodeInfoT;
-
 //------------------------------------------------------------------------------------------------------------------------------------------
 
 /**
@@ -101,6 +101,11 @@ public:
      */
     TrainedVertexSelectionAlgorithm();
 
+    /**
+     *  @brief  Destructor, closing any training example files
+     */
+    ~TrainedVertexSelectionAlgorithm();
+
 protected:
     typedef std::pair<pandora::CartesianVector, pandora::CartesianVector> ClusterEndPoints;
     typedef std::map<const pandora::Cluster *const, ClusterEndPoints> ClusterEndPointsMap;
@@ -266,6 +271,37 @@ protected:
         const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
         const pandora::Vertex *const pVertex, VertexFeatureInfoMap &vertexFeatureInfoMap) const;
 
+    /**
+     *  @brief  Populate the vertex feature info map for a list of vertices, either vertex by vertex or, if requested, as a single batch
+     *
+     *  @param  beamConstants the beam constants
+     *  @param  clusterListMap the cluster list map
+     *  @param  slidingFitDataListMap the sliding fit data list map
+     *  @param  showerClusterListMap the shower cluster list map
+     *  @param  kdTreeMap the kd tree map
+     *  @param  vertexVector the vertices
+     *  @param  vertexFeatureInfoMap the map to populate
+     */
+    void PopulateVertexFeatureInfoMap(const BeamConstants &beamConstants, const ClusterListMap &clusterListMap,
+        const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
+        const pandora::VertexVector &vertexVector, VertexFeatureInfoMap &vertexFeatureInfoMap) const;
+
+    /**
+     *  @brief  Calculate the features of a given tool type for all vertices in a batch, running tools without batch support vertex by vertex
+     *
+     *  @param  vertexFeatureBatch the vertex feature batch
+     *  @param  clusterListMap the cluster list map
+     *  @param  slidingFitDataListMap the sliding fit data list map
+     *  @param  showerClusterListMap the shower cluster list map
+     *  @param  kdTreeMap the kd tree map
+     *  @param  beamDeweightingScores the beam deweighting scores, in vertex order
+     *  @param  featureMatrix to receive the feature vectors, in vertex order
+     */
+    template <typename T>
+    void CalculateBatchFeaturesOfType(const VertexFeatureBatch &vertexFeatureBatch, const ClusterListMap &clusterListMap,
+        const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const KDTreeMap &kdTreeMap,
+        const pandora::FloatVector &beamDeweightingScores, VertexFeatureMatrix &featureMatrix) const;
+
     /**
      *  @brief  Populate the initial vertex score list for a given vertex
      *
@@ -305,6 +341,15 @@ protected:
      */
     void CalculateRPhiScores(pandora::VertexVector &vertexVector, VertexFeatureInfoMap &vertexFeatureInfoMap, const KDTreeMap &kdTreeMap) const;
 
+    /**
+     *  @brief  Calculate the r/phi scores for the vertices in a vector as a single batch, possibly erasing those that fail the fast score test
+     *
+     *  @param  vertexVector the vector of vertices
+     *  @param  vertexFeatureInfoMap the vertex feature info map
+     *  @param  kdTreeMap the kd tree map
+     */
+    void CalculateBatchRPhiScores(pandora::VertexVector &vertexVector, VertexFeatureInfoMap &vertexFeatureInfoMap, const KDTreeMap &kdTreeMap) const;
+
     /**
      *  @brief  Get the interaction type string
      *
@@ -361,6 +406,7 @@ protected:
         const pandora::VertexVector &vertexVector, VertexScoreList &finalVertexScoreList) const;
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+    pandora::StatusCode Reset();
 
     VertexFeatureTool::FeatureToolVector m_featureToolVector;     ///< The feature tool vector
     bool                  m_trainingSetMode;                      ///< Whether to train
@@ -368,6 +414,8 @@ protected:
     float                 m_mcVertexXCorrection;                  ///< The correction to the x-coordinate of the MC vertex position
     std::string           m_trainingOutputFileRegion;             ///< The training output file for the region mva
     std::string           m_trainingOutputFileVertex;             ///< The training output file for the vertex mva
+    LArTrainingExampleWriter::Format m_trainingOutputFormat;      ///< The training output file format
+    mutable std::set<std::string> m_trainingOutputFileNames;      ///< The names of the training output files written, to be closed at teardown
     std::string           m_mcParticleListName;                   ///< The MC particle list for creating training examples
     std::string           m_caloHitListName;                      ///< The 2D CaloHit list name
 
@@ -391,6 +439,11 @@ protected:
     bool                  m_useRPhiFeatureForRegion;              ///< Whether to use the r/phi feature for the region vertex
     bool                  m_dropFailedRPhiFastScoreCandidates;    ///< Whether to drop candidates that fail the r/phi fast score test
     bool                  m_testBeamMode;                         ///< Test beam mode
+    bool                  m_useBatchFeatureTools;                 ///< Whether to calculate vertex features for all candidates as a single batch
+    unsigned int          m_nFeatureToolThreads;                  ///< The number of batch feature threads (one for serial, zero for one per core)
+    bool                  m_checkBatchFeatureTools;               ///< Whether to check that batch features match those calculated vertex by vertex.
+                                                                  ///< For validation only: every feature is recalculated vertex by vertex
+    mutable HitKDTree2D   m_showerClusteringKDTree;               ///< The shower clustering kd tree, retaining its node pool between calls
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
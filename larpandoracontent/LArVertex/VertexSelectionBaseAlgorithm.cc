@@ -131,12 +131,30 @@ void VertexSelectionBaseAlgorithm::CalculateClusterSlidingFits(const ClusterList
 
         // Make sure the window size is such that there are not more layers than hits (following TwoDSlidingLinearFit calculation).
         const unsigned int newSlidingFitWindow(std::min(static_cast<int>(pCluster->GetNCaloHits()), static_cast<int>(slidingFitPitch * slidingFitWindow)));
-        slidingFitDataList.emplace_back(pCluster, newSlidingFitWindow, slidingFitPitch);
+        const LArTwoDSlidingFitCache::TwoDSlidingFitResultPtr slidingFitResultPtr(m_pSlidingFitCache->GetSlidingFitResult(pCluster, newSlidingFitWindow, slidingFitPitch));
+        slidingFitDataList.emplace_back(pCluster, *slidingFitResultPtr);
     }
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+StatusCode VertexSelectionBaseAlgorithm::Initialize()
+{
+    m_pSlidingFitCache = LArTwoDSlidingFitCache::GetSharedInstance(this->GetPandora());
+    m_pDetectorGapIndex = LArDetectorGapIndex::GetSharedInstance(this->GetPandora());
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+StatusCode VertexSelectionBaseAlgorithm::Reset()
+{
+    m_pSlidingFitCache->Clear();
+    return STATUS_CODE_SUCCESS;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode VertexSelectionBaseAlgorithm::Run()
 {
     const VertexList *pInputVertexList(NULL);
@@ -232,7 +250,7 @@ bool VertexSelectionBaseAlgorithm::IsVertexInGap(const Vertex *const pVertex, co
     if (!m_useDetectorGaps)
         return false;
 
-    return LArGeometryHelper::IsInGap3D(this->GetPandora(), pVertex->GetPosition(), hitType, m_gapTolerance);
+    return LArGeometryHelper::IsInGap3D(this->GetPandora(), m_pDetectorGapIndex.get(), pVertex->GetPosition(), hitType, m_gapTolerance);
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -300,19 +318,13 @@ bool VertexSelectionBaseAlgorithm::SortByVertexZPosition(const pandora::Vertex *
 
 //------------------------------------------------------------------------------------------------------------------------------------------
 
-VertexSelectionBaseAlgorithm::SlidingFitData::SlidingFitData(const pandora::Cluster *const pCluster, const int slidingFitWindow,
-        const float slidingFitPitch) :
-    m_minLayerDirection(0.f, 0.f, 0.f),
-    m_maxLayerDirection(0.f, 0.f, 0.f),
-    m_minLayerPosition(0.f, 0.f, 0.f),
-    m_maxLayerPosition(0.f, 0.f, 0.f),
+VertexSelectionBaseAlgorithm::SlidingFitData::SlidingFitData(const pandora::Cluster *const pCluster, const TwoDSlidingFitResult &slidingFitResult) :
+    m_minLayerDirection(slidingFitResult.GetGlobalMinLayerDirection()),
+    m_maxLayerDirection(slidingFitResult.GetGlobalMaxLayerDirection()),
+    m_minLayerPosition(slidingFitResult.GetGlobalMinLayerPosition()),
+    m_maxLayerPosition(slidingFitResult.GetGlobalMaxLayerPosition()),
     m_pCluster(pCluster)
 {
-    const TwoDSlidingFitResult slidingFitResult(pCluster, slidingFitWindow, slidingFitPitch);
-    m_minLayerDirection = slidingFitResult.GetGlobalMinLayerDirection();
-    m_maxLayerDirection = slidingFitResult.GetGlobalMaxLayerDirection();
-    m_minLayerPosition = slidingFitResult.GetGlobalMinLayerPosition();
-    m_maxLayerPosition = slidingFitResult.GetGlobalMaxLayerPosition();
 }
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -346,6 +358,137 @@ pandora::CartesianPointVector VertexSelectionBaseAlgorithm::ShowerCluster::GetCl
 //------------------------------------------------------------------------------------------------------------------------------------------
 //------------------------------------------------------------------------------------------------------------------------------------------
 
+VertexSelectionBaseAlgorithm::VertexFeatureBatch::VertexFeatureBatch(const VertexSelectionBaseAlgorithm *const pAlgorithm, const VertexVector &vertexVector,
+        const unsigned int nThreads) :
+    m_vertexVector(vertexVector),
+    m_nThreads(nThreads)
+{
+    for (const HitType hitType : {TPC_VIEW_U, TPC_VIEW_V, TPC_VIEW_W})
+    {
+        CartesianPointVector &projectedPositions(m_projectedPositionMap[hitType]);
+
+        for (const Vertex *const pVertex : m_vertexVector)
+            projectedPositions.push_back(LArGeometryHelper::ProjectPosition(pAlgorithm->GetPandora(), pVertex->GetPosition(), hitType));
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+VertexSelectionBaseAlgorithm::VertexFeatureBatch::VertexFeatureBatch(const VertexSelectionBaseAlgorithm *const pAlgorithm, const VertexVector &vertexVector,
+        const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const unsigned int nThreads) :
+    VertexFeatureBatch(pAlgorithm, vertexVector, nThreads)
+{
+    for (const HitType hitType : {TPC_VIEW_U, TPC_VIEW_V, TPC_VIEW_W})
+    {
+        for (const SlidingFitData &slidingFitData : slidingFitDataListMap.at(hitType))
+        {
+            const Cluster *const pCluster(slidingFitData.GetCluster());
+
+            m_clusterHitTypeMap.emplace(pCluster, hitType);
+
+            if (!m_sortedCaloHitMap.count(pCluster))
+                VertexFeatureBatch::SortCaloHits(pCluster, m_sortedCaloHitMap[pCluster]);
+        }
+
+        for (const ShowerCluster &showerCluster : showerClusterListMap.at(hitType))
+        {
+            for (const Cluster *const pCluster : showerCluster.GetClusters())
+            {
+                if (!m_sortedCaloHitMap.count(pCluster))
+                    VertexFeatureBatch::SortCaloHits(pCluster, m_sortedCaloHitMap[pCluster]);
+            }
+        }
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+float VertexSelectionBaseAlgorithm::VertexFeatureBatch::GetClosestDistance(const unsigned int vertexIndex, const Cluster *const pCluster) const
+{
+    const ClusterHitTypeMap::const_iterator iter(m_clusterHitTypeMap.find(pCluster));
+
+    if (m_clusterHitTypeMap.end() == iter)
+        throw StatusCodeException(STATUS_CODE_NOT_FOUND);
+
+    return LArClusterHelper::GetClosestDistance(this->GetProjectedPosition(vertexIndex, iter->second), pCluster);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void VertexSelectionBaseAlgorithm::VertexFeatureBatch::SearchKDTree(const HitType hitType, HitKDTree2D &kdTree, const float halfWidth,
+    const bool shareSearches, HitKDNode2DListVector &foundHitsVector, UIntVector &searchIndices) const
+{
+    const CartesianPointVector &projectedPositions(m_projectedPositionMap.at(hitType));
+    foundHitsVector.clear();
+    searchIndices.clear();
+
+    if (!shareSearches)
+    {
+        for (unsigned int vertexIndex = 0; vertexIndex < projectedPositions.size(); ++vertexIndex)
+        {
+            searchIndices.push_back(foundHitsVector.size());
+            foundHitsVector.emplace_back();
+            kdTree.search(build_2d_kd_search_region(projectedPositions.at(vertexIndex), halfWidth, halfWidth), foundHitsVector.back());
+        }
+
+        return;
+    }
+
+    const float cellWidth(2.f * halfWidth);
+
+    if (cellWidth < std::numeric_limits<float>::epsilon())
+        throw StatusCodeException(STATUS_CODE_INVALID_PARAMETER);
+
+    // Group the candidates by the window-sized cell containing their projected position
+    std::map<std::pair<int, int>, UIntVector> cellToVertexIndices;
+
+    for (unsigned int vertexIndex = 0; vertexIndex < projectedPositions.size(); ++vertexIndex)
+    {
+        const CartesianVector &position(projectedPositions.at(vertexIndex));
+        const std::pair<int, int> cell(static_cast<int>(std::floor(position.GetX() / cellWidth)), static_cast<int>(std::floor(position.GetZ() / cellWidth)));
+        cellToVertexIndices[cell].push_back(vertexIndex);
+    }
+
+    searchIndices.assign(projectedPositions.size(), 0);
+
+    for (const auto &mapEntry : cellToVertexIndices)
+    {
+        const UIntVector &vertexIndices(mapEntry.second);
+        KDTreeBox searchRegion(build_2d_kd_search_region(projectedPositions.at(vertexIndices.front()), halfWidth, halfWidth));
+
+        for (const unsigned int vertexIndex : vertexIndices)
+        {
+            const KDTreeBox vertexSearchRegion(build_2d_kd_search_region(projectedPositions.at(vertexIndex), halfWidth, halfWidth));
+
+            for (unsigned int iDim = 0; iDim < 2; ++iDim)
+            {
+                searchRegion.dimmin[iDim] = std::min(searchRegion.dimmin[iDim], vertexSearchRegion.dimmin[iDim]);
+                searchRegion.dimmax[iDim] = std::max(searchRegion.dimmax[iDim], vertexSearchRegion.dimmax[iDim]);
+            }
+
+            searchIndices.at(vertexIndex) = foundHitsVector.size();
+        }
+
+        // ATTN The kd tree prunes nodes that only touch a window edge, so a shared search may also find a hit lying exactly on a candidate window edge
+        foundHitsVector.emplace_back();
+        kdTree.search(searchRegion, foundHitsVector.back());
+    }
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+void VertexSelectionBaseAlgorithm::VertexFeatureBatch::SortCaloHits(const Cluster *const pCluster, CaloHitVector &caloHitVector)
+{
+    CaloHitList caloHitList;
+    pCluster->GetOrderedCaloHitList().FillCaloHitList(caloHitList);
+
+    caloHitVector.assign(caloHitList.begin(), caloHitList.end());
+    std::sort(caloHitVector.begin(), caloHitVector.end(), LArClusterHelper::SortHitsByPosition);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+//------------------------------------------------------------------------------------------------------------------------------------------
+
 StatusCode VertexSelectionBaseAlgorithm::ReadSettings(const TiXmlHandle xmlHandle)
 {
     PANDORA_RETURN_RESULT_IF(STATUS_CODE_SUCCESS, !=, XmlHelper::ReadVectorOfValues(xmlHandle,
@@ -11,11 +11,17 @@
 #include "Objects/Vertex.h"
 #include "Pandora/Algorithm.h"
 
+#include "larpandoracontent/LArHelpers/LArMultiThreadingHelper.h"
 #include "larpandoracontent/LArHelpers/LArMvaHelper.h"
 
+#include "larpandoracontent/LArObjects/LArDetectorGapIndex.h"
 #include "larpandoracontent/LArObjects/LArSupportVectorMachine.h"
+#include "larpandoracontent/LArObjects/LArTwoDSlidingFitCache.h"
 #include "larpandoracontent/LArObjects/LArTwoDSlidingFitResult.h"
 
+#include <memory>
+#include <unordered_map>
+
 namespace lar_content
 {
 
@@ -122,10 +128,9 @@ public:
          *  @brief  Constructor
          *
          *  @param  pCluster pointer to the cluster
-         *  @param  slidingFitWindow the sliding fit window
-         *  @param  slidingFitPitch the sliding fit pitch
+         *  @param  slidingFitResult the sliding fit result for the cluster
          */
-        SlidingFitData(const pandora::Cluster *const pCluster, const int slidingFitWindow, const float slidingFitPitch);
+        SlidingFitData(const pandora::Cluster *const pCluster, const TwoDSlidingFitResult &slidingFitResult);
 
         /**
          *  @brief  Get the min layer direction
@@ -230,6 +235,161 @@ public:
     typedef MvaFeatureTool<const VertexSelectionBaseAlgorithm *const, const pandora::Vertex * const, const SlidingFitDataListMap &,
         const ClusterListMap &, const KDTreeMap &, const ShowerClusterListMap &, const float, float &>  VertexFeatureTool; ///< The base type for the vertex feature tools
 
+    typedef std::vector<LArMvaHelper::MvaFeatureVector> VertexFeatureMatrix;   ///< The feature vectors for a list of vertices, in vertex order
+
+    typedef std::vector<HitKDNode2DList> HitKDNode2DListVector;  ///< The results of a list of kd tree searches
+
+    /**
+     *  @brief  Vertex feature batch class, holding a list of candidate vertices and the event data shared by vertex feature tools when
+     *          calculating features for all candidates at once. The batch is not modified once constructed, so may be read concurrently.
+     */
+    class VertexFeatureBatch
+    {
+    public:
+        /**
+         *  @brief  Constructor, for features requiring only the candidate vertex projections
+         *
+         *  @param  pAlgorithm address of the vertex selection algorithm
+         *  @param  vertexVector the candidate vertices
+         *  @param  nThreads the number of threads with which to calculate features (zero for one per available hardware core)
+         */
+        VertexFeatureBatch(const VertexSelectionBaseAlgorithm *const pAlgorithm, const pandora::VertexVector &vertexVector, const unsigned int nThreads);
+
+        /**
+         *  @brief  Constructor
+         *
+         *  @param  pAlgorithm address of the vertex selection algorithm
+         *  @param  vertexVector the candidate vertices
+         *  @param  slidingFitDataListMap the sliding fit data list map
+         *  @param  showerClusterListMap the shower cluster list map
+         *  @param  nThreads the number of threads with which to calculate features (zero for one per available hardware core)
+         */
+        VertexFeatureBatch(const VertexSelectionBaseAlgorithm *const pAlgorithm, const pandora::VertexVector &vertexVector,
+            const SlidingFitDataListMap &slidingFitDataListMap, const ShowerClusterListMap &showerClusterListMap, const unsigned int nThreads);
+
+        /**
+         *  @brief  Get the candidate vertices
+         *
+         *  @return the candidate vertices
+         */
+        const pandora::VertexVector &GetVertexVector() const;
+
+        /**
+         *  @brief  Get the number of threads with which to calculate features
+         *
+         *  @return the number of threads (zero for one per available hardware core)
+         */
+        unsigned int GetNThreads() const;
+
+        /**
+         *  @brief  Get the projection of a candidate vertex into a view
+         *
+         *  @param  vertexIndex the index of the vertex in the candidate vertex vector
+         *  @param  hitType the hit type for the view
+         *
+         *  @return the projected vertex position
+         */
+        const pandora::CartesianVector &GetProjectedPosition(const unsigned int vertexIndex, const pandora::HitType hitType) const;
+
+        /**
+         *  @brief  Get the closest distance between the projection of a candidate vertex and a cluster in the sliding fit data list map
+         *
+         *  @param  vertexIndex the index of the vertex in the candidate vertex vector
+         *  @param  pCluster address of the cluster
+         *
+         *  @return the closest distance
+         */
+        float GetClosestDistance(const unsigned int vertexIndex, const pandora::Cluster *const pCluster) const;
+
+        /**
+         *  @brief  Get the calo hits of a cluster in the sliding fit data list map or shower cluster list map, sorted by position
+         *
+         *  @param  pCluster address of the cluster
+         *
+         *  @return the sorted calo hits
+         */
+        const pandora::CaloHitVector &GetSortedCaloHits(const pandora::Cluster *const pCluster) const;
+
+        /**
+         *  @brief  Calculate a single feature for each candidate vertex, distributing the vertices across the batch threads, and append
+         *          the features to the feature matrix in vertex order
+         *
+         *  @param  featureFunction the feature functor, callable with signature float(unsigned int vertexIndex) and safe to call concurrently
+         *  @param  featureMatrix the feature matrix, with one feature vector per candidate vertex
+         */
+        template <typename FEATURE_FUNCTION>
+        void CalculateFeatures(const FEATURE_FUNCTION &featureFunction, VertexFeatureMatrix &featureMatrix) const;
+
+        /**
+         *  @brief  Search a kd tree for the hits in a square window about the projection of each candidate vertex into a view. Not thread
+         *          safe, as kd tree searches are not.
+         *
+         *          By default, each candidate has its own search, giving exactly the hits found vertex by vertex. If searches are shared,
+         *          candidates closer than the window width share a single search over the union of their windows, so the hits found must
+         *          still be tested against the window for each candidate. Shared searches are an approximation: the kd tree omits subtrees
+         *          that only touch a search window edge, so a shared search may also find hits lying exactly on a candidate window edge,
+         *          and hits are found in a different order.
+         *
+         *  @param  hitType the hit type for the view
+         *  @param  kdTree the kd tree for the view
+         *  @param  halfWidth the half width of the search window
+         *  @param  shareSearches whether nearby candidates should share a search
+         *  @param  foundHitsVector to receive the hits found in each search
+         *  @param  searchIndices to receive the index of the search covering each candidate vertex, in vertex order
+         */
+        void SearchKDTree(const pandora::HitType hitType, HitKDTree2D &kdTree, const float halfWidth, const bool shareSearches,
+            HitKDNode2DListVector &foundHitsVector, pandora::UIntVector &searchIndices) const;
+
+        /**
+         *  @brief  Fill a vector with the calo hits of a cluster, sorted by position
+         *
+         *  @param  pCluster address of the cluster
+         *  @param  caloHitVector to receive the sorted calo hits
+         */
+        static void SortCaloHits(const pandora::Cluster *const pCluster, pandora::CaloHitVector &caloHitVector);
+
+    private:
+        typedef std::map<pandora::HitType, pandora::CartesianPointVector> ProjectedPositionMap;
+        typedef std::unordered_map<const pandora::Cluster*, pandora::HitType> ClusterHitTypeMap;
+        typedef std::unordered_map<const pandora::Cluster*, pandora::CaloHitVector> SortedCaloHitMap;
+
+        pandora::VertexVector   m_vertexVector;             ///< The candidate vertices
+        unsigned int            m_nThreads;                 ///< The number of threads with which to calculate features
+        ProjectedPositionMap    m_projectedPositionMap;     ///< The projected vertex positions, by view, in vertex order
+        ClusterHitTypeMap       m_clusterHitTypeMap;        ///< The hit type for each sliding fit data cluster
+        SortedCaloHitMap        m_sortedCaloHitMap;         ///< The sorted calo hits for each cluster
+    };
+
+    /**
+     *  @brief  Vertex feature batch tool class, an interface for vertex feature tools able to calculate their features for all candidate
+     *          vertices in a single pass. Implementations must produce features identical to those calculated vertex by vertex, unless an
+     *          approximation has been explicitly enabled in their configuration.
+     */
+    class VertexFeatureBatchTool
+    {
+    public:
+        /**
+         *  @brief  Destructor
+         */
+        virtual ~VertexFeatureBatchTool() = default;
+
+        /**
+         *  @brief  Calculate features for all candidate vertices in a batch
+         *
+         *  @param  featureMatrix the feature matrix, with one feature vector per candidate vertex, to which to append the features
+         *  @param  pAlgorithm address of the calling algorithm
+         *  @param  vertexFeatureBatch the vertex feature batch
+         *  @param  slidingFitDataListMap the sliding fit data list map
+         *  @param  clusterListMap the cluster list map
+         *  @param  kdTreeMap the kd tree map
+         *  @param  showerClusterListMap the shower cluster list map
+         *  @param  beamDeweightingScores the beam deweighting scores, in vertex order
+         */
+        virtual void RunBatch(VertexFeatureMatrix &featureMatrix, const VertexSelectionBaseAlgorithm *const pAlgorithm,
+            const VertexFeatureBatch &vertexFeatureBatch, const SlidingFitDataListMap &slidingFitDataListMap, const ClusterListMap &clusterListMap,
+            const KDTreeMap &kdTreeMap, const ShowerClusterListMap &showerClusterListMap, const pandora::FloatVector &beamDeweightingScores) = 0;
+    };
+
 protected:
     /**
      *  @brief  Filter the input list of vertices to obtain a reduced number of vertex candidates
@@ -304,8 +464,10 @@ protected:
     bool IsBeamModeOn() const;
 
     pandora::StatusCode ReadSettings(const pandora::TiXmlHandle xmlHandle);
+    virtual pandora::StatusCode Reset();
 
 private:
+    pandora::StatusCode Initialize();
     pandora::StatusCode Run();
 
     /**
@@ -388,6 +550,9 @@ private:
 
     bool                    m_isEmptyViewAcceptable;        ///< Whether views entirely empty of hits are classed as 'acceptable' for candidate filtration
     unsigned int            m_minVertexAcceptableViews;     ///< The minimum number of views in which a candidate must sit on/near a hit or in a gap (or view can be empty)
+
+    std::shared_ptr<LArTwoDSlidingFitCache> m_pSlidingFitCache; ///< The event-scoped sliding fit cache, shared by algorithms in this pandora instance
+    std::shared_ptr<const LArDetectorGapIndex> m_pDetectorGapIndex; ///< The detector gap index, shared within this pandora instance
 };
 
 //------------------------------------------------------------------------------------------------------------------------------------------
@@ -507,6 +672,62 @@ inline const TwoDSlidingFitResult &VertexSelectionBaseAlgorithm::ShowerCluster::
     return m_twoDSlidingFitResult;
 }
 
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::VertexVector &VertexSelectionBaseAlgorithm::VertexFeatureBatch::GetVertexVector() const
+{
+    return m_vertexVector;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline unsigned int VertexSelectionBaseAlgorithm::VertexFeatureBatch::GetNThreads() const
+{
+    return m_nThreads;
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::CartesianVector &VertexSelectionBaseAlgorithm::VertexFeatureBatch::GetProjectedPosition(const unsigned int vertexIndex,
+    const pandora::HitType hitType) const
+{
+    return m_projectedPositionMap.at(hitType).at(vertexIndex);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+inline const pandora::CaloHitVector &VertexSelectionBaseAlgorithm::VertexFeatureBatch::GetSortedCaloHits(const pandora::Cluster *const pCluster) const
+{
+    return m_sortedCaloHitMap.at(pCluster);
+}
+
+//------------------------------------------------------------------------------------------------------------------------------------------
+
+template <typename FEATURE_FUNCTION>
+void VertexSelectionBaseAlgorithm::VertexFeatureBatch::CalculateFeatures(const FEATURE_FUNCTION &featureFunction, VertexFeatureMatrix &featureMatrix) const
+{
+    if (featureMatrix.size() != m_vertexVector.size())
+        throw pandora::StatusCodeException(pandora::STATUS_CODE_INVALID_PARAMETER);
+
+    // Each task writes only the feature for its own vertex; features are then appended serially
+    const unsigned int nTasks(m_vertexVector.size());
+    pandora::FloatVector features(nTasks, 0.f);
+
+    auto calculateFeature = [&](const unsigned int vertexIndex) -> pandora::StatusCode
+    {
+        features[vertexIndex] = featureFunction(vertexIndex);
+        return pandora::STATUS_CODE_SUCCESS;
+    };
+
+    const pandora::StatusCode statusCode(LArMultiThreadingHelper::RunTasks(nTasks, LArMultiThreadingHelper::GetNThreads(m_nThreads, nTasks), calculateFeature));
+
+    if (pandora::STATUS_CODE_SUCCESS != statusCode)
+        throw pandora::StatusCodeException(statusCode);
+
+    for (unsigned int vertexIndex = 0; vertexIndex < nTasks; ++vertexIndex)
+        featureMatrix.at(vertexIndex).push_back(features.at(vertexIndex));
+}
+
 } // namespace lar_content
 
 #endif // #ifndef LAR_VERTEX_SELECTION_BASE_ALGORITHM_H